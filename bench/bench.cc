@@ -0,0 +1,262 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+// Microbenchmarks for SLATE building blocks: tile kernels, internal routines,
+// tile storage, and communication primitives. Unlike test/tester, which runs
+// whole drivers, each benchmark times one building block in isolation.
+//
+// Usage: bench [options] [routine-prefix ...]
+// See `bench --help`.
+
+#include "bench.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+using slate::llong;
+
+namespace bench {
+
+//------------------------------------------------------------------------------
+// global variables
+Params   g_params;
+MPI_Comm g_mpi_comm = MPI_COMM_WORLD;
+int      g_mpi_rank = 0;
+int      g_mpi_size = 1;
+
+//------------------------------------------------------------------------------
+bool selected( std::string const& routine )
+{
+    if (g_params.routines.empty())
+        return true;
+
+    for (auto const& prefix : g_params.routines) {
+        if (routine.compare( 0, prefix.size(), prefix ) == 0)
+            return true;
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+void report_header()
+{
+    if (g_mpi_rank != 0 || g_params.format != Format::CSV)
+        return;
+
+    printf( "routine,type,nb,nt,ranks,calls,"
+            "time_avg,time_min,us_per_call,gflops,gbytes_per_sec\n" );
+    fflush( stdout );
+}
+
+//------------------------------------------------------------------------------
+void report(
+    std::string const& routine, char type, int64_t nb, int64_t nt,
+    int64_t calls, Timing const& time, double gflop, double gbyte )
+{
+    if (g_mpi_rank != 0)
+        return;
+
+    // Rates use the fastest sample; the overhead uses the average.
+    double us_per_call = time.avg / std::max( calls, int64_t( 1 ) ) * 1e6;
+    double gflops = (time.min > 0 ? gflop / time.min : 0);
+    double gbytes = (time.min > 0 ? gbyte / time.min : 0);
+
+    if (g_params.format == Format::CSV) {
+        printf( "%s,%c,%lld,%lld,%d,%lld,%.6e,%.6e,%.4f,%.4f,%.4f\n",
+                routine.c_str(), type, llong( nb ), llong( nt ), g_mpi_size,
+                llong( calls ), time.avg, time.min, us_per_call,
+                gflops, gbytes );
+    }
+    else {
+        printf( "{\"routine\": \"%s\", \"type\": \"%c\", \"nb\": %lld, "
+                "\"nt\": %lld, \"ranks\": %d, \"calls\": %lld, "
+                "\"time_avg\": %.6e, \"time_min\": %.6e, "
+                "\"us_per_call\": %.4f, \"gflops\": %.4f, "
+                "\"gbytes_per_sec\": %.4f}\n",
+                routine.c_str(), type, llong( nb ), llong( nt ), g_mpi_size,
+                llong( calls ), time.avg, time.min, us_per_call,
+                gflops, gbytes );
+    }
+    fflush( stdout );
+}
+
+//------------------------------------------------------------------------------
+/// Runs all benchmark groups for one precision and tile size.
+/// Single process benchmarks run on rank 0 only, so other ranks don't
+/// compete for memory bandwidth; the communication benchmarks use all ranks.
+template <typename scalar_t>
+void run( int64_t nb )
+{
+    if (g_mpi_rank == 0) {
+        bench_tile<scalar_t>( nb );
+        bench_internal<scalar_t>( nb );
+        bench_storage<scalar_t>( nb );
+    }
+    slate_mpi_call(
+        MPI_Barrier( g_mpi_comm ));
+
+    bench_comm<scalar_t>( nb );
+}
+
+//------------------------------------------------------------------------------
+void usage()
+{
+    printf(
+        "Usage: bench [options] [routine-prefix ...]\n"
+        "Options:\n"
+        "    --nb n[,n...]     tile sizes (default 256)\n"
+        "    --nt n            tiles per dimension in matrix benchmarks (default 4)\n"
+        "    --type t[,t...]   precisions s, d, c, z (default d)\n"
+        "    --repeat n        timed samples per benchmark (default 10)\n"
+        "    --grid pxq        MPI grid for communication benchmarks\n"
+        "                      (default: near square grid of all ranks)\n"
+        "    --format f        csv or json (default csv)\n"
+        "Routines (select by prefix, e.g., `tile` or `comm-listBcast`):\n"
+        "    tile-gemm, tile-herk, tile-trsm,\n"
+        "    tile-gecopy, tile-tzcopy, tile-tzset, tile-transpose,\n"
+        "    internal-gemm, internal-gemm-numa-{off,on},\n"
+        "    internal-herk, internal-trsm, internal-permuteRows,\n"
+        "    storage-insert, storage-find, storage-erase, memory-alloc-free,\n"
+        "    comm-listBcast, comm-listReduce-{binomial,reducescatter,pipelined},\n"
+        "    comm-redistribute\n"
+        "Output columns:\n"
+        "    calls           kernel calls per sample\n"
+        "    time_avg/min    seconds per sample\n"
+        "    us_per_call     microseconds per kernel call, from time_avg\n"
+        "    gflops          Gflop/s, from time_min\n"
+        "    gbytes_per_sec  GB/s moved (read + written, or sent), from time_min\n" );
+}
+
+//------------------------------------------------------------------------------
+/// Parses comma separated list of values.
+template <typename T>
+std::vector<T> parse_list( char const* str )
+{
+    std::vector<T> list;
+    std::istringstream ss( str );
+    std::string token;
+    while (std::getline( ss, token, ',' )) {
+        std::istringstream ts( token );
+        T value;
+        if (! (ts >> value))
+            throw slate::Exception( "invalid list: " + std::string( str ) );
+        list.push_back( value );
+    }
+    return list;
+}
+
+//------------------------------------------------------------------------------
+/// Parses command line into g_params. Returns false if --help was given.
+bool parse_args( int argc, char** argv )
+{
+    // Default grid: p <= q, p*q = number of ranks, as square as possible.
+    int p = int( std::sqrt( double( g_mpi_size ) ) );
+    while (g_mpi_size % p != 0)
+        --p;
+    g_params.p = p;
+    g_params.q = g_mpi_size / p;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[ i ];
+        bool has_value = (i+1 < argc);
+        if (arg == "-h" || arg == "--help") {
+            return false;
+        }
+        else if (arg == "--nb" && has_value) {
+            g_params.nb = parse_list<int64_t>( argv[ ++i ] );
+        }
+        else if (arg == "--nt" && has_value) {
+            g_params.nt = atol( argv[ ++i ] );
+        }
+        else if (arg == "--type" && has_value) {
+            g_params.type = parse_list<char>( argv[ ++i ] );
+        }
+        else if (arg == "--repeat" && has_value) {
+            g_params.repeat = atoi( argv[ ++i ] );
+        }
+        else if (arg == "--grid" && has_value) {
+            if (sscanf( argv[ ++i ], "%dx%d", &g_params.p, &g_params.q ) != 2)
+                throw slate::Exception( "invalid grid: " + std::string( argv[ i ] ) );
+        }
+        else if (arg == "--format" && has_value) {
+            std::string format = argv[ ++i ];
+            if (format == "csv")
+                g_params.format = Format::CSV;
+            else if (format == "json")
+                g_params.format = Format::JSON;
+            else
+                throw slate::Exception( "unknown format: " + format );
+        }
+        else if (arg.compare( 0, 2, "--" ) == 0) {
+            throw slate::Exception( "unknown option: " + arg );
+        }
+        else {
+            g_params.routines.push_back( arg );
+        }
+    }
+
+    if (g_params.p * g_params.q != g_mpi_size)
+        throw slate::Exception( "grid p*q must equal the number of MPI ranks" );
+    slate_error_if( g_params.nt < 1 );
+    slate_error_if( g_params.repeat < 1 );
+    for (auto nb : g_params.nb)
+        slate_error_if( nb < 1 );
+    return true;
+}
+
+}  // namespace bench
+
+//------------------------------------------------------------------------------
+int main( int argc, char** argv )
+{
+    using namespace bench;  // for globals
+
+    int provided = 0;
+    slate_mpi_call(
+        MPI_Init_thread( &argc, &argv, MPI_THREAD_MULTIPLE, &provided ));
+    slate_mpi_call(
+        MPI_Comm_rank( g_mpi_comm, &g_mpi_rank ));
+    slate_mpi_call(
+        MPI_Comm_size( g_mpi_comm, &g_mpi_size ));
+
+    int status = 0;
+    try {
+        if (provided < MPI_THREAD_MULTIPLE)
+            throw std::runtime_error( "SLATE requires MPI_THREAD_MULTIPLE" );
+
+        if (parse_args( argc, argv )) {
+            report_header();
+            for (auto type : g_params.type) {
+                for (auto nb : g_params.nb) {
+                    switch (type) {
+                        case 's': run< float >( nb ); break;
+                        case 'd': run< double >( nb ); break;
+                        case 'c': run< std::complex<float> >( nb ); break;
+                        case 'z': run< std::complex<double> >( nb ); break;
+                        default:
+                            throw slate::Exception(
+                                std::string( "unknown type: " ) + type );
+                    }
+                }
+            }
+        }
+        else if (g_mpi_rank == 0) {
+            usage();
+        }
+    }
+    catch (std::exception const& ex) {
+        if (g_mpi_rank == 0)
+            fprintf( stderr, "Error: %s\n", ex.what() );
+        status = 1;
+    }
+
+    slate_mpi_call(
+        MPI_Finalize());
+    return status;
+}
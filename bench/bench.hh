@@ -0,0 +1,190 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_BENCH_HH
+#define SLATE_BENCH_HH
+
+#include "slate/slate.hh"
+#include "slate/internal/mpi.hh"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <omp.h>
+
+namespace bench {
+
+//------------------------------------------------------------------------------
+/// Output formats.
+enum class Format {
+    CSV,    ///< comma separated values, with one header line
+    JSON,   ///< one JSON object per line
+};
+
+//------------------------------------------------------------------------------
+/// Command line parameters, shared by all benchmarks.
+struct Params {
+    std::vector<int64_t> nb = { 256 };  ///< tile sizes to sweep
+    std::vector<char> type = { 'd' };   ///< precisions to sweep: s, d, c, z
+    int64_t nt     = 4;     ///< tiles per dimension in matrix benchmarks
+    int     repeat = 10;    ///< timed samples per benchmark
+    int     p      = 1;     ///< MPI grid rows for communication benchmarks
+    int     q      = 1;     ///< MPI grid cols for communication benchmarks
+    Format  format = Format::CSV;
+    std::vector<std::string> routines;  ///< name prefixes; empty runs all
+};
+
+extern Params   g_params;
+extern MPI_Comm g_mpi_comm;
+extern int      g_mpi_rank;
+extern int      g_mpi_size;
+
+//------------------------------------------------------------------------------
+/// Timing statistics of one benchmark, in seconds per sample.
+struct Timing {
+    double min = std::numeric_limits<double>::max();
+    double avg = 0;
+};
+
+//------------------------------------------------------------------------------
+/// Returns true if routine matches one of the command line prefixes,
+/// or if no routines were given.
+bool selected( std::string const& routine );
+
+//------------------------------------------------------------------------------
+/// Prints one result line on rank 0.
+///
+/// @param[in] routine
+///     Benchmark name, e.g., "tile-gemm".
+///
+/// @param[in] type
+///     Precision: s, d, c, or z.
+///
+/// @param[in] nb
+///     Tile size.
+///
+/// @param[in] nt
+///     Tiles per dimension, or 1 for single tile benchmarks.
+///
+/// @param[in] calls
+///     Number of kernel calls (tiles, allocations, messages) in one sample;
+///     the per-call overhead is time.avg / calls.
+///
+/// @param[in] time
+///     Timing of one sample.
+///
+/// @param[in] gflop
+///     Floating point operations in one sample, in 1e9; 0 if not applicable.
+///
+/// @param[in] gbyte
+///     Bytes read and written (or sent) in one sample, in 1e9.
+///
+void report(
+    std::string const& routine, char type, int64_t nb, int64_t nt,
+    int64_t calls, Timing const& time, double gflop, double gbyte );
+
+//------------------------------------------------------------------------------
+/// Prints the header line for CSV output on rank 0.
+void report_header();
+
+//------------------------------------------------------------------------------
+/// Times g_params.repeat samples of fn, after one untimed warm-up sample.
+/// setup is called before each sample, outside the timed region, to restore
+/// state (e.g., erase received tiles). All ranks in comm synchronize before
+/// each sample, and a sample's time is the max over ranks.
+///
+template <typename Setup, typename Fn>
+Timing time_samples( MPI_Comm comm, Setup&& setup, Fn&& fn )
+{
+    Timing timing;
+
+    setup();
+    fn();
+
+    for (int r = 0; r < g_params.repeat; ++r) {
+        setup();
+        slate_mpi_call(
+            MPI_Barrier( comm ));
+        double time = omp_get_wtime();
+        fn();
+        time = omp_get_wtime() - time;
+        slate_mpi_call(
+            MPI_Allreduce( MPI_IN_PLACE, &time, 1, MPI_DOUBLE, MPI_MAX, comm ));
+
+        timing.min = std::min( timing.min, time );
+        timing.avg += time;
+    }
+    timing.avg /= std::max( g_params.repeat, 1 );
+    return timing;
+}
+
+//------------------------------------------------------------------------------
+/// Returns the precision character for scalar_t: s, d, c, or z.
+template <typename scalar_t>
+char type_char()
+{
+    using real_t = blas::real_type<scalar_t>;
+    bool single = std::is_same< real_t, float >::value;
+    if (slate::is_complex<scalar_t>::value)
+        return single ? 'c' : 'z';
+    else
+        return single ? 's' : 'd';
+}
+
+//------------------------------------------------------------------------------
+/// Number of kernel calls per sample for single tile benchmarks, so that
+/// small tiles run long enough to measure the per-call overhead.
+inline int64_t calls_per_sample( int64_t nb )
+{
+    int64_t work = std::max( nb*nb*nb, int64_t( 1 ) );
+    return std::max( int64_t( 1 ),
+                     std::min( int64_t( 10000 ), (int64_t( 1 ) << 24) / work ));
+}
+
+//------------------------------------------------------------------------------
+/// Fills the m-by-n matrix A with uniform random entries in (-1, 1).
+template <typename scalar_t>
+void random_fill( int64_t m, int64_t n, scalar_t* A, int64_t lda )
+{
+    static int64_t iseed[ 4 ] = { 0, 0, 0, 1 };
+    for (int64_t j = 0; j < n; ++j)
+        lapack::larnv( 2, iseed, m, &A[ j*lda ] );
+}
+
+//------------------------------------------------------------------------------
+/// Inserts and fills all local tiles of A with random entries.
+template <typename scalar_t>
+void random_fill( slate::BaseMatrix<scalar_t>& A )
+{
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                A.tileInsert( i, j );
+                auto T = A( i, j );
+                random_fill( T.mb(), T.nb(), T.data(), T.stride() );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Benchmark groups, one file each, instantiated for the 4 precisions.
+template <typename scalar_t>
+void bench_tile( int64_t nb );
+
+template <typename scalar_t>
+void bench_internal( int64_t nb );
+
+template <typename scalar_t>
+void bench_storage( int64_t nb );
+
+template <typename scalar_t>
+void bench_comm( int64_t nb );
+
+}  // namespace bench
+
+#endif // SLATE_BENCH_HH
@@ -0,0 +1,145 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "bench.hh"
+
+#include <set>
+
+namespace bench {
+
+//------------------------------------------------------------------------------
+/// Benchmarks the communication patterns of the drivers on an nt-by-nt tile
+/// matrix distributed on the p-by-q grid of all ranks:
+/// - comm-listBcast:    broadcast block column 0 along process rows,
+///                      as gemm does for A(:, k).
+/// - comm-listReduce-*: reduce C(:, 0) across the ranks owning each block
+///                      row, as gemmA does, with each MethodReduce algorithm.
+/// - comm-redistribute: redistribute from column-major to row-major grid.
+/// Bandwidth counts tile data sent between distinct ranks; the per-call
+/// time is per tile in the pattern. With one rank, nothing is sent, so this
+/// measures the bookkeeping overhead alone.
+///
+template <typename scalar_t>
+void bench_comm( int64_t nb )
+{
+    using slate::Layout;
+    using BcastList  = typename slate::Matrix<scalar_t>::BcastList;
+    using ReduceList = typename slate::Matrix<scalar_t>::ReduceList;
+
+    const char type = type_char<scalar_t>();
+    const int64_t nt = g_params.nt;
+    const int64_t n = nb*nt;
+    const double gbytes = double( nb*nb ) * sizeof( scalar_t ) * 1e-9;
+    const int p = g_params.p;
+    const int q = g_params.q;
+    MPI_Comm comm = g_mpi_comm;
+
+    slate::Matrix<scalar_t> A( n, n, nb, nb, slate::GridOrder::Col, p, q, comm );
+    random_fill( A );
+
+    //----------
+    if (selected( "comm-listBcast" )) {
+        BcastList bcast_list;
+        int64_t messages = 0;
+        for (int64_t i = 0; i < nt; ++i) {
+            auto dest = A.sub( i, i, 1, nt-1 );
+            bcast_list.push_back( { i, 0, { dest } } );
+
+            std::set<int> ranks;
+            dest.getRanks( &ranks );
+            ranks.insert( A.tileRank( i, 0 ) );
+            messages += ranks.size() - 1;
+        }
+
+        auto release = [&] {
+            A.releaseRemoteWorkspace();
+        };
+        auto time = time_samples( comm, release, [&] {
+            A.template listBcast( bcast_list, Layout::ColMajor );
+        });
+        release();
+        report( "comm-listBcast", type, nb, nt, nt, time,
+                0, messages * gbytes );
+    }
+
+    //----------
+    for (slate::Method method : { slate::MethodReduce::Binomial,
+                                  slate::MethodReduce::ReduceScatter,
+                                  slate::MethodReduce::Pipelined }) {
+        std::string name = std::string( "comm-listReduce-" )
+                         + slate::MethodReduce::methodReduce2str( method );
+        if (! selected( name ))
+            continue;
+
+        ReduceList reduce_list;
+        int64_t messages = 0;
+        for (int64_t i = 0; i < nt; ++i) {
+            auto src = A.sub( i, i, 0, nt-1 );
+            reduce_list.push_back( { i, 0, A.sub( i, i, 0, 0 ), { src } } );
+
+            std::set<int> ranks;
+            src.getRanks( &ranks );
+            ranks.insert( A.tileRank( i, 0 ) );
+            messages += ranks.size() - 1;
+        }
+
+        // Each rank contributing to block row i, other than the owner of
+        // A(i, 0), holds a workspace copy of A(i, 0), as in gemmA.
+        // listReduce erases these copies, so insert them for every sample.
+        auto insert_partial = [&] {
+            for (int64_t i = 0; i < nt; ++i) {
+                std::set<int> ranks;
+                A.sub( i, i, 0, nt-1 ).getRanks( &ranks );
+                if (! A.tileIsLocal( i, 0 )
+                    && ranks.find( g_mpi_rank ) != ranks.end()
+                    && ! A.tileExists( i, 0 ))
+                {
+                    A.tileInsertWorkspace( i, 0 );
+                    auto T = A( i, 0 );
+                    random_fill( T.mb(), T.nb(), T.data(), T.stride() );
+                    A.tileModified( i, 0 );
+                }
+            }
+        };
+        auto time = time_samples( comm, insert_partial, [&] {
+            A.template listReduce( reduce_list, Layout::ColMajor, 0, method );
+        });
+        report( name, type, nb, nt, nt, time,
+                0, messages * gbytes );
+    }
+
+    //----------
+    if (selected( "comm-redistribute" )) {
+        slate::Matrix<scalar_t> B( n, n, nb, nb, slate::GridOrder::Row, p, q, comm );
+        B.insertLocalTiles();
+
+        int64_t messages = 0;
+        for (int64_t j = 0; j < nt; ++j)
+            for (int64_t i = 0; i < nt; ++i)
+                messages += (A.tileRank( i, j ) != B.tileRank( i, j ));
+
+        auto time = time_samples( comm, [] {}, [&] {
+            slate::redistribute( A, B );
+        });
+        report( "comm-redistribute", type, nb, nt, nt*nt, time,
+                0, messages * gbytes );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void bench_comm< float >( int64_t nb );
+
+template
+void bench_comm< double >( int64_t nb );
+
+template
+void bench_comm< std::complex<float> >( int64_t nb );
+
+template
+void bench_comm< std::complex<double> >( int64_t nb );
+
+}  // namespace bench
@@ -0,0 +1,192 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "bench.hh"
+#include "slate/internal/OmpSetMaxActiveLevels.hh"
+#include "internal/internal.hh"
+
+#include <blas/flops.hh>
+
+namespace bench {
+
+//------------------------------------------------------------------------------
+/// Runs fn inside an OpenMP parallel region, on the master thread,
+/// as the drivers do, so internal routines can spawn tasks.
+template <typename Fn>
+void omp_master( Fn&& fn )
+{
+    slate::OmpSetMaxActiveLevels set_active_levels( slate::MinOmpActiveLevels );
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        fn();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Benchmarks internal::gemm, herk, trsm, and permuteRows with
+/// Target::HostTask on synthetic tile sets of nt tiles per dimension,
+/// as used in one step of the blocked algorithms: C (nt-by-nt tiles) is
+/// updated by a block column A (nt-by-1) and a block row B (1-by-nt).
+/// Matrices live on a single rank (MPI_COMM_SELF), so no communication
+/// is timed. The per-call time is per tile update.
+///
+template <typename scalar_t>
+void bench_internal( int64_t nb )
+{
+    using real_t = blas::real_type<scalar_t>;
+    using slate::Target;
+    using slate::Layout;
+
+    const scalar_t one = 1.0;
+    const real_t r_one = 1.0;
+    const char type = type_char<scalar_t>();
+    const int64_t nt = g_params.nt;
+    const int64_t n = nb*nt;
+    MPI_Comm comm = MPI_COMM_SELF;
+    auto no_setup = [] {};
+
+    slate::Matrix<scalar_t> A( n, nb, nb, 1, 1, comm );
+    slate::Matrix<scalar_t> B( nb, n, nb, 1, 1, comm );
+    slate::Matrix<scalar_t> C( n, n, nb, 1, 1, comm );
+    random_fill( A );
+    random_fill( B );
+    random_fill( C );
+
+    //----------
+    if (selected( "internal-gemm" )) {
+        auto time = time_samples( comm, no_setup, [&] {
+            omp_master( [&] {
+                slate::internal::gemm<Target::HostTask>(
+                    one, std::move( A ), std::move( B ),
+                    one, std::move( C ), Layout::ColMajor );
+            });
+        });
+        report( "internal-gemm", type, nb, nt, nt*nt, time,
+                blas::Gflop<scalar_t>::gemm( n, n, nb ),
+                blas::Gbyte<scalar_t>::gemm( n, n, nb ) );
+    }
+
+    //----------
+    if (selected( "internal-gemm-numa" )) {
+        // Here C is first touched by tasks across all threads, so on
+        // multi-socket nodes its tiles are spread over the NUMA nodes,
+        // as after a parallel initialization or earlier updates.
+        // Compares updating tiles from any thread with Option::TileAffinity,
+        // which updates them from threads on their home node.
+        // On a single NUMA node, both variants are the same.
+        slate::Matrix<scalar_t> CN( n, n, nb, 1, 1, comm );
+        CN.insertLocalTiles();
+        omp_master( [&] {
+            for (int64_t j = 0; j < CN.nt(); ++j) {
+                for (int64_t i = 0; i < CN.mt(); ++i) {
+                    #pragma omp task shared( CN ) firstprivate( i, j )
+                    {
+                        auto T = CN( i, j );
+                        lapack::laset( lapack::MatrixType::General,
+                                       T.mb(), T.nb(), scalar_t( 0.5 ), one,
+                                       T.data(), T.stride() );
+                    }
+                }
+            }
+            #pragma omp taskwait
+        });
+
+        for (bool affinity : { false, true }) {
+            slate::Options opts = {
+                { slate::Option::TileAffinity, affinity }
+            };
+            auto time = time_samples( comm, no_setup, [&] {
+                omp_master( [&] {
+                    slate::internal::gemm<Target::HostTask>(
+                        one, std::move( A ), std::move( B ),
+                        one, std::move( CN ), Layout::ColMajor, 0, 0, opts );
+                });
+            });
+            std::string name = std::string( "internal-gemm-numa-" )
+                             + (affinity ? "on" : "off");
+            report( name, type, nb, nt, nt*nt, time,
+                    blas::Gflop<scalar_t>::gemm( n, n, nb ),
+                    blas::Gbyte<scalar_t>::gemm( n, n, nb ) );
+        }
+    }
+
+    //----------
+    if (selected( "internal-herk" )) {
+        slate::HermitianMatrix<scalar_t> CH( slate::Uplo::Lower, C );
+        auto time = time_samples( comm, no_setup, [&] {
+            omp_master( [&] {
+                slate::internal::herk<Target::HostTask>(
+                    r_one, std::move( A ),
+                    r_one, std::move( CH ) );
+            });
+        });
+        report( "internal-herk", type, nb, nt, nt*(nt + 1)/2, time,
+                blas::Gflop<scalar_t>::herk( n, nb ),
+                blas::Gbyte<scalar_t>::herk( n, nb ) );
+    }
+
+    //----------
+    if (selected( "internal-trsm" )) {
+        // Solve with the identity, as in bench_tile, so repeated solves
+        // leave B unchanged.
+        slate::Matrix<scalar_t> T( nb, nb, nb, 1, 1, comm );
+        T.insertLocalTiles();
+        auto T00 = T( 0, 0 );
+        lapack::laset( lapack::MatrixType::General, nb, nb,
+                       scalar_t( 0.0 ), one, T00.data(), T00.stride() );
+        slate::TriangularMatrix<scalar_t> L(
+            slate::Uplo::Lower, slate::Diag::NonUnit, T );
+
+        auto time = time_samples( comm, no_setup, [&] {
+            omp_master( [&] {
+                slate::internal::trsm<Target::HostTask>(
+                    slate::Side::Left, one, std::move( L ), std::move( B ) );
+            });
+        });
+        report( "internal-trsm", type, nb, nt, nt, time,
+                blas::Gflop<scalar_t>::trsm( blas::Side::Left, nb, n ),
+                blas::Gbyte<scalar_t>::trsm( blas::Side::Left, nb, n ) );
+    }
+
+    //----------
+    if (selected( "internal-permuteRows" )) {
+        // Random pivots for an nb-wide panel, as from a panel factorization
+        // of C's first block column, applied to all nt block columns.
+        std::vector<slate::Pivot> pivots( nb );
+        for (int64_t i = 0; i < nb; ++i) {
+            int64_t k = i + rand() % (n - i);
+            pivots[ i ] = slate::Pivot( k / nb, k % nb );
+        }
+
+        auto time = time_samples( comm, no_setup, [&] {
+            omp_master( [&] {
+                slate::internal::permuteRows<Target::HostTask>(
+                    slate::Direction::Forward, std::move( C ), pivots,
+                    Layout::ColMajor );
+            });
+        });
+        // Each swap reads and writes 2 rows of length n.
+        report( "internal-permuteRows", type, nb, nt, nb*nt, time,
+                0, 4.0 * nb * n * sizeof( scalar_t ) * 1e-9 );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void bench_internal< float >( int64_t nb );
+
+template
+void bench_internal< double >( int64_t nb );
+
+template
+void bench_internal< std::complex<float> >( int64_t nb );
+
+template
+void bench_internal< std::complex<double> >( int64_t nb );
+
+}  // namespace bench
@@ -0,0 +1,111 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "bench.hh"
+#include "slate/internal/Memory.hh"
+
+namespace bench {
+
+//------------------------------------------------------------------------------
+/// Benchmarks the tile bookkeeping in MatrixStorage: inserting, finding,
+/// and erasing host tiles of an nt-by-nt tile matrix, and Memory block
+/// alloc/free. These are pure overheads; the per-call time is per tile
+/// or per block, and the bandwidth counts the tile data allocated.
+///
+template <typename scalar_t>
+void bench_storage( int64_t nb )
+{
+    using slate::HostNum;
+
+    const char type = type_char<scalar_t>();
+    const int64_t nt = g_params.nt;
+    const int64_t n = nb*nt;
+    const double gbytes = double( nb*nb ) * sizeof( scalar_t ) * 1e-9;
+    MPI_Comm comm = MPI_COMM_SELF;
+
+    slate::Matrix<scalar_t> A( n, n, nb, 1, 1, comm );
+
+    auto erase_all = [&] {
+        for (int64_t j = 0; j < nt; ++j)
+            for (int64_t i = 0; i < nt; ++i)
+                if (A.tileExists( i, j ))
+                    A.tileErase( i, j );
+    };
+
+    auto insert_all = [&] {
+        for (int64_t j = 0; j < nt; ++j)
+            for (int64_t i = 0; i < nt; ++i)
+                if (! A.tileExists( i, j ))
+                    A.tileInsert( i, j );
+    };
+
+    //----------
+    if (selected( "storage-insert" )) {
+        auto time = time_samples( comm, erase_all, [&] {
+            for (int64_t j = 0; j < nt; ++j)
+                for (int64_t i = 0; i < nt; ++i)
+                    A.tileInsert( i, j );
+        });
+        report( "storage-insert", type, nb, nt, nt*nt, time,
+                0, nt*nt * gbytes );
+    }
+
+    //----------
+    if (selected( "storage-find" )) {
+        int64_t found = 0;
+        auto time = time_samples( comm, insert_all, [&] {
+            for (int64_t j = 0; j < nt; ++j)
+                for (int64_t i = 0; i < nt; ++i)
+                    found += A.tileExists( i, j );
+        });
+        slate_assert( found == (g_params.repeat + 1) * nt*nt );
+        report( "storage-find", type, nb, nt, nt*nt, time, 0, 0 );
+    }
+
+    //----------
+    if (selected( "storage-erase" )) {
+        auto time = time_samples( comm, insert_all, [&] {
+            for (int64_t j = 0; j < nt; ++j)
+                for (int64_t i = 0; i < nt; ++i)
+                    A.tileErase( i, j );
+        });
+        report( "storage-erase", type, nb, nt, nt*nt, time,
+                0, nt*nt * gbytes );
+    }
+    erase_all();
+
+    //----------
+    if (selected( "memory-alloc-free" )) {
+        // Allocates nt*nt blocks, then frees them, as a matrix's workspace
+        // grows and is released.
+        size_t block_size = sizeof( scalar_t ) * nb*nb;
+        slate::Memory memory( block_size );
+        std::vector<void*> blocks( nt*nt );
+        auto time = time_samples( comm, [] {}, [&] {
+            for (auto& block : blocks)
+                block = memory.alloc( HostNum, block_size, nullptr );
+            for (auto& block : blocks)
+                memory.free( block, HostNum );
+        });
+        report( "memory-alloc-free", type, nb, nt, nt*nt, time,
+                0, nt*nt * gbytes );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void bench_storage< float >( int64_t nb );
+
+template
+void bench_storage< double >( int64_t nb );
+
+template
+void bench_storage< std::complex<float> >( int64_t nb );
+
+template
+void bench_storage< std::complex<double> >( int64_t nb );
+
+}  // namespace bench
@@ -0,0 +1,152 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "bench.hh"
+#include "slate/Tile_blas.hh"
+#include "slate/Tile_aux.hh"
+
+#include <blas/flops.hh>
+
+namespace bench {
+
+//------------------------------------------------------------------------------
+/// Benchmarks Tile_blas and Tile_aux kernels on nb-by-nb tiles in host
+/// memory. Each sample calls the kernel calls_per_sample( nb ) times on the
+/// same tiles, so for small nb it measures the per-call overhead.
+///
+template <typename scalar_t>
+void bench_tile( int64_t nb )
+{
+    using real_t = blas::real_type<scalar_t>;
+    using slate::Tile;
+    using slate::TileKind;
+    using slate::HostNum;
+
+    const scalar_t one = 1.0;
+    const real_t r_one = 1.0;
+    const char type = type_char<scalar_t>();
+    const int64_t calls = calls_per_sample( nb );
+    const double bytes = double( nb*nb ) * sizeof( scalar_t );
+    auto no_setup = [] {};
+
+    std::vector<scalar_t> Adata( nb*nb ), Bdata( nb*nb ), Cdata( nb*nb );
+    random_fill( nb, nb, Adata.data(), nb );
+    random_fill( nb, nb, Bdata.data(), nb );
+    random_fill( nb, nb, Cdata.data(), nb );
+
+    Tile<scalar_t> A( nb, nb, Adata.data(), nb, HostNum, TileKind::UserOwned );
+    Tile<scalar_t> B( nb, nb, Bdata.data(), nb, HostNum, TileKind::UserOwned );
+    Tile<scalar_t> C( nb, nb, Cdata.data(), nb, HostNum, TileKind::UserOwned );
+
+    //----------
+    if (selected( "tile-gemm" )) {
+        auto time = time_samples( MPI_COMM_SELF, no_setup, [&] {
+            for (int64_t c = 0; c < calls; ++c)
+                slate::tile::gemm( one, A, B, one, C );
+        });
+        report( "tile-gemm", type, nb, 1, calls, time,
+                calls * blas::Gflop<scalar_t>::gemm( nb, nb, nb ),
+                calls * blas::Gbyte<scalar_t>::gemm( nb, nb, nb ) );
+    }
+
+    //----------
+    if (selected( "tile-herk" )) {
+        C.uplo( slate::Uplo::Lower );
+        auto time = time_samples( MPI_COMM_SELF, no_setup, [&] {
+            for (int64_t c = 0; c < calls; ++c)
+                slate::tile::herk( r_one, A, r_one, C );
+        });
+        C.uplo( slate::Uplo::General );
+        report( "tile-herk", type, nb, 1, calls, time,
+                calls * blas::Gflop<scalar_t>::herk( nb, nb ),
+                calls * blas::Gbyte<scalar_t>::herk( nb, nb ) );
+    }
+
+    //----------
+    if (selected( "tile-trsm" )) {
+        // Solve with the identity, stored as a lower triangle, so that
+        // repeated solves leave B unchanged; the work is the same as for
+        // any non-unit triangle.
+        std::vector<scalar_t> Tdata( nb*nb );
+        lapack::laset( lapack::MatrixType::General, nb, nb,
+                       scalar_t( 0.0 ), one, Tdata.data(), nb );
+        Tile<scalar_t> T( nb, nb, Tdata.data(), nb, HostNum, TileKind::UserOwned );
+        T.uplo( slate::Uplo::Lower );
+
+        auto time = time_samples( MPI_COMM_SELF, no_setup, [&] {
+            for (int64_t c = 0; c < calls; ++c)
+                slate::tile::trsm( slate::Side::Left, slate::Diag::NonUnit,
+                                   one, T, B );
+        });
+        report( "tile-trsm", type, nb, 1, calls, time,
+                calls * blas::Gflop<scalar_t>::trsm( blas::Side::Left, nb, nb ),
+                calls * blas::Gbyte<scalar_t>::trsm( blas::Side::Left, nb, nb ) );
+    }
+
+    //----------
+    if (selected( "tile-gecopy" )) {
+        auto time = time_samples( MPI_COMM_SELF, no_setup, [&] {
+            for (int64_t c = 0; c < calls; ++c)
+                slate::tile::gecopy( A, C );
+        });
+        report( "tile-gecopy", type, nb, 1, calls, time,
+                0, calls * 2 * bytes * 1e-9 );
+    }
+
+    //----------
+    if (selected( "tile-tzcopy" )) {
+        A.uplo( slate::Uplo::Lower );
+        C.uplo( slate::Uplo::Lower );
+        auto time = time_samples( MPI_COMM_SELF, no_setup, [&] {
+            for (int64_t c = 0; c < calls; ++c)
+                slate::tile::tzcopy( A, C );
+        });
+        A.uplo( slate::Uplo::General );
+        C.uplo( slate::Uplo::General );
+        // Lower triangle, including the diagonal, is read and written.
+        report( "tile-tzcopy", type, nb, 1, calls, time,
+                0, calls * 2 * (bytes + nb*sizeof( scalar_t )) / 2 * 1e-9 );
+    }
+
+    //----------
+    if (selected( "tile-tzset" )) {
+        C.uplo( slate::Uplo::Lower );
+        auto time = time_samples( MPI_COMM_SELF, no_setup, [&] {
+            for (int64_t c = 0; c < calls; ++c)
+                slate::tile::tzset( one, C );
+        });
+        C.uplo( slate::Uplo::General );
+        // Strictly lower triangle is written.
+        report( "tile-tzset", type, nb, 1, calls, time,
+                0, calls * (bytes - nb*sizeof( scalar_t )) / 2 * 1e-9 );
+    }
+
+    //----------
+    if (selected( "tile-transpose" )) {
+        // In-place, square transpose.
+        auto time = time_samples( MPI_COMM_SELF, no_setup, [&] {
+            for (int64_t c = 0; c < calls; ++c)
+                slate::tile::deepTranspose( std::move( C ) );
+        });
+        report( "tile-transpose", type, nb, 1, calls, time,
+                0, calls * 2 * bytes * 1e-9 );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void bench_tile< float >( int64_t nb );
+
+template
+void bench_tile< double >( int64_t nb );
+
+template
+void bench_tile< std::complex<float> >( int64_t nb );
+
+template
+void bench_tile< std::complex<double> >( int64_t nb );
+
+}  // namespace bench
@@ -13,6 +13,7 @@
 #include "slate/Tile.hh"
 #include "slate/Tile_blas.hh"
 #include "slate/types.hh"
+#include "slate/method.hh"
 #include "slate/config.hh"
 
 #include "lapack.hh"
@@ -474,7 +475,8 @@ public:
         bool is_shared = false);
 
     template <Target target = Target::Host>
-    void listReduce(ReduceList& reduce_list, Layout layout, int tag = 0);
+    void listReduce(ReduceList& reduce_list, Layout layout, int tag = 0,
+                    Method method = MethodReduce::Binomial);
 
     //--------------------------------------------------------------------------
     // LAYOUT
@@ -543,6 +545,16 @@ protected:
                         std::vector<MPI_Request>& send_requests,
                         Target target);
 
+    template <typename list_type>
+    void listGetOnDevices(list_type& bcast_list, bool is_shared);
+
+    void tileReduceScatterFromSet(int64_t i, int64_t j, int root_rank,
+                                  std::set<int>& reduce_set, int tag,
+                                  Layout layout);
+    void tileReducePipelinedFromSet(int64_t i, int64_t j, int root_rank,
+                                    std::set<int>& reduce_set, int tag,
+                                    Layout layout);
+
 public:
     // todo: should this be private?
     void tileReduceFromSet(int64_t i, int64_t j, int root_rank,
@@ -555,6 +567,7 @@ public:
     int64_t numLocalTiles() const;
     MPI_Comm  mpiComm()  const { return mpi_comm_; }
     int       mpiRank()  const { return mpi_rank_; }
+    int       mpiSize()  const { return mpi_size_; }
     MPI_Group mpiGroup() const { return mpi_group_; }
 
     [[deprecated("use slate::HostNum constant")]]
@@ -735,6 +748,7 @@ protected:
     MPI_Comm  mpi_comm_;
     MPI_Group mpi_group_;
     int mpi_rank_;
+    int mpi_size_;
 };
 
 //------------------------------------------------------------------------------
@@ -760,7 +774,8 @@ BaseMatrix<scalar_t>::BaseMatrix()
       layout_(Layout::ColMajor),
       origin_(Target::Host),
       storage_(nullptr),
-      mpi_comm_( MPI_COMM_SELF )
+      mpi_comm_( MPI_COMM_SELF ),
+      mpi_size_( 1 )
 {}
 
 //------------------------------------------------------------------------------
@@ -840,6 +855,8 @@ BaseMatrix<scalar_t>::BaseMatrix(
 
     slate_mpi_call(
         MPI_Comm_rank(mpi_comm_, &mpi_rank_));
+    slate_mpi_call(
+        MPI_Comm_size(mpi_comm_, &mpi_size_));
     slate_mpi_call(
         MPI_Comm_group(mpi_comm_, &mpi_group_));
 
@@ -907,6 +924,8 @@ BaseMatrix<scalar_t>::BaseMatrix(
 {
     slate_mpi_call(
         MPI_Comm_rank(mpi_comm_, &mpi_rank_));
+    slate_mpi_call(
+        MPI_Comm_size(mpi_comm_, &mpi_size_));
     slate_mpi_call(
         MPI_Comm_group(mpi_comm_, &mpi_group_));
 
@@ -1267,10 +1286,7 @@ void BaseMatrix<scalar_t>::gridinfo(
         }
     }
     else {
-        int mpi_size;
-        slate_mpi_call(
-            MPI_Comm_size(mpiComm(), &mpi_size));
-        if (mpi_size == 1) {
+        if (mpi_size_ == 1) {
             *order = GridOrder::Col;
             *nprow = *npcol = 1;
             *myrow = *mycol = 0;
@@ -1952,9 +1968,13 @@ void BaseMatrix<scalar_t>::listBcast(
     // tile is increased.
     // Also, currently, the message is received to the same buffer.
 
-    std::vector< std::set<ij_tuple> > tile_set(num_devices());
-    int mpi_size;
-    MPI_Comm_size(mpiComm(), &mpi_size);
+    // With a single rank, all tiles are local, so there is nothing to send,
+    // receive, or track; only copy to devices.
+    if (mpi_size_ == 1) {
+        if (target == Target::Devices)
+            listGetOnDevices(bcast_list, is_shared);
+        return;
+    }
 
     std::vector<MPI_Request> send_requests;
 
@@ -2008,48 +2028,23 @@ void BaseMatrix<scalar_t>::listBcast(
             for (auto submatrix : submatrices_list)
                 submatrix.getLocalDevices(&dev_set);
 
-            if (mpi_size == 1) {
-                for (auto device : dev_set)
-                    tile_set[device].insert({i, j});
-            }
-            else {
-                #pragma omp taskgroup
-                for (auto device : dev_set) {
-                    // note: dev_set structure is released after the if-target block
-                    #pragma omp task slate_omp_default_none \
-                        firstprivate( i, j, device, is_shared )
-                    {
-                        if (is_shared) {
-                            tileGetAndHold(i, j, device, LayoutConvert::None);
-                        }
-                        else {
-                            tileGetForReading(i, j, device, LayoutConvert::None);
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    if (target == Target::Devices) {
-        if (mpi_size == 1) {
             #pragma omp taskgroup
-            for (int d = 0; d < num_devices(); ++d) {
-                if (! tile_set[d].empty()) {
-                    #pragma omp task slate_omp_default_none \
-                        firstprivate( d, is_shared ) shared( tile_set )
-                    {
-                        if (is_shared) {
-                            tileGetAndHold(tile_set[d], d, LayoutConvert::None);
-                        }
-                        else {
-                            tileGetForReading(tile_set[d], d, LayoutConvert::None);
-                        }
+            for (auto device : dev_set) {
+                // note: dev_set structure is released after the if-target block
+                #pragma omp task slate_omp_default_none \
+                    firstprivate( i, j, device, is_shared )
+                {
+                    if (is_shared) {
+                        tileGetAndHold(i, j, device, LayoutConvert::None);
+                    }
+                    else {
+                        tileGetForReading(i, j, device, LayoutConvert::None);
                     }
                 }
             }
         }
     }
+
     slate_mpi_call(
         MPI_Waitall(send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE));
 }
@@ -2102,8 +2097,13 @@ void BaseMatrix<scalar_t>::listBcastMT(
     // tile is increased.
     // Also, currently, the message is received to the same buffer.
 
-    int mpi_size;
-    MPI_Comm_size(mpiComm(), &mpi_size);
+    // With a single rank, all tiles are local, so there is nothing to send,
+    // receive, or track; only copy to devices.
+    if (mpi_size_ == 1) {
+        if (target == Target::Devices)
+            listGetOnDevices(bcast_list, is_shared);
+        return;
+    }
 
     // This uses multiple OMP threads for MPI broadcast communication
     // todo: threads may clash with panel-threads slowing performance
@@ -2114,7 +2114,7 @@ void BaseMatrix<scalar_t>::listBcastMT(
     #if defined( SLATE_HAVE_MT_BCAST )
         #pragma omp taskloop slate_omp_default_none \
             shared( bcast_list ) \
-            firstprivate(life_factor, layout, mpi_size, is_shared)
+            firstprivate(life_factor, layout, is_shared)
     #endif
     for (size_t bcastnum = 0; bcastnum < bcast_list.size(); ++bcastnum) {
 
@@ -2177,7 +2177,6 @@ void BaseMatrix<scalar_t>::listBcastMT(
 
                 // #pragma omp taskgroup
                 for (auto dev : dev_set) {
-                    //todo: test #pragma omp task default(none) firstprivate(i,j,dev,is_shared) if (mpi_size == 1)
                     if (is_shared)
                         tileGetAndHold(i, j, dev, LayoutConvert::None);
                     else
@@ -2189,11 +2188,85 @@ void BaseMatrix<scalar_t>::listBcastMT(
 }
 
 //------------------------------------------------------------------------------
+/// [internal]
+/// Copies the tiles in a BcastList or BcastListTag to the local devices
+/// of their destination submatrices, batching the tiles per device.
+/// Used instead of a broadcast when there is a single MPI rank.
+///
+/// @param[in] bcast_list
+///     List of tiles {i, j} and their destination submatrices.
+///
+/// @param[in] is_shared
+///     Whether to get and hold the tiles on the devices; see listBcast.
+///
+template <typename scalar_t>
+template <typename list_type>
+void BaseMatrix<scalar_t>::listGetOnDevices(
+    list_type& bcast_list, bool is_shared)
+{
+    std::vector< std::set<ij_tuple> > tile_set(num_devices());
+
+    for (auto& bcast : bcast_list) {
+        auto i = std::get<0>(bcast);
+        auto j = std::get<1>(bcast);
+        auto& submatrices_list = std::get<2>(bcast);
+
+        std::set<int> dev_set;
+        for (auto& submatrix : submatrices_list)
+            submatrix.getLocalDevices(&dev_set);
+
+        for (auto device : dev_set)
+            tile_set[device].insert({i, j});
+    }
+
+    #pragma omp taskgroup
+    for (int d = 0; d < num_devices(); ++d) {
+        if (! tile_set[d].empty()) {
+            #pragma omp task slate_omp_default_none \
+                firstprivate( d, is_shared ) shared( tile_set )
+            {
+                if (is_shared) {
+                    tileGetAndHold(tile_set[d], d, LayoutConvert::None);
+                }
+                else {
+                    tileGetForReading(tile_set[d], d, LayoutConvert::None);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Reduces (sums) tiles across the ranks holding them, to the rank owning
+/// the destination tile.
+///
+/// @param[in] reduce_list
+///     List of (i, j, destination, sources): tile (i, j) is summed over the
+///     ranks of the source submatrices, into the rank owning destination.
+///
+/// @param[in] layout
+///     Indicates the Layout (ColMajor/RowMajor) of the reduced data.
+///
+/// @param[in] tag
+///     MPI tag, default 0.
+///
+/// @param[in] method
+///     Reduction algorithm, default Binomial:
+///     - MethodReduce::Binomial:      binomial tree of full tiles;
+///     - MethodReduce::ReduceScatter: ring reduce-scatter of one segment
+///                                    per rank, then gather to the root;
+///     - MethodReduce::Pipelined:     chain of ranks passing segments;
+///     - MethodReduce::Auto:          choose by rank count and tile size.
 ///
 template <typename scalar_t>
 template <Target target>
-void BaseMatrix<scalar_t>::listReduce(ReduceList& reduce_list, Layout layout, int tag)
+void BaseMatrix<scalar_t>::listReduce(
+    ReduceList& reduce_list, Layout layout, int tag, Method method)
 {
+    // With a single rank, the sources and destination are the same tile.
+    if (mpi_size_ == 1)
+        return;
+
     for (auto reduce : reduce_list) {
 
         auto i = std::get<0>(reduce);
@@ -2211,9 +2284,28 @@ void BaseMatrix<scalar_t>::listReduce(ReduceList& reduce_list, Layout layout, in
         if (root_rank == mpi_rank_
             || reduce_set.find(mpi_rank_) != reduce_set.end()) {
 
+            // All ranks in the set choose the same method.
+            reduce_set.insert(root_rank);
+            Method method_ij = method;
+            if (method_ij == MethodReduce::Auto) {
+                method_ij = MethodReduce::select_algo(
+                    reduce_set.size(),
+                    tileMb(i) * tileNb(j) * sizeof(scalar_t) );
+            }
+
             // Reduce across MPI ranks.
-            // Uses 2D hypercube p2p send.
-            tileReduceFromSet(i, j, root_rank, reduce_set, 2, tag, layout);
+            if (method_ij == MethodReduce::ReduceScatter) {
+                tileReduceScatterFromSet(
+                    i, j, root_rank, reduce_set, tag, layout);
+            }
+            else if (method_ij == MethodReduce::Pipelined) {
+                tileReducePipelinedFromSet(
+                    i, j, root_rank, reduce_set, tag, layout);
+            }
+            else {
+                // Uses 2D hypercube p2p send.
+                tileReduceFromSet(i, j, root_rank, reduce_set, 2, tag, layout);
+            }
 
             // If not the tile owner.
             if (! tileIsLocal(i, j)) {
@@ -2458,18 +2550,9 @@ void BaseMatrix<scalar_t>::tileReduceFromSet(
 
     reduce_set.insert(root_rank);
 
-    // Convert the set to a vector.
-    std::vector<int> reduce_vec(reduce_set.begin(), reduce_set.end());
-
-    // Sort the ranks.
-    std::sort(reduce_vec.begin(), reduce_vec.end());
-
-    // Find root.
-    auto root_iter = std::find(reduce_vec.begin(), reduce_vec.end(), root_rank);
-
-    // Shift root to position zero.
-    std::vector<int> new_vec(root_iter, reduce_vec.end());
-    new_vec.insert(new_vec.end(), reduce_vec.begin(), root_iter);
+    // Sorted ranks, with root shifted to position zero.
+    std::vector<int> new_vec
+        = storage_->reduceGroup(reduce_set, root_rank);
 
     // Find the new rank.
     auto rank_iter = std::find(new_vec.begin(), new_vec.end(), mpi_rank_);
@@ -2506,6 +2589,229 @@ void BaseMatrix<scalar_t>::tileReduceFromSet(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Returns the physical shape of tile A, in its storage layout, as the
+/// length of its contiguous vectors (inner) and their number (outer).
+/// Segments of the segmented reductions are ranges of these vectors.
+///
+namespace internal {
+
+template <typename scalar_t>
+void tileVectors(Tile<scalar_t> const& A, int64_t& inner, int64_t& outer)
+{
+    int64_t rows = (A.op() == Op::NoTrans ? A.mb() : A.nb());
+    int64_t cols = (A.op() == Op::NoTrans ? A.nb() : A.mb());
+    inner = (A.layout() == Layout::ColMajor ? rows : cols);
+    outer = (A.layout() == Layout::ColMajor ? cols : rows);
+}
+
+} // namespace internal
+
+//------------------------------------------------------------------------------
+/// Reduces tile(i, j) across the ranks in reduce_set to root_rank,
+/// using a ring reduce-scatter followed by a gather.
+/// The tile is split into one segment per rank. In each of the p - 1 ring
+/// steps, every rank sends one segment to its successor and accumulates
+/// one from its predecessor, so each rank ends up owning one fully reduced
+/// segment, which it sends to the root.
+/// Each rank sends about 2 tiles of data in total, independent of p,
+/// versus log2( p ) full tiles along the binomial tree,
+/// which suits long process rows and large tiles.
+///
+/// All ranks in reduce_set must hold tile(i, j). On ranks other than the
+/// root, the tile is left with partial sums.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileReduceScatterFromSet(
+    int64_t i, int64_t j, int root_rank, std::set<int>& reduce_set,
+    int tag, Layout layout)
+{
+    const scalar_t one = 1.0;
+
+    // Quit if the reduction set is empty
+    if (reduce_set.empty())
+        return;
+
+    reduce_set.insert(root_rank);
+
+    // Sorted ranks, with root shifted to position zero.
+    std::vector<int> group
+        = storage_->reduceGroup(reduce_set, root_rank);
+    int size = group.size();
+    if (size < 2)
+        return;
+
+    int index = std::distance(
+        group.begin(), std::find(group.begin(), group.end(), mpi_rank_));
+    int next = group[ (index + 1) % size ];
+    int prev = group[ (index + size - 1) % size ];
+
+    tileGetForWriting(i, j, LayoutConvert(layout));
+    auto Aij = at(i, j);
+    scalar_t* data = Aij.data();
+    int64_t stride = Aij.stride();
+    int64_t inner, outer;
+    internal::tileVectors(Aij, inner, outer);
+
+    // Segment s covers vectors [ offset( s ), offset( s+1 ) ).
+    auto offset = [outer, size](int s) {
+        return outer * s / size;
+    };
+    int64_t max_count = inner * ceildiv(outer, int64_t(size));
+    std::vector<scalar_t> send_buf(max_count);
+    std::vector<scalar_t> recv_buf(max_count);
+
+    trace::Block trace_block("MPI_Reduce_scatter");
+
+    // Reduce-scatter around the ring.
+    for (int step = 0; step < size - 1; ++step) {
+        int send_seg = (index - step + size) % size;
+        int recv_seg = (index - step - 1 + 2*size) % size;
+        int64_t send_cols = offset(send_seg + 1) - offset(send_seg);
+        int64_t recv_cols = offset(recv_seg + 1) - offset(recv_seg);
+
+        lapack::lacpy(lapack::MatrixType::General, inner, send_cols,
+                      &data[ offset(send_seg)*stride ], stride,
+                      send_buf.data(), inner);
+        slate_mpi_call(
+            MPI_Sendrecv(send_buf.data(), inner*send_cols,
+                         mpi_type<scalar_t>::value, next, tag,
+                         recv_buf.data(), inner*recv_cols,
+                         mpi_type<scalar_t>::value, prev, tag,
+                         mpi_comm_, MPI_STATUS_IGNORE));
+
+        for (int64_t c = 0; c < recv_cols; ++c) {
+            blas::axpy(inner, one, &recv_buf[ c*inner ], 1,
+                       &data[ (offset(recv_seg) + c)*stride ], 1);
+        }
+    }
+
+    // Rank at index now owns the reduced segment (index + 1) % size.
+    // Gather the segments to the root.
+    if (index == 0) {
+        for (int src = 1; src < size; ++src) {
+            int seg = (src + 1) % size;
+            int64_t cols = offset(seg + 1) - offset(seg);
+            slate_mpi_call(
+                MPI_Recv(recv_buf.data(), inner*cols,
+                         mpi_type<scalar_t>::value, group[ src ], tag,
+                         mpi_comm_, MPI_STATUS_IGNORE));
+            lapack::lacpy(lapack::MatrixType::General, inner, cols,
+                          recv_buf.data(), inner,
+                          &data[ offset(seg)*stride ], stride);
+        }
+    }
+    else {
+        int seg = (index + 1) % size;
+        int64_t cols = offset(seg + 1) - offset(seg);
+        lapack::lacpy(lapack::MatrixType::General, inner, cols,
+                      &data[ offset(seg)*stride ], stride,
+                      send_buf.data(), inner);
+        slate_mpi_call(
+            MPI_Send(send_buf.data(), inner*cols,
+                     mpi_type<scalar_t>::value, group[ 0 ], tag,
+                     mpi_comm_));
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Reduces tile(i, j) across the ranks in reduce_set to root_rank,
+/// using a pipelined chain.
+/// The ranks form a chain ending at the root, and the tile is split into
+/// segments of about MethodReduce::segment_bytes. Each rank receives a
+/// segment from its successor, accumulates it, and forwards it to its
+/// predecessor while the next segment arrives, so the chain stays busy
+/// and each rank sends only one tile of data.
+///
+/// All ranks in reduce_set must hold tile(i, j). On ranks other than the
+/// root, the tile is left with partial sums.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileReducePipelinedFromSet(
+    int64_t i, int64_t j, int root_rank, std::set<int>& reduce_set,
+    int tag, Layout layout)
+{
+    const scalar_t one = 1.0;
+
+    // Quit if the reduction set is empty
+    if (reduce_set.empty())
+        return;
+
+    reduce_set.insert(root_rank);
+
+    // Sorted ranks, with root shifted to position zero.
+    std::vector<int> group
+        = storage_->reduceGroup(reduce_set, root_rank);
+    int size = group.size();
+    if (size < 2)
+        return;
+
+    int index = std::distance(
+        group.begin(), std::find(group.begin(), group.end(), mpi_rank_));
+
+    tileGetForWriting(i, j, LayoutConvert(layout));
+    auto Aij = at(i, j);
+    scalar_t* data = Aij.data();
+    int64_t stride = Aij.stride();
+    int64_t inner, outer;
+    internal::tileVectors(Aij, inner, outer);
+
+    int64_t num_segments = ceildiv(
+        int64_t(inner * outer * sizeof(scalar_t)), MethodReduce::segment_bytes);
+    num_segments = std::max(int64_t(1), std::min(num_segments, outer));
+
+    // Segment s covers vectors [ offset( s ), offset( s+1 ) ).
+    auto offset = [outer, num_segments](int64_t s) {
+        return outer * s / num_segments;
+    };
+    std::vector<scalar_t> recv_buf;
+    if (index < size - 1)
+        recv_buf.resize(inner * ceildiv(outer, num_segments));
+
+    // Sends are in flight while the next segment is received,
+    // so each needs its own part of the send buffer.
+    std::vector<scalar_t> send_buf;
+    std::vector<MPI_Request> requests;
+    if (index > 0) {
+        send_buf.resize(inner * outer);
+        requests.reserve(num_segments);
+    }
+
+    trace::Block trace_block("MPI_Reduce_pipelined");
+
+    for (int64_t s = 0; s < num_segments; ++s) {
+        int64_t cols = offset(s + 1) - offset(s);
+
+        // Receive and accumulate, unless at the end of the chain.
+        if (index < size - 1) {
+            slate_mpi_call(
+                MPI_Recv(recv_buf.data(), inner*cols,
+                         mpi_type<scalar_t>::value, group[ index+1 ], tag,
+                         mpi_comm_, MPI_STATUS_IGNORE));
+            for (int64_t c = 0; c < cols; ++c) {
+                blas::axpy(inner, one, &recv_buf[ c*inner ], 1,
+                           &data[ (offset(s) + c)*stride ], 1);
+            }
+        }
+
+        // Forward, unless root.
+        if (index > 0) {
+            scalar_t* segment = &send_buf[ offset(s)*inner ];
+            lapack::lacpy(lapack::MatrixType::General, inner, cols,
+                          &data[ offset(s)*stride ], stride,
+                          segment, inner);
+            requests.emplace_back();
+            slate_mpi_call(
+                MPI_Isend(segment, inner*cols,
+                          mpi_type<scalar_t>::value, group[ index-1 ], tag,
+                          mpi_comm_, &requests.back()));
+        }
+    }
+
+    slate_mpi_call(
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE));
+}
+
 //------------------------------------------------------------------------------
 /// [internal]
 /// Copies data from src_tile into dst_tile and converts into target_layout
@@ -7,12 +7,14 @@
 #define SLATE_TILE_BLAS_HH
 
 #include <blas.hh>
+#include <blas/flops.hh>
 
 #include "slate/Tile.hh"
 #include "slate/internal/util.hh"
 #include "slate/internal/device.hh"
 
 #include <list>
+#include <vector>
 
 namespace slate {
 
@@ -33,6 +35,7 @@ void gemm(
     scalar_t beta,  Tile<scalar_t>& C)
 {
     trace::Block trace_block("blas::gemm");
+    trace_block.flops( blas::Gflop<scalar_t>::gemm( C.mb(), C.nb(), A.nb() ) );
 
     using blas::conj;
 
@@ -108,6 +111,149 @@ void gemm(
     gemm(alpha, A, B, beta, C);
 }
 
+//------------------------------------------------------------------------------
+/// Splits tile A, as stored, into real part Ar and imaginary part Ai,
+/// stored contiguously with leading dimension the length of A's columns,
+/// or of its rows if A is row major. If A is conjugate-transposed,
+/// negates Ai, so op(A) = op(Ar) + i op(Ai) with op Trans.
+/// @return the leading dimension of Ar and Ai.
+/// @ingroup gemm_tile
+///
+template <typename scalar_t>
+int64_t gemm3m_split(
+    Tile<scalar_t> const& A,
+    blas::real_type<scalar_t>* Ar, blas::real_type<scalar_t>* Ai )
+{
+    // Dimensions of A as stored, along and across its leading dimension.
+    bool inner_is_mb = (A.op() == Op::NoTrans) == (A.layout() == Layout::ColMajor);
+    int64_t inner = inner_is_mb ? A.mb() : A.nb();
+    int64_t outer = inner_is_mb ? A.nb() : A.mb();
+    int64_t lda = A.stride();
+    scalar_t const* Adata = A.data();
+    bool conj = A.op() == Op::ConjTrans;
+    for (int64_t j = 0; j < outer; ++j) {
+        for (int64_t i = 0; i < inner; ++i) {
+            scalar_t a = Adata[ i + j*lda ];
+            Ar[ i + j*inner ] = std::real( a );
+            Ai[ i + j*inner ] = conj ? -std::imag( a ) : std::imag( a );
+        }
+    }
+    return inner;
+}
+
+//------------------------------------------------------------------------------
+/// General matrix multiply using the 3M algorithm:
+/// $C = \alpha op(A) op(B) + \beta C$.
+/// Splits A and B into real and imaginary parts, then does
+/// 3 real gemms instead of the 4 in complex gemm:
+///
+///     T1 = Ar Br,  T2 = Ai Bi,  T3 = (Ar + Ai) (Br + Bi),
+///     real( op(A) op(B) ) = T1 - T2,
+///     imag( op(A) op(B) ) = T3 - T1 - T2.
+///
+/// This saves 25% of the flops, at the cost of O(mk + kn + mn) workspace
+/// and a larger error in the imaginary part, though it is still normwise
+/// stable; see Higham, 2002, sec. 23.2.4.
+/// The workspace is one buffer per thread, kept between calls.
+/// For real types, or if op(C) is not NoTrans, calls gemm.
+/// @ingroup gemm_tile
+///
+template <typename scalar_t>
+void gemm3m(
+    scalar_t alpha, Tile<scalar_t> const& A,
+                    Tile<scalar_t> const& B,
+    scalar_t beta,  Tile<scalar_t>& C)
+{
+    if constexpr (! is_complex<scalar_t>::value) {
+        gemm( alpha, A, B, beta, C );
+    }
+    else {
+        if (C.op() != Op::NoTrans) {
+            gemm( alpha, A, B, beta, C );
+            return;
+        }
+
+        using real_t = blas::real_type<scalar_t>;
+        const real_t r_one = 1.0, r_zero = 0.0;
+
+        int64_t m = C.mb();
+        int64_t n = C.nb();
+        int64_t k = A.nb();
+
+        trace::Block trace_block("blas::gemm3m");
+        trace_block.flops( 3 * blas::Gflop<real_t>::gemm( m, n, k ) );
+
+        slate_assert(A.uploPhysical() == Uplo::General);
+        slate_assert(B.uploPhysical() == Uplo::General);
+        slate_assert(C.uploPhysical() == Uplo::General);
+        slate_assert(C.mb() == A.mb());  // m
+        slate_assert(C.nb() == B.nb());  // n
+        slate_assert(A.nb() == B.mb());  // k
+        slate_assert(A.layout() == C.layout());
+        slate_assert(B.layout() == C.layout());
+
+        static thread_local std::vector<real_t> work;
+        work.resize( 2*m*k + 2*k*n + 3*m*n );
+        real_t* Ar = work.data();
+        real_t* Ai = Ar + m*k;
+        real_t* Br = Ai + m*k;
+        real_t* Bi = Br + k*n;
+        real_t* T1 = Bi + k*n;
+        real_t* T2 = T1 + m*n;
+        real_t* T3 = T2 + m*n;
+
+        // A and B keep their layout and op; Ai and Bi hold the
+        // conjugation, so the real gemms use Trans for both.
+        int64_t lda = gemm3m_split( A, Ar, Ai );
+        int64_t ldb = gemm3m_split( B, Br, Bi );
+        Op opA = (A.op() == Op::NoTrans ? Op::NoTrans : Op::Trans);
+        Op opB = (B.op() == Op::NoTrans ? Op::NoTrans : Op::Trans);
+        Layout layout = C.layout();
+        int64_t ldt = (layout == Layout::ColMajor ? m : n);
+
+        blas::gemm( layout, opA, opB, m, n, k,
+                    r_one, Ar, lda, Br, ldb, r_zero, T1, ldt );
+        blas::gemm( layout, opA, opB, m, n, k,
+                    r_one, Ai, lda, Bi, ldb, r_zero, T2, ldt );
+        // Ar += Ai, Br += Bi.
+        blas::axpy( m*k, r_one, Ai, 1, Ar, 1 );
+        blas::axpy( k*n, r_one, Bi, 1, Br, 1 );
+        blas::gemm( layout, opA, opB, m, n, k,
+                    r_one, Ar, lda, Br, ldb, r_zero, T3, ldt );
+
+        // C = alpha (T1 - T2 + i (T3 - T1 - T2)) + beta C,
+        // with T stored like C.
+        int64_t inner = ldt;
+        int64_t outer = (layout == Layout::ColMajor ? n : m);
+        int64_t ldc = C.stride();
+        scalar_t* Cdata = C.data();
+        for (int64_t j = 0; j < outer; ++j) {
+            for (int64_t i = 0; i < inner; ++i) {
+                int64_t ij = i + j*inner;
+                scalar_t ab( T1[ ij ] - T2[ ij ], T3[ ij ] - T1[ ij ] - T2[ ij ] );
+                scalar_t& c = Cdata[ i + j*ldc ];
+                if (beta == scalar_t( 0.0 ))
+                    c = alpha * ab;
+                else
+                    c = alpha * ab + beta * c;
+            }
+        }
+    }
+}
+
+//-----------------------------------------
+/// Converts rvalue refs to lvalue refs.
+/// @ingroup gemm_tile
+///
+template <typename scalar_t>
+void gemm3m(
+    scalar_t alpha, Tile<scalar_t> const&& A,
+                    Tile<scalar_t> const&& B,
+    scalar_t beta,  Tile<scalar_t>&& C)
+{
+    gemm3m(alpha, A, B, beta, C);
+}
+
 //------------------------------------------------------------------------------
 ///
 /// @ingroup gemv_tile
@@ -212,6 +358,7 @@ void hemm(
     scalar_t beta,  Tile<scalar_t>& C)
 {
     trace::Block trace_block("blas::hemm");
+    trace_block.flops( blas::Gflop<scalar_t>::hemm( side, C.mb(), C.nb() ) );
 
     using blas::conj;
 
@@ -275,6 +422,7 @@ void herk(
     blas::real_type<scalar_t> beta,  Tile<scalar_t>& C)
 {
     trace::Block trace_block("blas::herk");
+    trace_block.flops( blas::Gflop<scalar_t>::herk( C.nb(), A.nb() ) );
 
     assert(A.uploPhysical() == Uplo::General);
     assert(C.mb() == C.nb());  // square
@@ -316,6 +464,7 @@ void her2k(
     blas::real_type<scalar_t> beta, Tile<scalar_t>& C)
 {
     trace::Block trace_block("blas::her2k");
+    trace_block.flops( blas::Gflop<scalar_t>::her2k( C.nb(), A.nb() ) );
 
     using blas::conj;
 
@@ -396,6 +545,7 @@ void symm(
     scalar_t beta,  Tile<scalar_t>& C)
 {
     trace::Block trace_block("blas::symm");
+    trace_block.flops( blas::Gflop<scalar_t>::symm( side, C.mb(), C.nb() ) );
 
     using blas::conj;
 
@@ -525,6 +675,7 @@ void syrk(
     scalar_t beta,  Tile<scalar_t>& C)
 {
     trace::Block trace_block("blas::syrk");
+    trace_block.flops( blas::Gflop<scalar_t>::syrk( C.nb(), A.nb() ) );
 
     using blas::conj;
 
@@ -568,6 +719,7 @@ void syr2k(
     scalar_t beta,  Tile<scalar_t>& C)
 {
     trace::Block trace_block("blas::syr2k");
+    trace_block.flops( blas::Gflop<scalar_t>::syr2k( C.nb(), A.nb() ) );
 
     using blas::conj;
 
@@ -615,6 +767,7 @@ void trmm(
                     Tile<scalar_t>& B)
 {
     trace::Block trace_block("blas::trmm");
+    trace_block.flops( blas::Gflop<scalar_t>::trmm( side, B.mb(), B.nb() ) );
 
     using blas::conj;
 
@@ -685,6 +838,7 @@ void trsm(
                     Tile<scalar_t>& B)
 {
     trace::Block trace_block("blas::trsm");
+    trace_block.flops( blas::Gflop<scalar_t>::trsm( side, B.mb(), B.nb() ) );
 
     using blas::conj;
 
@@ -60,12 +60,19 @@ typedef enum slate_Option {
     slate_Option_PrintWidth,          ///< slate::Option::PrintWidth
     slate_Option_PrintPrecision,      ///< slate::Option::PrintPrecision
     slate_Option_PivotThreshold,      ///< slate::Option::PivotThreshold
+    slate_Option_PanelAggregation,    ///< slate::Option::PanelAggregation
+    slate_Option_TileAffinity,        ///< slate::Option::TileAffinity
+    slate_Option_Replication,         ///< slate::Option::Replication
+    slate_Option_CompactBand,         ///< slate::Option::CompactBand
+    slate_Option_Gemm3M,              ///< slate::Option::Gemm3M
+    slate_Option_GemmPacked,          ///< slate::Option::GemmPacked
     slate_Option_MethodCholQR,        ///< slate::Option::MethodCholQR
     slate_Option_MethodEig,           ///< slate::Option::MethodEig
     slate_Option_MethodGels,          ///< slate::Option::MethodGels
     slate_Option_MethodGemm,          ///< slate::Option::MethodGemm
     slate_Option_MethodHemm,          ///< slate::Option::MethodHemm
     slate_Option_MethodLU,            ///< slate::Option::MethodLU
+    slate_Option_MethodReduce,        ///< slate::Option::MethodReduce
     slate_Option_MethodTrsm,          ///< slate::Option::MethodTrsm
 } slate_Option;                       ///< slate::Option
 
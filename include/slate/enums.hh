@@ -89,6 +89,12 @@ enum class Option : char {
     PrintPrecision,     ///< precision print format specifier
                         ///< For correct printing, PrintWidth = PrintPrecision + 6.
     PivotThreshold,     ///< threshold for pivoting, >= 0, <= 1
+    PanelAggregation,   ///< number of Householder panels to merge, >= 1
+    TileAffinity,       ///< run tile updates on the NUMA node holding the tile
+    Replication,        ///< number of matrix copies (layers) in 2.5D algorithms, >= 1
+    CompactBand,        ///< single-rank narrow bands via LAPACK band kernels, 0 or 1
+    Gemm3M,             ///< experimental: 3M algorithm (3 real gemms) in complex gemm, 0 or 1
+    GemmPacked,         ///< pack reused tiles once with MKL packed gemm, 0 or 1
 
     // Methods, listed alphabetically.
     MethodCholQR,       ///< Select the algorithm to compute A^H * A
@@ -97,6 +103,7 @@ enum class Option : char {
     MethodGemm,         ///< Select the gemm algorithm
     MethodHemm,         ///< Select the hemm algorithm
     MethodLU,           ///< Select the LU (getrf) algorithm
+    MethodReduce,       ///< Select the algorithm to reduce tiles across ranks
     MethodTrsm,         ///< Select the trsm algorithm
 };
 
@@ -0,0 +1,86 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_COST_MODEL_HH
+#define SLATE_COST_MODEL_HH
+
+#include <cstdint>
+#include <string>
+
+#include "slate/enums.hh"
+#include "slate/internal/mpi.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Machine parameters used by CostModel.
+///
+struct MachineParams {
+    double gflops    = 20;     ///< gemm rate of one rank, in Gflop/s
+    double latency   = 2e-6;   ///< network latency, in seconds
+    double bandwidth = 10e9;   ///< network bandwidth, in bytes/s
+};
+
+//------------------------------------------------------------------------------
+/// Simple performance model that predicts the runtime of the variants of
+/// gemm, hemm, trsm, and the A^H A product in cholqr on a p-by-q grid
+/// with nb-by-nb tiles, as
+///
+///     time = flops / (p q gflops) + messages * latency + bytes / bandwidth,
+///
+/// where messages and bytes are counted along the critical path of one rank.
+/// The select_algo functions in method.hh use it when the method is Auto,
+/// but only once it is enabled; otherwise they use fixed heuristics.
+///
+/// The model is enabled by calibrate(), which is collective: rank 0 reads
+/// the cache file, see cacheFile(), or else measures the parameters with a
+/// short micro-benchmark and writes the cache file, then broadcasts them,
+/// so all ranks select the same method. Alternatively, the application
+/// can set the parameters, the same on all ranks, with machine( params ).
+///
+class CostModel {
+public:
+    static MachineParams const& machine();
+    static void machine( MachineParams const& params );
+    static bool enabled();
+    static void disable();
+
+    static void calibrate( MPI_Comm comm );
+
+    static std::string cacheFile();
+
+    static double gemmA( int64_t m, int64_t n, int64_t k,
+                         int p, int q, int64_t nb, int elem_size );
+    static double gemmC( int64_t m, int64_t n, int64_t k,
+                         int p, int q, int64_t nb, int elem_size );
+    static double herkC( int64_t n, int64_t k,
+                         int p, int q, int64_t nb, int elem_size );
+    static double trsmA( int64_t m, int64_t n,
+                         int p, int q, int64_t nb, int elem_size );
+    static double trsmB( int64_t m, int64_t n,
+                         int p, int q, int64_t nb, int elem_size );
+
+    //--------------------------------------------------------------------------
+    /// Gets the p-by-q process grid of matrix A.
+    /// @return false if A's distribution isn't a 2D block cyclic grid,
+    ///         in which case the model doesn't apply.
+    ///
+    template <typename matrix_type>
+    static bool grid( matrix_type const& A, int* p, int* q )
+    {
+        GridOrder order;
+        int myrow, mycol;
+        A.gridinfo( &order, p, q, &myrow, &mycol );
+        return order != GridOrder::Unknown;
+    }
+
+private:
+    static bool enabled_;
+    static MachineParams machine_;
+};
+
+} // namespace slate
+
+#endif // SLATE_COST_MODEL_HH
@@ -503,6 +503,27 @@ public:
         tiles_.at( ij )->receiveCount()--;
     }
 
+    //--------------------------------------------------------------------------
+    /// @return ranks of reduce_set, ordered with root_rank first, as used
+    /// by tile reductions. The ordering is cached per rank set and root,
+    /// since each row or column of tiles reduces over the same ranks.
+    /// Returned by value, so the cache can be cleared while a reduction
+    /// is in progress; it is cleared with the workspace.
+    std::vector<int> reduceGroup(
+        std::set<int> const& reduce_set, int root_rank)
+    {
+        LockGuard guard( getTilesMapLock() );
+        auto& group = reduce_groups_[ { reduce_set, root_rank } ];
+        if (group.empty()) {
+            // The set is sorted; rotate the root to position zero.
+            std::vector<int> sorted( reduce_set.begin(), reduce_set.end() );
+            auto root_iter = std::find( sorted.begin(), sorted.end(), root_rank );
+            group.assign( root_iter, sorted.end() );
+            group.insert( group.end(), sorted.begin(), root_iter );
+        }
+        return group;
+    }
+
 private:
     TilesMap tiles_;        ///< map of tiles and associated states
     mutable omp_nest_lock_t lock_;  ///< TilesMap lock
@@ -511,6 +532,9 @@ private:
     std::map< int, std::stack<void*> > allocated_mem_;
     bool own;
 
+    /// cached rank orderings of reductions, keyed by rank set and root
+    std::map< std::pair< std::set<int>, int >, std::vector<int> > reduce_groups_;
+
     int mpi_rank_;
     static int num_devices_;
 
@@ -866,6 +890,7 @@ template <typename scalar_t>
 void MatrixStorage<scalar_t>::clearWorkspace()
 {
     LockGuard guard(getTilesMapLock());
+    reduce_groups_.clear();
     for (auto iter = begin(); iter != end(); /* incremented below */) {
         auto& tile_node = *(iter->second);
         for (int d = HostNum; d < num_devices_; ++d) {
@@ -907,6 +932,7 @@ template <typename scalar_t>
 void MatrixStorage<scalar_t>::releaseWorkspace()
 {
     LockGuard guard(getTilesMapLock());
+    reduce_groups_.clear();
     for (auto iter = begin(); iter != end(); /* incremented below */) {
         // Since we can't increment the iterator after deleting the element
         // and release deletes empty nodes, use post-fix iter++ to
@@ -6,6 +6,7 @@
 #ifndef SLATE_MEMORY_HH
 #define SLATE_MEMORY_HH
 
+#include <atomic>
 #include <cstdlib>
 #include <cassert>
 #include <cstring>
@@ -71,11 +72,30 @@ public:
         return capacity(device) - available(device);
     }
 
+    /// @return bytes of tile memory currently in use, summed over all
+    /// Memory objects, on host and devices.
+    static int64_t inUse()
+    {
+        return in_use_;
+    }
+
+    /// @return high-water mark of inUse() since the last resetPeakUse().
+    /// Used by testers to report the peak workspace of a routine.
+    static int64_t peakUse()
+    {
+        return peak_use_;
+    }
+
+    static void resetPeakUse();
+
     // ----------------------------------------
     // public static variables
     static int num_devices_;
 
 private:
+    static std::atomic<int64_t> in_use_;
+    static std::atomic<int64_t> peak_use_;
+
     void* allocBlock(int device, blas::Queue *queue);
 
     void* allocHostMemory(size_t size);
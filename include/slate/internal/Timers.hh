@@ -0,0 +1,102 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_TIMERS_HH
+#define SLATE_TIMERS_HH
+
+#include <cstdio>
+#include <map>
+#include <string>
+
+#include "slate/internal/mpi.hh"
+#include "slate/internal/openmp.hh"
+
+namespace slate {
+namespace timers {
+
+//------------------------------------------------------------------------------
+/// Time, flops, and bytes of one phase of a driver, as seen by one rank.
+/// Time is this rank's wall time; gflop and gbyte are the (estimated)
+/// totals for the phase over all ranks, or zero if not estimated.
+/// If a phase runs several times, e.g., in repeated calls, these accumulate.
+///
+struct PhaseStats {
+    double time  = 0;   ///< wall time, in seconds
+    double gflop = 0;   ///< floating point operations, in Gflop
+    double gbyte = 0;   ///< data moved between ranks, in GB
+    int64_t count = 0;  ///< number of times the phase ran
+};
+
+//------------------------------------------------------------------------------
+/// Min, average, and max of PhaseStats across ranks.
+///
+struct PhaseSummary {
+    PhaseStats min, avg, max;
+};
+
+//------------------------------------------------------------------------------
+/// Registry of per-phase timings, recorded by composite drivers such as
+/// heev, svd, gesv_mixed, and gels when timing is on.
+/// Phases are named "driver::phase", e.g., "heev::he2hb".
+/// Like Trace, this is off by default:
+///
+///     slate::timers::Timers::on();
+///     slate::heev( A, Lambda, Z );
+///     slate::timers::Timers::print( MPI_COMM_WORLD );
+///
+class Timers {
+public:
+    static void on()  { timing_ = true; }
+    static void off() { timing_ = false; }
+    static bool is_on() { return timing_; }
+
+    static void clear();
+    static void insert( std::string const& name, double time,
+                        double gflop, double gbyte );
+
+    /// Returns phases recorded on this rank.
+    static std::map<std::string, PhaseStats> const& phases() { return phases_; }
+
+    static std::map<std::string, PhaseSummary> reduce( MPI_Comm comm );
+    static void print( MPI_Comm comm, FILE* file = stdout );
+
+private:
+    static bool timing_;
+    static std::map<std::string, PhaseStats> phases_;
+};
+
+//------------------------------------------------------------------------------
+/// Times a phase from construction to stop(), or to destruction if stop()
+/// isn't called. Does nothing if timing is off.
+///
+class Phase {
+public:
+    Phase( const char* name )
+        : name_( name ),
+          start_( Timers::is_on() ? omp_get_wtime() : 0 ),
+          stopped_( ! Timers::is_on() )
+    {}
+
+    ~Phase() { stop(); }
+
+    /// Stops the timer, recording gflop and gbyte for the phase.
+    void stop( double gflop = 0, double gbyte = 0 )
+    {
+        if (! stopped_) {
+            Timers::insert( name_, omp_get_wtime() - start_, gflop, gbyte );
+            stopped_ = true;
+        }
+    }
+
+private:
+    const char* name_;
+    double start_;
+    bool stopped_;
+};
+
+} // namespace timers
+} // namespace slate
+
+#endif // SLATE_TIMERS_HH
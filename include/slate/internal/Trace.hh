@@ -19,11 +19,16 @@
 namespace slate {
 namespace trace {
 
+/// Number of hardware counters sampled per block: cycles, instructions,
+/// cache references, cache misses. See Trace::counters().
+const int num_counters = 4;
+
 //------------------------------------------------------------------------------
 ///
 class Event {
 public:
     friend class Trace;
+    friend class Block;
 
     Event()
     {}
@@ -46,6 +51,11 @@ private:
     double stop_;
     int64_t index_;
     int nest_;
+
+    // Hardware counters, if sampled for this block.
+    bool has_counts_ = false;
+    double gflop_ = 0;
+    int64_t counts_[ num_counters ] = {};
 };
 //------------------------------------------------------------------------------
 ///
@@ -60,6 +70,13 @@ public:
     static void finish();
     static void comment(std::string const& str);
 
+    // Block names to sample hardware counters for; empty disables counters.
+    static std::set<std::string> const& counters() { return counter_names_; }
+    static void counters(std::set<std::string> const& names)
+    {
+        counter_names_ = names;
+    }
+
     // Vertical scale: pixel height of each thread.
     static double thread_height() { return vscale_; }
     static void   thread_height(double s) { vscale_ = s; }
@@ -75,6 +92,11 @@ private:
     static void printTicks(double timespan, FILE* trace_file);
     static void printLegend(FILE* trace_file);
     static void printComment(FILE* trace_file);
+    static void addCounterStats();
+    static void printCounterStats(FILE* trace_file);
+    static void addAnalysis(int mpi_rank);
+    static void printAnalysis(FILE* trace_file);
+    static bool readCounters(int64_t* counts);
     static void sendProcEvents();
     static void recvProcEvents(int rank);
 
@@ -96,6 +118,8 @@ private:
     static int num_threads_;
 
     static std::vector<std::vector<Event>> events_;
+
+    static std::set<std::string> counter_names_;
 };
 
 //------------------------------------------------------------------------------
@@ -105,6 +129,9 @@ public:
     Block( const char* name, int64_t index=0 );
     ~Block();
 
+    /// Sets flops done in the block, for counter statistics.
+    void flops( double gflop ) { event_.gflop_ = gflop; }
+
 private:
     Event event_;
 };
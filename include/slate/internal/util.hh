@@ -15,6 +15,7 @@
 
 #include <blas.hh>
 #include <atomic>
+#include <thread>
 
 namespace slate {
 
@@ -143,11 +144,21 @@ public:
         __sync_fetch_and_add(&count_, 1);
         if (__sync_bool_compare_and_swap(&count_, size, 0))
             ++passed_;
-        else
-            while (passed_ == passed_old) {}
+        else {
+            // Spin, then yield, in case threads outnumber cores.
+            int spin = 0;
+            while (passed_ == passed_old) {
+                if (spin < max_spin)
+                    ++spin;
+                else
+                    std::this_thread::yield();
+            }
+        }
     }
 
 private:
+    static constexpr int max_spin = 10000;
+
     int count_;
     std::atomic<int> passed_;
 };
@@ -9,6 +9,8 @@
 #ifndef SLATE_METHOD_HH
 #define SLATE_METHOD_HH
 
+#include "slate/internal/CostModel.hh"
+
 namespace slate {
 
 typedef int Method;
@@ -24,12 +26,14 @@ const Method baseMethodAuto  = 0;
 /// Select the right algorithm to perform the trsm
 namespace MethodTrsm {
 
-    constexpr char TrsmA_str[] = "A";
-    constexpr char TrsmB_str[] = "B";
-    const Method Error  = baseMethodError;
-    const Method Auto   = baseMethodAuto;
-    const Method TrsmA  = 1;  ///< Select trsmA algorithm
-    const Method TrsmB  = 2;  ///< Select trsmB algorithm
+    constexpr char TrsmA_str[]   = "A";
+    constexpr char TrsmB_str[]   = "B";
+    constexpr char TrsmInv_str[] = "Inv";
+    const Method Error   = baseMethodError;
+    const Method Auto    = baseMethodAuto;
+    const Method TrsmA   = 1;  ///< Select trsmA algorithm
+    const Method TrsmB   = 2;  ///< Select trsmB algorithm
+    const Method TrsmInv = 3;  ///< Select trsmB with inverted diagonal tiles
 
     template <typename TA, typename TB>
     inline Method select_algo(TA& A, TB& B, Options const& opts) {
@@ -38,6 +42,24 @@ namespace MethodTrsm {
 
         Method method = (B.nt() < 2 ? TrsmA : TrsmB);
 
+        // If the cost model is enabled, on host, pick the variant with the
+        // least predicted time; ties, e.g., on one rank, keep the heuristic.
+        // B is m-by-n with A on the left, or n-by-m with A on the right.
+        int p, q;
+        if (CostModel::enabled() && target != Target::Devices
+            && CostModel::grid( B, &p, &q )) {
+            int64_t m = A.m();
+            int64_t n = (B.m() == m ? B.n() : B.m());
+            int64_t nb = A.tileNb( 0 );
+            int elem_size = sizeof( typename TB::value_type );
+            double time_A = CostModel::trsmA( m, n, p, q, nb, elem_size );
+            double time_B = CostModel::trsmB( m, n, p, q, nb, elem_size );
+            if (time_A < time_B)
+                method = TrsmA;
+            else if (time_B < time_A)
+                method = TrsmB;
+        }
+
         if (method == TrsmA && target == Target::Devices && n_devices > 1)
           method = TrsmB;
 
@@ -56,6 +78,8 @@ namespace MethodTrsm {
             return TrsmA;
         else if (method_ == "b" || method_ == "trsmb")
             return TrsmB;
+        else if (method_ == "inv" || method_ == "trsminv")
+            return TrsmInv;
         else
             throw slate::Exception("unknown trsm method");
     }
@@ -63,10 +87,11 @@ namespace MethodTrsm {
     inline const char* methodTrsm2str(Method method)
     {
         switch (method) {
-            case Auto:  return baseMethodAuto_str;
-            case TrsmA: return TrsmA_str;
-            case TrsmB: return TrsmB_str;
-            default:    return baseMethodError_str;
+            case Auto:    return baseMethodAuto_str;
+            case TrsmA:   return TrsmA_str;
+            case TrsmB:   return TrsmB_str;
+            case TrsmInv: return TrsmInv_str;
+            default:      return baseMethodError_str;
         }
     }
 
@@ -91,6 +116,23 @@ namespace MethodGemm {
 
         Method method = (B.nt() < 2 ? GemmA : GemmC);
 
+        // If the cost model is enabled, on host, pick the variant with the
+        // least predicted time; ties, e.g., on one rank, keep the heuristic.
+        int p, q;
+        if (CostModel::enabled() && target != Target::Devices
+            && CostModel::grid( A, &p, &q )) {
+            int64_t nb = A.tileNb( 0 );
+            int elem_size = sizeof( typename TA::value_type );
+            double time_A = CostModel::gemmA(
+                A.m(), B.n(), A.n(), p, q, nb, elem_size );
+            double time_C = CostModel::gemmC(
+                A.m(), B.n(), A.n(), p, q, nb, elem_size );
+            if (time_A < time_C)
+                method = GemmA;
+            else if (time_C < time_A)
+                method = GemmC;
+        }
+
         if (method == GemmA && target == Target::Devices && n_devices > 1)
           method = GemmC;
 
@@ -143,8 +185,27 @@ namespace MethodHemm {
 
         Method method = (B.nt() < 2 ? HemmA : HemmC);
 
-        // XXX For now, when target == device, we fallback to HemmC on device
-        if (target == Target::Devices && method == HemmA)
+        // If the cost model is enabled, pick the variant with the least
+        // predicted time, as for gemm; ties keep the heuristic.
+        // B is m-by-n with A on the left, or n-by-m with A on the right.
+        int p, q;
+        if (CostModel::enabled() && target != Target::Devices
+            && CostModel::grid( B, &p, &q )) {
+            int64_t m = A.m();
+            int64_t n = (B.m() == m ? B.n() : B.m());
+            int64_t nb = A.tileNb( 0 );
+            int elem_size = sizeof( typename TB::value_type );
+            double time_A = CostModel::gemmA( m, n, m, p, q, nb, elem_size );
+            double time_C = CostModel::gemmC( m, n, m, p, q, nb, elem_size );
+            if (time_A < time_C)
+                method = HemmA;
+            else if (time_C < time_A)
+                method = HemmC;
+        }
+
+        // hemmA is implemented only for HostTask.
+        if (method == HemmA
+            && target != Target::HostTask && target != Target::Host)
             method = HemmC;
 
         return method;
@@ -197,6 +258,27 @@ namespace MethodCholQR {
 
         Method method = (target == Target::Devices ? HerkC : GemmA);
 
+        // If the cost model is enabled, on host, pick the variant with the
+        // least predicted time to compute R = A^H A, with A m-by-n,
+        // as gemm( n, n, m ).
+        int p, q;
+        if (CostModel::enabled() && target != Target::Devices
+            && CostModel::grid( A, &p, &q )) {
+            int64_t m = A.m();
+            int64_t n = A.n();
+            int64_t nb = A.tileNb( 0 );
+            int elem_size = sizeof( typename TA::value_type );
+            double time_herkC = CostModel::herkC( n, m, p, q, nb, elem_size );
+            double time_gemmA = CostModel::gemmA( n, n, m, p, q, nb, elem_size );
+            double time_gemmC = CostModel::gemmC( n, n, m, p, q, nb, elem_size );
+            if (time_gemmA <= time_herkC && time_gemmA <= time_gemmC)
+                method = GemmA;
+            else if (time_herkC <= time_gemmC)
+                method = HerkC;
+            else
+                method = GemmC;
+        }
+
         return method;
     }
 
@@ -241,6 +323,8 @@ namespace MethodGels {
     static const Method Cholqr  = 1;  ///< Select cholqr algorithm
     static const Method Geqrf   = 2;  ///< Select geqrf algorithm
 
+    /// Always selects Geqrf. CholQR is predicted to be faster, but it
+    /// squares the condition number, so it isn't selected on cost alone.
     template <typename TA, typename TB>
     inline Method select_algo(TA& A, TB& B, Options const& opts) {
         return Geqrf;
@@ -314,6 +398,67 @@ namespace MethodLU {
 
 } // namespace MethodLU
 
+//------------------------------------------------------------------------------
+/// Select the algorithm to reduce a tile across ranks, as in listReduce.
+namespace MethodReduce {
+
+    constexpr char Binomial_str[]      = "binomial";
+    constexpr char ReduceScatter_str[] = "reducescatter";
+    constexpr char Pipelined_str[]     = "pipelined";
+    const Method Error         = baseMethodError;
+    const Method Auto          = baseMethodAuto;
+    const Method Binomial      = 1;  ///< Select binomial tree of full tiles
+    const Method ReduceScatter = 2;  ///< Select ring reduce-scatter + gather
+    const Method Pipelined     = 3;  ///< Select pipelined chain of segments
+
+    /// Tiles smaller than this many bytes use the binomial tree.
+    constexpr int64_t segment_bytes = 64*1024;
+
+    /// Selects the method for reducing a tile of tile_bytes bytes across
+    /// num_ranks ranks. The binomial tree sends log2( p ) full tiles along
+    /// its critical path; the segmented methods send about 1 to 2 tiles,
+    /// at the cost of p - 1 or more messages.
+    inline Method select_algo( int num_ranks, int64_t tile_bytes )
+    {
+        if (num_ranks <= 2 || tile_bytes < 2*segment_bytes)
+            return Binomial;
+        else if (num_ranks < 8)
+            return Pipelined;
+        else
+            return ReduceScatter;
+    }
+
+    inline Method str2methodReduce( const char* method )
+    {
+        std::string method_ = method;
+        std::transform(
+            method_.begin(), method_.end(), method_.begin(), ::tolower );
+
+        if (method_ == "auto")
+            return Auto;
+        else if (method_ == "binomial" || method_ == "tree")
+            return Binomial;
+        else if (method_ == "reducescatter" || method_ == "rs")
+            return ReduceScatter;
+        else if (method_ == "pipelined" || method_ == "pipeline")
+            return Pipelined;
+        else
+            throw slate::Exception("unknown reduce method");
+    }
+
+    inline const char* methodReduce2str( Method method )
+    {
+        switch (method) {
+            case Auto:          return baseMethodAuto_str;
+            case Binomial:      return Binomial_str;
+            case ReduceScatter: return ReduceScatter_str;
+            case Pipelined:     return Pipelined_str;
+            default:            return baseMethodError_str;
+        }
+    }
+
+} // namespace MethodReduce
+
 } // namespace slate
 
 #endif // SLATE_METHOD_HH
@@ -751,6 +751,40 @@ void eig(
     syev( A, Lambda, Z, opts );
 }
 
+//------------------------------------------------------------------------------
+// Non-symmetric eigenvalues
+
+template <typename scalar_t>
+void eig_vals(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Options const& opts = Options())
+{
+    Matrix<scalar_t> V;
+    geev( A, Lambda, V, opts );
+}
+
+/// Without V, compute only eigenvalues. Same as eig_vals.
+template <typename scalar_t>
+void eig(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Options const& opts = Options())
+{
+    eig_vals( A, Lambda, opts );
+}
+
+/// With V, compute eigenvalues & right eigenvectors.
+template <typename scalar_t>
+void eig(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Matrix<scalar_t>& V,
+    Options const& opts = Options())
+{
+    geev( A, Lambda, V, opts );
+}
+
 //------------------------------------------------------------------------------
 // Generalized symmetric/Hermitian eigenvalues
 
@@ -19,6 +19,7 @@
 
 #include "slate/types.hh"
 #include "slate/print.hh"
+#include "slate/internal/Timers.hh"
 
 //------------------------------------------------------------------------------
 /// @namespace slate
@@ -401,6 +402,13 @@ void redistribute(
     Matrix<scalar_t>& B,
     Options const& opts = Options());
 
+template <typename scalar_t>
+void redistribute(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    MPI_Comm comm,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // syr2k()
 template <typename scalar_t>
@@ -887,6 +895,21 @@ void gels_cholqr(
     Matrix<scalar_t>& BX,
     Options const& opts = Options());
 
+// Using low precision QR with iterative refinement
+template <typename scalar_t>
+void gels_mixed(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& BX,
+    int& iter,
+    Options const& opts = Options());
+
+template <typename scalar_hi, typename scalar_lo>
+void gels_mixed(
+    Matrix<scalar_hi>& A,
+    Matrix<scalar_hi>& BX,
+    int& iter,
+    Options const& opts = Options());
+
 // Backward compatibility
 template <typename scalar_t>
 [[deprecated( "Use gels( A, BX[, opts] ) instead. Will be removed 2024-02." )]]
@@ -1069,6 +1092,50 @@ void heev(
     heev( A, Lambda, Z, opts );
 }
 
+//-----------------------------------------
+// lobpcg()
+template <typename scalar_t>
+void lobpcg(
+    HermitianMatrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Matrix<scalar_t>& X,
+    int& iter,
+    std::function< void (Matrix<scalar_t>& R) > const& precond,
+    Options const& opts = Options());
+
+/// Without preconditioner.
+template <typename scalar_t>
+void lobpcg(
+    HermitianMatrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Matrix<scalar_t>& X,
+    int& iter,
+    Options const& opts = Options())
+{
+    lobpcg( A, Lambda, X, iter,
+            std::function< void (Matrix<scalar_t>& R) >(), opts );
+}
+
+//-----------------------------------------
+// hbev()
+template <typename scalar_t>
+void hbev(
+    HermitianBandMatrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts = Options());
+
+/// Without Z, compute only eigenvalues.
+template <typename scalar_t>
+void hbev(
+    HermitianBandMatrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Options const& opts = Options())
+{
+    Matrix<scalar_t> Z;
+    hbev( A, Lambda, Z, opts );
+}
+
 //-----------------------------------------
 // forward real-symmetric matrices to heev;
 // disabled for complex
@@ -1097,6 +1164,45 @@ void syev(
     heev( AH, Lambda, Z, opts );
 }
 
+//------------------------------------------------------------------------------
+// Non-symmetric eigenvalues
+
+template <typename scalar_t>
+void geev(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Matrix<scalar_t>& V,
+    Options const& opts = Options());
+
+/// Without V, compute only eigenvalues.
+template <typename scalar_t>
+void geev(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Options const& opts = Options())
+{
+    Matrix<scalar_t> V;
+    geev( A, Lambda, V, opts );
+}
+
+//-----------------------------------------
+// gehrd()
+template <typename scalar_t>
+void gehrd(
+    Matrix<scalar_t>& A,
+    std::vector<scalar_t>& tau,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// unmhr()
+template <typename scalar_t>
+void unmhr(
+    Side side, Op op,
+    Matrix<scalar_t>& A,
+    std::vector<scalar_t>& tau,
+    Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
 //------------------------------------------------------------------------------
 // Generalized symmetric/Hermitian eigenvalues
 
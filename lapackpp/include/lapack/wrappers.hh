@@ -8,6 +8,8 @@
 
 #include "lapack/util.hh"
 
+#include <vector>
+
 namespace lapack {
 
 // This is in alphabetical order.
@@ -10340,6 +10342,173 @@ int64_t unhr_col(
     std::complex<double>* T, int64_t ldt,
     std::complex<double>* D );
 
+//==============================================================================
+// Host batched routines, for many small matrices.
+namespace batch {
+
+// -----------------------------------------------------------------------------
+void getrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector<float*>     const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void getrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector<double*>    const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void getrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void getrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+// -----------------------------------------------------------------------------
+void getrs(
+    std::vector<lapack::Op> const& trans,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector<float*>     const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    std::vector<float*>     const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size );
+
+void getrs(
+    std::vector<lapack::Op> const& trans,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector<double*>    const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    std::vector<double*>    const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size );
+
+void getrs(
+    std::vector<lapack::Op> const& trans,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    std::vector< std::complex<float>* > const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size );
+
+void getrs(
+    std::vector<lapack::Op> const& trans,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    std::vector< std::complex<double>* > const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size );
+
+// -----------------------------------------------------------------------------
+void potrf(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<float*>     const& Aarray, std::vector<int64_t> const& lda,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void potrf(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<double*>    const& Aarray, std::vector<int64_t> const& lda,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void potrf(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector<int64_t> const& lda,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void potrf(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector<int64_t> const& lda,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+// -----------------------------------------------------------------------------
+void potrs(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector<float*>     const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<float*>     const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size );
+
+void potrs(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector<double*>    const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<double*>    const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size );
+
+void potrs(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size );
+
+void potrs(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size );
+
+// -----------------------------------------------------------------------------
+void geqrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector<float*>     const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<float*>     const& tau_array,
+    size_t batch_size );
+
+void geqrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector<double*>    const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<double*>    const& tau_array,
+    size_t batch_size );
+
+void geqrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector< std::complex<float>* > const& tau_array,
+    size_t batch_size );
+
+void geqrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector< std::complex<double>* > const& tau_array,
+    size_t batch_size );
+
+}  // namespace batch
+
 }  // namespace lapack
 
 #endif // LAPACK_WRAPPERS_HH
@@ -0,0 +1,179 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "batch_kernels.hh"
+
+#include <vector>
+
+namespace lapack {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Selects the geqrf kernel for a uniform-size batch.
+template <typename scalar_t>
+auto geqrf_kernel( int64_t m, int64_t n )
+    -> void (*)( int64_t, int64_t, scalar_t*, int64_t, scalar_t* )
+{
+    if (m == n) {
+        switch (n) {
+            case  8: return geqrf_unblocked<  8, scalar_t >;
+            case 16: return geqrf_unblocked< 16, scalar_t >;
+            case 32: return geqrf_unblocked< 32, scalar_t >;
+        }
+    }
+    return geqrf_unblocked< 0, scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched version.
+/// Mid-level templated wrapper checks arguments, then factors the
+/// matrices in parallel using unblocked kernels.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+void geqrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector<scalar_t*>  const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<scalar_t*>  const& tau_array,
+    size_t batch_size )
+{
+    batch_check_size( m,   batch_size );
+    batch_check_size( n,   batch_size );
+    batch_check_size( lda, batch_size );
+    lapack_error_if( Aarray.size()    < batch_size );
+    lapack_error_if( tau_array.size() < batch_size );
+
+    for (size_t i = 0; i < batch_size; ++i) {
+        int64_t m_   = blas::batch::extract( m,   i );
+        int64_t n_   = blas::batch::extract( n,   i );
+        int64_t lda_ = blas::batch::extract( lda, i );
+        lapack_error_if( m_ < 0 );
+        lapack_error_if( n_ < 0 );
+        lapack_error_if( lda_ < std::max( int64_t( 1 ), m_ ) );
+    }
+
+    if (m.size() == 1 && n.size() == 1 && lda.size() == 1) {
+        // Uniform size: select the kernel once for the whole batch.
+        auto kernel = geqrf_kernel<scalar_t>( m[0], n[0] );
+        #pragma omp parallel for schedule( static )
+        for (size_t i = 0; i < batch_size; ++i) {
+            kernel( m[0], n[0], Aarray[ i ], lda[0], tau_array[ i ] );
+        }
+    }
+    else {
+        #pragma omp parallel for schedule( dynamic )
+        for (size_t i = 0; i < batch_size; ++i) {
+            geqrf_unblocked< 0, scalar_t >(
+                blas::batch::extract( m, i ),
+                blas::batch::extract( n, i ),
+                Aarray[ i ], blas::batch::extract( lda, i ),
+                tau_array[ i ] );
+        }
+    }
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+namespace batch {
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, float version.
+/// @ingroup geqrf
+void geqrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector<float*>     const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<float*>     const& tau_array,
+    size_t batch_size )
+{
+    impl::geqrf( m, n, Aarray, lda, tau_array, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, double version.
+/// @ingroup geqrf
+void geqrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector<double*>    const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<double*>    const& tau_array,
+    size_t batch_size )
+{
+    impl::geqrf( m, n, Aarray, lda, tau_array, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, complex<float> version.
+/// @ingroup geqrf
+void geqrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector< std::complex<float>* > const& tau_array,
+    size_t batch_size )
+{
+    impl::geqrf( m, n, Aarray, lda, tau_array, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the QR factorizations of a batch of general m-by-n matrices,
+/// $A_i = Q_i R_i$ for i = 0, ..., batch_size-1.
+/// The output format is the same as lapack::geqrf, so Q_i can be
+/// applied or generated by lapack::unmqr or lapack::ungqr.
+///
+/// Intended for many small matrices (up to a few hundred rows):
+/// matrices are factored in parallel with OpenMP over the batch, each by
+/// an unblocked kernel that does not call BLAS, so there is no nested
+/// BLAS threading. If m, n, and lda each have a single entry, all
+/// matrices have the same size and a kernel specialized for that size
+/// is used when available.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     Number of rows of each matrix A_i. m[i] >= 0.
+///     Either 1 entry, shared by all matrices, or batch_size entries.
+///
+/// @param[in] n
+///     Number of columns of each matrix A_i. n[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Aarray[i] is the m_i-by-n_i matrix
+///     A_i, stored in an lda_i-by-n_i array. On exit, R_i in the upper
+///     trapezoid and the Householder vectors of Q_i below the diagonal,
+///     as in geqrf.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda[i] >= max(1, m[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[out] tau_array
+///     Array of batch_size pointers. tau_array[i] is the vector of
+///     length min(m_i, n_i) of scalar factors of the reflectors of Q_i.
+///
+/// @param[in] batch_size
+///     Number of matrices in the batch.
+///
+/// @ingroup geqrf
+void geqrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector< std::complex<double>* > const& tau_array,
+    size_t batch_size )
+{
+    impl::geqrf( m, n, Aarray, lda, tau_array, batch_size );
+}
+
+}  // namespace batch
+}  // namespace lapack
@@ -0,0 +1,189 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "batch_kernels.hh"
+
+#include <vector>
+
+namespace lapack {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Selects the getrf kernel for a uniform-size batch. Square sizes that
+/// are common tile sizes get a kernel with compile-time dimensions.
+template <typename scalar_t>
+auto getrf_kernel( int64_t m, int64_t n )
+    -> int64_t (*)( int64_t, int64_t, scalar_t*, int64_t, int64_t* )
+{
+    if (m == n) {
+        switch (n) {
+            case  8: return getrf_unblocked<  8, scalar_t >;
+            case 16: return getrf_unblocked< 16, scalar_t >;
+            case 32: return getrf_unblocked< 32, scalar_t >;
+        }
+    }
+    return getrf_unblocked< 0, scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched version.
+/// Mid-level templated wrapper checks arguments, then factors the
+/// matrices in parallel using unblocked kernels.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector<scalar_t*>  const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    batch_check_size( m,   batch_size );
+    batch_check_size( n,   batch_size );
+    batch_check_size( lda, batch_size );
+    lapack_error_if( Aarray.size()     < batch_size );
+    lapack_error_if( ipiv_array.size() < batch_size );
+    lapack_error_if( info.size() != batch_size );
+
+    for (size_t i = 0; i < batch_size; ++i) {
+        int64_t m_   = blas::batch::extract( m,   i );
+        int64_t n_   = blas::batch::extract( n,   i );
+        int64_t lda_ = blas::batch::extract( lda, i );
+        lapack_error_if( m_ < 0 );
+        lapack_error_if( n_ < 0 );
+        lapack_error_if( lda_ < std::max( int64_t( 1 ), m_ ) );
+    }
+
+    if (m.size() == 1 && n.size() == 1 && lda.size() == 1) {
+        // Uniform size: select the kernel once for the whole batch.
+        auto kernel = getrf_kernel<scalar_t>( m[0], n[0] );
+        #pragma omp parallel for schedule( static )
+        for (size_t i = 0; i < batch_size; ++i) {
+            info[ i ] = kernel( m[0], n[0], Aarray[ i ], lda[0],
+                                ipiv_array[ i ] );
+        }
+    }
+    else {
+        #pragma omp parallel for schedule( dynamic )
+        for (size_t i = 0; i < batch_size; ++i) {
+            int64_t m_   = blas::batch::extract( m,   i );
+            int64_t n_   = blas::batch::extract( n,   i );
+            int64_t lda_ = blas::batch::extract( lda, i );
+            info[ i ] = getrf_unblocked< 0 >( m_, n_, Aarray[ i ], lda_,
+                                              ipiv_array[ i ] );
+        }
+    }
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+namespace batch {
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, float version.
+/// @ingroup gesv_computational
+void getrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector<float*>     const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::getrf( m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, double version.
+/// @ingroup gesv_computational
+void getrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector<double*>    const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::getrf( m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, complex<float> version.
+/// @ingroup gesv_computational
+void getrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::getrf( m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the LU factorizations of a batch of general m-by-n matrices,
+/// using partial pivoting with row interchanges,
+/// $A_i = P_i L_i U_i$ for i = 0, ..., batch_size-1.
+///
+/// Intended for many small matrices (up to a few hundred rows):
+/// matrices are factored in parallel with OpenMP over the batch, each by
+/// an unblocked kernel that does not call BLAS, so there is no nested
+/// BLAS threading. If m, n, and lda each have a single entry, all
+/// matrices have the same size and a kernel specialized for that size
+/// is used when available.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     Number of rows of each matrix A_i. m[i] >= 0.
+///     Either 1 entry, shared by all matrices, or batch_size entries.
+///
+/// @param[in] n
+///     Number of columns of each matrix A_i. n[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Aarray[i] is the m_i-by-n_i matrix
+///     A_i, stored in an lda_i-by-n_i array. On exit, the factors
+///     L_i and U_i; the unit diagonal elements of L_i are not stored.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda[i] >= max(1, m[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[out] ipiv_array
+///     Array of batch_size pointers. ipiv_array[i] is the vector of
+///     length min(m_i, n_i) of 1-based pivot indices of A_i, as in getrf.
+///
+/// @param[in] batch_size
+///     Number of matrices in the batch.
+///
+/// @param[out] info
+///     Vector of length batch_size. info[i] is the getrf return value
+///     for A_i: 0 on success, or j > 0 if U_i(j,j) is exactly zero.
+///
+/// @ingroup gesv_computational
+void getrf(
+    std::vector<int64_t>    const& m,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::getrf( m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+}  // namespace batch
+}  // namespace lapack
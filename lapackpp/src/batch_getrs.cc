@@ -0,0 +1,213 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "batch_kernels.hh"
+
+#include <vector>
+
+namespace lapack {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Selects the getrs kernel for a uniform-size batch.
+template <typename scalar_t>
+auto getrs_kernel( int64_t n )
+    -> void (*)( lapack::Op, int64_t, int64_t, scalar_t const*, int64_t,
+                 int64_t const*, scalar_t*, int64_t )
+{
+    switch (n) {
+        case  8: return getrs_unblocked<  8, scalar_t >;
+        case 16: return getrs_unblocked< 16, scalar_t >;
+        case 32: return getrs_unblocked< 32, scalar_t >;
+    }
+    return getrs_unblocked< 0, scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched version.
+/// Mid-level templated wrapper checks arguments, then solves the
+/// systems in parallel using unblocked kernels.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrs(
+    std::vector<lapack::Op> const& trans,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector<scalar_t*>  const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    std::vector<scalar_t*>  const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size )
+{
+    batch_check_size( trans, batch_size );
+    batch_check_size( n,     batch_size );
+    batch_check_size( nrhs,  batch_size );
+    batch_check_size( lda,   batch_size );
+    batch_check_size( ldb,   batch_size );
+    lapack_error_if( Aarray.size()     < batch_size );
+    lapack_error_if( ipiv_array.size() < batch_size );
+    lapack_error_if( Barray.size()     < batch_size );
+
+    for (size_t i = 0; i < batch_size; ++i) {
+        lapack::Op trans_ = blas::batch::extract( trans, i );
+        int64_t n_    = blas::batch::extract( n,    i );
+        int64_t nrhs_ = blas::batch::extract( nrhs, i );
+        int64_t lda_  = blas::batch::extract( lda,  i );
+        int64_t ldb_  = blas::batch::extract( ldb,  i );
+        lapack_error_if( trans_ != Op::NoTrans &&
+                         trans_ != Op::Trans &&
+                         trans_ != Op::ConjTrans );
+        lapack_error_if( n_ < 0 );
+        lapack_error_if( nrhs_ < 0 );
+        lapack_error_if( lda_ < std::max( int64_t( 1 ), n_ ) );
+        lapack_error_if( ldb_ < std::max( int64_t( 1 ), n_ ) );
+    }
+
+    if (n.size() == 1 && lda.size() == 1) {
+        // Uniform size: select the kernel once for the whole batch.
+        auto kernel = getrs_kernel<scalar_t>( n[0] );
+        #pragma omp parallel for schedule( static )
+        for (size_t i = 0; i < batch_size; ++i) {
+            kernel( blas::batch::extract( trans, i ), n[0],
+                    blas::batch::extract( nrhs, i ),
+                    Aarray[ i ], lda[0], ipiv_array[ i ],
+                    Barray[ i ], blas::batch::extract( ldb, i ) );
+        }
+    }
+    else {
+        #pragma omp parallel for schedule( dynamic )
+        for (size_t i = 0; i < batch_size; ++i) {
+            getrs_unblocked< 0, scalar_t >(
+                blas::batch::extract( trans, i ),
+                blas::batch::extract( n,     i ),
+                blas::batch::extract( nrhs,  i ),
+                Aarray[ i ], blas::batch::extract( lda, i ),
+                ipiv_array[ i ],
+                Barray[ i ], blas::batch::extract( ldb, i ) );
+        }
+    }
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+namespace batch {
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, float version.
+/// @ingroup gesv_computational
+void getrs(
+    std::vector<lapack::Op> const& trans,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector<float*>     const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    std::vector<float*>     const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size )
+{
+    impl::getrs( trans, n, nrhs, Aarray, lda, ipiv_array, Barray, ldb,
+                 batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, double version.
+/// @ingroup gesv_computational
+void getrs(
+    std::vector<lapack::Op> const& trans,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector<double*>    const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    std::vector<double*>    const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size )
+{
+    impl::getrs( trans, n, nrhs, Aarray, lda, ipiv_array, Barray, ldb,
+                 batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, complex<float> version.
+/// @ingroup gesv_computational
+void getrs(
+    std::vector<lapack::Op> const& trans,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    std::vector< std::complex<float>* > const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size )
+{
+    impl::getrs( trans, n, nrhs, Aarray, lda, ipiv_array, Barray, ldb,
+                 batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations
+/// $op(A_i) X_i = B_i$ for i = 0, ..., batch_size-1,
+/// using the LU factorizations computed by lapack::batch::getrf.
+///
+/// Systems are solved in parallel with OpenMP over the batch, each by an
+/// unblocked kernel that does not call BLAS.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     The form of each system of equations:
+///     - lapack::Op::NoTrans:   $A_i   X_i = B_i$ (No transpose)
+///     - lapack::Op::Trans:     $A_i^T X_i = B_i$ (Transpose)
+///     - lapack::Op::ConjTrans: $A_i^H X_i = B_i$ (Conjugate transpose)
+///     Either 1 entry, shared by all matrices, or batch_size entries.
+///
+/// @param[in] n
+///     Order of each matrix A_i. n[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in] nrhs
+///     Number of right hand sides of each system. nrhs[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in] Aarray
+///     Array of batch_size pointers to the factors L_i and U_i
+///     from lapack::batch::getrf.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda[i] >= max(1, n[i]).
+///
+/// @param[in] ipiv_array
+///     Array of batch_size pointers to the pivot indices
+///     from lapack::batch::getrf.
+///
+/// @param[in,out] Barray
+///     Array of batch_size pointers. On entry, Barray[i] is the
+///     n_i-by-nrhs_i right hand side matrix B_i;
+///     on exit, the solution matrix X_i.
+///
+/// @param[in] ldb
+///     Leading dimension of each B_i. ldb[i] >= max(1, n[i]).
+///
+/// @param[in] batch_size
+///     Number of systems in the batch.
+///
+/// @ingroup gesv_computational
+void getrs(
+    std::vector<lapack::Op> const& trans,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<int64_t*>   const& ipiv_array,
+    std::vector< std::complex<double>* > const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size )
+{
+    impl::getrs( trans, n, nrhs, Aarray, lda, ipiv_array, Barray, ldb,
+                 batch_size );
+}
+
+}  // namespace batch
+}  // namespace lapack
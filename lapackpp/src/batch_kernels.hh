@@ -0,0 +1,380 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BATCH_KERNELS_HH
+#define LAPACK_BATCH_KERNELS_HH
+
+#include "lapack.hh"
+#include "blas/batch_common.hh"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// Unblocked kernels used by the host batched routines (batch_*.cc).
+// Each kernel factors or solves a single small matrix without calling
+// BLAS, so the batch can be parallelized over matrices with OpenMP
+// without nested BLAS threading.
+//
+// Kernels are templated on a compile-time size N. For N > 0, the loop
+// bounds are compile-time constants (m = n = N), which lets the compiler
+// fully unroll and vectorize them; this is used for the uniform-size
+// fast path. For N = 0, the runtime sizes are used.
+
+namespace lapack {
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Checks that a batch argument holds either one value shared by all
+/// matrices, or one value per matrix.
+template <typename T>
+void batch_check_size( std::vector<T> const& x, size_t batch_size )
+{
+    lapack_error_if( x.size() != 1 && x.size() != batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Unblocked LU factorization with partial pivoting of one m-by-n matrix,
+/// as in LAPACK getf2. ipiv is 1-based.
+/// @return info, as in lapack::getrf.
+template <int64_t N, typename scalar_t>
+int64_t getrf_unblocked(
+    int64_t m_, int64_t n_,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv )
+{
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+
+    using real_t = blas::real_type<scalar_t>;
+    const scalar_t one = 1;
+    const real_t sfmin = std::numeric_limits<real_t>::min();
+
+    const int64_t m = (N > 0 ? N : m_);
+    const int64_t n = (N > 0 ? N : n_);
+    const int64_t minmn = std::min( m, n );
+
+    int64_t info = 0;
+    for (int64_t j = 0; j < minmn; ++j) {
+        // Find pivot, as in iamax.
+        int64_t jp = j;
+        real_t amax = blas::abs1( A( j, j ) );
+        for (int64_t i = j+1; i < m; ++i) {
+            real_t a = blas::abs1( A( i, j ) );
+            if (a > amax) {
+                amax = a;
+                jp = i;
+            }
+        }
+        ipiv[ j ] = jp + 1;
+
+        if (amax != 0) {
+            if (jp != j) {
+                for (int64_t k = 0; k < n; ++k)
+                    std::swap( A( j, k ), A( jp, k ) );
+            }
+            // Compute elements j+1:m of j-th column.
+            scalar_t pivot = A( j, j );
+            if (std::abs( pivot ) >= sfmin) {
+                scalar_t r = one / pivot;
+                for (int64_t i = j+1; i < m; ++i)
+                    A( i, j ) *= r;
+            }
+            else {
+                for (int64_t i = j+1; i < m; ++i)
+                    A( i, j ) /= pivot;
+            }
+        }
+        else if (info == 0) {
+            info = j + 1;
+        }
+
+        // Rank-1 update of trailing submatrix.
+        for (int64_t k = j+1; k < n; ++k) {
+            scalar_t ajk = A( j, k );
+            for (int64_t i = j+1; i < m; ++i)
+                A( i, k ) -= A( i, j ) * ajk;
+        }
+    }
+    return info;
+
+    #undef A
+}
+
+//------------------------------------------------------------------------------
+/// Solves op(A) X = B using the LU factors from getrf_unblocked.
+template <int64_t N, typename scalar_t>
+void getrs_unblocked(
+    lapack::Op trans, int64_t n_, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    int64_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+    #define B(i_, j_) B[ (i_) + (j_)*ldb ]
+
+    using blas::conj;
+
+    const int64_t n = (N > 0 ? N : n_);
+    const bool do_conj = (trans == Op::ConjTrans);
+
+    for (int64_t c = 0; c < nrhs; ++c) {
+        if (trans == Op::NoTrans) {
+            // Solve A X = P L U X = B.
+            for (int64_t j = 0; j < n; ++j) {
+                int64_t jp = ipiv[ j ] - 1;
+                if (jp != j)
+                    std::swap( B( j, c ), B( jp, c ) );
+            }
+            for (int64_t j = 0; j < n; ++j) {
+                scalar_t bj = B( j, c );
+                for (int64_t i = j+1; i < n; ++i)
+                    B( i, c ) -= A( i, j ) * bj;
+            }
+            for (int64_t j = n-1; j >= 0; --j) {
+                B( j, c ) /= A( j, j );
+                scalar_t bj = B( j, c );
+                for (int64_t i = 0; i < j; ++i)
+                    B( i, c ) -= A( i, j ) * bj;
+            }
+        }
+        else {
+            // Solve A^T X = U^T L^T P^T X = B, or A^H likewise.
+            for (int64_t j = 0; j < n; ++j) {
+                scalar_t s = B( j, c );
+                for (int64_t i = 0; i < j; ++i)
+                    s -= (do_conj ? conj( A( i, j ) ) : A( i, j )) * B( i, c );
+                B( j, c ) = s / (do_conj ? conj( A( j, j ) ) : A( j, j ));
+            }
+            for (int64_t j = n-1; j >= 0; --j) {
+                scalar_t s = B( j, c );
+                for (int64_t i = j+1; i < n; ++i)
+                    s -= (do_conj ? conj( A( i, j ) ) : A( i, j )) * B( i, c );
+                B( j, c ) = s;
+            }
+            for (int64_t j = n-1; j >= 0; --j) {
+                int64_t jp = ipiv[ j ] - 1;
+                if (jp != j)
+                    std::swap( B( j, c ), B( jp, c ) );
+            }
+        }
+    }
+
+    #undef A
+    #undef B
+}
+
+//------------------------------------------------------------------------------
+/// Unblocked Cholesky factorization of one n-by-n Hermitian positive
+/// definite matrix, as in LAPACK potf2.
+/// @return info, as in lapack::potrf.
+template <int64_t N, typename scalar_t>
+int64_t potrf_unblocked(
+    lapack::Uplo uplo, int64_t n_,
+    scalar_t* A, int64_t lda )
+{
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+
+    using blas::real;
+    using blas::conj;
+    using real_t = blas::real_type<scalar_t>;
+
+    const int64_t n = (N > 0 ? N : n_);
+
+    if (uplo == Uplo::Lower) {
+        // Left-looking, column j of L is computed from columns 0:j-1.
+        for (int64_t j = 0; j < n; ++j) {
+            real_t ajj = real( A( j, j ) );
+            for (int64_t k = 0; k < j; ++k)
+                ajj -= real( A( j, k ) * conj( A( j, k ) ) );
+            if (ajj <= 0 || std::isnan( ajj )) {
+                A( j, j ) = ajj;
+                return j + 1;
+            }
+            ajj = std::sqrt( ajj );
+            A( j, j ) = ajj;
+
+            for (int64_t k = 0; k < j; ++k) {
+                scalar_t ajk = conj( A( j, k ) );
+                for (int64_t i = j+1; i < n; ++i)
+                    A( i, j ) -= A( i, k ) * ajk;
+            }
+            real_t r = 1 / ajj;
+            for (int64_t i = j+1; i < n; ++i)
+                A( i, j ) *= r;
+        }
+    }
+    else {
+        // Row j of U is computed from rows 0:j-1, using dot products
+        // down the columns, which are contiguous.
+        for (int64_t j = 0; j < n; ++j) {
+            real_t ajj = real( A( j, j ) );
+            for (int64_t k = 0; k < j; ++k)
+                ajj -= real( conj( A( k, j ) ) * A( k, j ) );
+            if (ajj <= 0 || std::isnan( ajj )) {
+                A( j, j ) = ajj;
+                return j + 1;
+            }
+            ajj = std::sqrt( ajj );
+            A( j, j ) = ajj;
+
+            real_t r = 1 / ajj;
+            for (int64_t i = j+1; i < n; ++i) {
+                scalar_t s = A( j, i );
+                for (int64_t k = 0; k < j; ++k)
+                    s -= conj( A( k, j ) ) * A( k, i );
+                A( j, i ) = s * r;
+            }
+        }
+    }
+    return 0;
+
+    #undef A
+}
+
+//------------------------------------------------------------------------------
+/// Solves A X = B using the Cholesky factor from potrf_unblocked.
+template <int64_t N, typename scalar_t>
+void potrs_unblocked(
+    lapack::Uplo uplo, int64_t n_, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+    #define B(i_, j_) B[ (i_) + (j_)*ldb ]
+
+    using blas::real;
+    using blas::conj;
+
+    const int64_t n = (N > 0 ? N : n_);
+
+    for (int64_t c = 0; c < nrhs; ++c) {
+        if (uplo == Uplo::Lower) {
+            // Solve L Y = B, then L^H X = Y.
+            for (int64_t j = 0; j < n; ++j) {
+                B( j, c ) /= real( A( j, j ) );
+                scalar_t bj = B( j, c );
+                for (int64_t i = j+1; i < n; ++i)
+                    B( i, c ) -= A( i, j ) * bj;
+            }
+            for (int64_t j = n-1; j >= 0; --j) {
+                scalar_t s = B( j, c );
+                for (int64_t i = j+1; i < n; ++i)
+                    s -= conj( A( i, j ) ) * B( i, c );
+                B( j, c ) = s / real( A( j, j ) );
+            }
+        }
+        else {
+            // Solve U^H Y = B, then U X = Y.
+            for (int64_t j = 0; j < n; ++j) {
+                scalar_t s = B( j, c );
+                for (int64_t i = 0; i < j; ++i)
+                    s -= conj( A( i, j ) ) * B( i, c );
+                B( j, c ) = s / real( A( j, j ) );
+            }
+            for (int64_t j = n-1; j >= 0; --j) {
+                B( j, c ) /= real( A( j, j ) );
+                scalar_t bj = B( j, c );
+                for (int64_t i = 0; i < j; ++i)
+                    B( i, c ) -= A( i, j ) * bj;
+            }
+        }
+    }
+
+    #undef A
+    #undef B
+}
+
+//------------------------------------------------------------------------------
+/// Generates an elementary reflector H such that H^H [alpha; x] = [beta; 0],
+/// as in LAPACK larfg, for a vector of length n stored contiguously.
+/// If the sum of squares may have under- or overflowed, defers to
+/// lapack::larfg, which rescales.
+template <typename scalar_t>
+void larfg_unblocked(
+    int64_t n, scalar_t* alpha, scalar_t* x, scalar_t* tau )
+{
+    using blas::real;
+    using blas::imag;
+    using blas::conj;
+    using real_t = blas::real_type<scalar_t>;
+
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const real_t safe_min = std::numeric_limits<real_t>::min() / eps;
+    const real_t safe_max = std::numeric_limits<real_t>::max() * eps;
+
+    if (n <= 0) {
+        *tau = 0;
+        return;
+    }
+
+    real_t ssq = 0;
+    for (int64_t i = 0; i < n-1; ++i)
+        ssq += real( x[ i ] * conj( x[ i ] ) );
+
+    real_t alphr = real( *alpha );
+    real_t alphi = imag( *alpha );
+    if (ssq == 0 && alphi == 0) {
+        *tau = 0;
+        return;
+    }
+
+    real_t beta2 = alphr*alphr + alphi*alphi + ssq;
+    if (! (beta2 >= safe_min && beta2 <= safe_max)) {
+        lapack::larfg( n, alpha, x, 1, tau );
+        return;
+    }
+
+    real_t beta = -std::copysign( std::sqrt( beta2 ), alphr );
+    *tau = blas::make_scalar<scalar_t>( (beta - alphr) / beta, -alphi / beta );
+    scalar_t scal = scalar_t( 1 ) / (*alpha - beta);
+    for (int64_t i = 0; i < n-1; ++i)
+        x[ i ] *= scal;
+    *alpha = beta;
+}
+
+//------------------------------------------------------------------------------
+/// Unblocked QR factorization of one m-by-n matrix, as in LAPACK geqr2.
+template <int64_t N, typename scalar_t>
+void geqrf_unblocked(
+    int64_t m_, int64_t n_,
+    scalar_t* A, int64_t lda,
+    scalar_t* tau )
+{
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+
+    using blas::conj;
+
+    const int64_t m = (N > 0 ? N : m_);
+    const int64_t n = (N > 0 ? N : n_);
+    const int64_t minmn = std::min( m, n );
+
+    for (int64_t j = 0; j < minmn; ++j) {
+        // Generate H(j) to annihilate A(j+1:m, j).
+        larfg_unblocked( m - j, &A( j, j ), &A( std::min( j+1, m-1 ), j ),
+                         &tau[ j ] );
+
+        // Apply H(j)^H = I - conj(tau) v v^H to A(j:m, j+1:n) from the left,
+        // where v = [ 1; A(j+1:m, j) ].
+        scalar_t ctau = conj( tau[ j ] );
+        if (ctau != scalar_t( 0 )) {
+            for (int64_t k = j+1; k < n; ++k) {
+                scalar_t w = A( j, k );
+                for (int64_t i = j+1; i < m; ++i)
+                    w += conj( A( i, j ) ) * A( i, k );
+                w *= ctau;
+                A( j, k ) -= w;
+                for (int64_t i = j+1; i < m; ++i)
+                    A( i, k ) -= A( i, j ) * w;
+            }
+        }
+    }
+
+    #undef A
+}
+
+}  // namespace impl
+}  // namespace lapack
+
+#endif // LAPACK_BATCH_KERNELS_HH
@@ -0,0 +1,176 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "batch_kernels.hh"
+
+#include <vector>
+
+namespace lapack {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Selects the potrf kernel for a uniform-size batch.
+template <typename scalar_t>
+auto potrf_kernel( int64_t n )
+    -> int64_t (*)( lapack::Uplo, int64_t, scalar_t*, int64_t )
+{
+    switch (n) {
+        case  8: return potrf_unblocked<  8, scalar_t >;
+        case 16: return potrf_unblocked< 16, scalar_t >;
+        case 32: return potrf_unblocked< 32, scalar_t >;
+    }
+    return potrf_unblocked< 0, scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched version.
+/// Mid-level templated wrapper checks arguments, then factors the
+/// matrices in parallel using unblocked kernels.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrf(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<scalar_t*>  const& Aarray, std::vector<int64_t> const& lda,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    batch_check_size( uplo, batch_size );
+    batch_check_size( n,    batch_size );
+    batch_check_size( lda,  batch_size );
+    lapack_error_if( Aarray.size() < batch_size );
+    lapack_error_if( info.size() != batch_size );
+
+    for (size_t i = 0; i < batch_size; ++i) {
+        lapack::Uplo uplo_ = blas::batch::extract( uplo, i );
+        int64_t n_   = blas::batch::extract( n,   i );
+        int64_t lda_ = blas::batch::extract( lda, i );
+        lapack_error_if( uplo_ != Uplo::Lower && uplo_ != Uplo::Upper );
+        lapack_error_if( n_ < 0 );
+        lapack_error_if( lda_ < std::max( int64_t( 1 ), n_ ) );
+    }
+
+    if (n.size() == 1 && lda.size() == 1) {
+        // Uniform size: select the kernel once for the whole batch.
+        auto kernel = potrf_kernel<scalar_t>( n[0] );
+        #pragma omp parallel for schedule( static )
+        for (size_t i = 0; i < batch_size; ++i) {
+            info[ i ] = kernel( blas::batch::extract( uplo, i ), n[0],
+                                Aarray[ i ], lda[0] );
+        }
+    }
+    else {
+        #pragma omp parallel for schedule( dynamic )
+        for (size_t i = 0; i < batch_size; ++i) {
+            info[ i ] = potrf_unblocked< 0, scalar_t >(
+                blas::batch::extract( uplo, i ),
+                blas::batch::extract( n,    i ),
+                Aarray[ i ], blas::batch::extract( lda, i ) );
+        }
+    }
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+namespace batch {
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, float version.
+/// @ingroup posv_computational
+void potrf(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<float*>     const& Aarray, std::vector<int64_t> const& lda,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::potrf( uplo, n, Aarray, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, double version.
+/// @ingroup posv_computational
+void potrf(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<double*>    const& Aarray, std::vector<int64_t> const& lda,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::potrf( uplo, n, Aarray, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, complex<float> version.
+/// @ingroup posv_computational
+void potrf(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector<int64_t> const& lda,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::potrf( uplo, n, Aarray, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the Cholesky factorizations of a batch of Hermitian positive
+/// definite matrices, $A_i = U_i^H U_i$ or $A_i = L_i L_i^H$,
+/// for i = 0, ..., batch_size-1.
+///
+/// Intended for many small matrices (up to a few hundred rows):
+/// matrices are factored in parallel with OpenMP over the batch, each by
+/// an unblocked kernel that does not call BLAS, so there is no nested
+/// BLAS threading. If n and lda each have a single entry, all matrices
+/// have the same size and a kernel specialized for that size is used
+/// when available.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each A_i is stored.
+///     Either 1 entry, shared by all matrices, or batch_size entries.
+///
+/// @param[in] n
+///     Order of each matrix A_i. n[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Aarray[i] is the n_i-by-n_i
+///     Hermitian matrix A_i, stored in an lda_i-by-n_i array.
+///     On exit, if info[i] = 0, the factor U_i or L_i.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda[i] >= max(1, n[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in] batch_size
+///     Number of matrices in the batch.
+///
+/// @param[out] info
+///     Vector of length batch_size. info[i] is the potrf return value
+///     for A_i: 0 on success, or j > 0 if the leading minor of order j
+///     is not positive definite.
+///
+/// @ingroup posv_computational
+void potrf(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector<int64_t> const& lda,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::potrf( uplo, n, Aarray, lda, batch_size, info );
+}
+
+}  // namespace batch
+}  // namespace lapack
@@ -0,0 +1,191 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "batch_kernels.hh"
+
+#include <vector>
+
+namespace lapack {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Selects the potrs kernel for a uniform-size batch.
+template <typename scalar_t>
+auto potrs_kernel( int64_t n )
+    -> void (*)( lapack::Uplo, int64_t, int64_t, scalar_t const*, int64_t,
+                 scalar_t*, int64_t )
+{
+    switch (n) {
+        case  8: return potrs_unblocked<  8, scalar_t >;
+        case 16: return potrs_unblocked< 16, scalar_t >;
+        case 32: return potrs_unblocked< 32, scalar_t >;
+    }
+    return potrs_unblocked< 0, scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched version.
+/// Mid-level templated wrapper checks arguments, then solves the
+/// systems in parallel using unblocked kernels.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrs(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector<scalar_t*>  const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<scalar_t*>  const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size )
+{
+    batch_check_size( uplo, batch_size );
+    batch_check_size( n,    batch_size );
+    batch_check_size( nrhs, batch_size );
+    batch_check_size( lda,  batch_size );
+    batch_check_size( ldb,  batch_size );
+    lapack_error_if( Aarray.size() < batch_size );
+    lapack_error_if( Barray.size() < batch_size );
+
+    for (size_t i = 0; i < batch_size; ++i) {
+        lapack::Uplo uplo_ = blas::batch::extract( uplo, i );
+        int64_t n_    = blas::batch::extract( n,    i );
+        int64_t nrhs_ = blas::batch::extract( nrhs, i );
+        int64_t lda_  = blas::batch::extract( lda,  i );
+        int64_t ldb_  = blas::batch::extract( ldb,  i );
+        lapack_error_if( uplo_ != Uplo::Lower && uplo_ != Uplo::Upper );
+        lapack_error_if( n_ < 0 );
+        lapack_error_if( nrhs_ < 0 );
+        lapack_error_if( lda_ < std::max( int64_t( 1 ), n_ ) );
+        lapack_error_if( ldb_ < std::max( int64_t( 1 ), n_ ) );
+    }
+
+    if (n.size() == 1 && lda.size() == 1) {
+        // Uniform size: select the kernel once for the whole batch.
+        auto kernel = potrs_kernel<scalar_t>( n[0] );
+        #pragma omp parallel for schedule( static )
+        for (size_t i = 0; i < batch_size; ++i) {
+            kernel( blas::batch::extract( uplo, i ), n[0],
+                    blas::batch::extract( nrhs, i ),
+                    Aarray[ i ], lda[0],
+                    Barray[ i ], blas::batch::extract( ldb, i ) );
+        }
+    }
+    else {
+        #pragma omp parallel for schedule( dynamic )
+        for (size_t i = 0; i < batch_size; ++i) {
+            potrs_unblocked< 0, scalar_t >(
+                blas::batch::extract( uplo, i ),
+                blas::batch::extract( n,    i ),
+                blas::batch::extract( nrhs, i ),
+                Aarray[ i ], blas::batch::extract( lda, i ),
+                Barray[ i ], blas::batch::extract( ldb, i ) );
+        }
+    }
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+namespace batch {
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, float version.
+/// @ingroup posv_computational
+void potrs(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector<float*>     const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<float*>     const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size )
+{
+    impl::potrs( uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, double version.
+/// @ingroup posv_computational
+void potrs(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector<double*>    const& Aarray, std::vector<int64_t> const& lda,
+    std::vector<double*>    const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size )
+{
+    impl::potrs( uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, complex<float> version.
+/// @ingroup posv_computational
+void potrs(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size )
+{
+    impl::potrs( uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations $A_i X_i = B_i$,
+/// for i = 0, ..., batch_size-1, with Hermitian positive definite A_i,
+/// using the Cholesky factorizations computed by lapack::batch::potrf.
+///
+/// Systems are solved in parallel with OpenMP over the batch, each by an
+/// unblocked kernel that does not call BLAS.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the factor U_i or L_i is stored in A_i.
+///     Either 1 entry, shared by all matrices, or batch_size entries.
+///
+/// @param[in] n
+///     Order of each matrix A_i. n[i] >= 0.
+///
+/// @param[in] nrhs
+///     Number of right hand sides of each system. nrhs[i] >= 0.
+///
+/// @param[in] Aarray
+///     Array of batch_size pointers to the Cholesky factors
+///     from lapack::batch::potrf.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda[i] >= max(1, n[i]).
+///
+/// @param[in,out] Barray
+///     Array of batch_size pointers. On entry, Barray[i] is the
+///     n_i-by-nrhs_i right hand side matrix B_i;
+///     on exit, the solution matrix X_i.
+///
+/// @param[in] ldb
+///     Leading dimension of each B_i. ldb[i] >= max(1, n[i]).
+///
+/// @param[in] batch_size
+///     Number of systems in the batch.
+///
+/// @ingroup posv_computational
+void potrs(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t>    const& n,
+    std::vector<int64_t>    const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector<int64_t> const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector<int64_t> const& ldb,
+    size_t batch_size )
+{
+    impl::potrs( uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size );
+}
+
+}  // namespace batch
+}  // namespace lapack
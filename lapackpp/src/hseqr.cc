@@ -154,7 +154,7 @@ int64_t hseqr(
     }
     // merge split-complex representation
     for (int64_t i = 0; i < n; ++i) {
-        W[i] = std::complex<float>( WR[i], WI[i] );
+        W[i] = std::complex<double>( WR[i], WI[i] );
     }
     return info_;
 }
@@ -91,6 +91,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "getrf",              test_getrf,     Section::gesv },
     { "gbtrf",              test_gbtrf,     Section::gesv },
     { "gttrf",              test_gttrf,     Section::gesv },
+    { "batch-getrf",        test_batch_getrf, Section::gesv },
     { "",                   nullptr,        Section::newline },
 
     { "getrs",              test_getrs,     Section::gesv },
@@ -127,6 +128,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "pptrf",              test_pptrf,     Section::posv },
     { "pbtrf",              test_pbtrf,     Section::posv },
     { "pttrf",              test_pttrf,     Section::posv },
+    { "batch-potrf",        test_batch_potrf, Section::posv },
     { "",                   nullptr,        Section::newline },
 
     { "potrs",              test_potrs,     Section::posv },
@@ -248,6 +250,7 @@ std::vector< testsweeper::routines_t > routines = {
     // QR, LQ, RQ, QL
     { "geqr",               test_geqr,      Section::qr }, // tested numerically
     { "geqrf",              test_geqrf,     Section::qr }, // tested numerically
+    { "batch-geqrf",        test_batch_geqrf, Section::qr }, // tested numerically
     { "gelqf",              test_gelqf,     Section::qr }, // tested numerically
     { "geqlf",              test_geqlf,     Section::qr }, // tested numerically
     { "gerqf",              test_gerqf,     Section::qr }, // tested numerically; R, Q are full sizeof(A), could be smaller
@@ -529,6 +532,8 @@ Params::Params():
     ku        ( "ku",      6,    ParamType::List, 100,     0, 1000000, "upper bandwidth" ),
     nrhs      ( "nrhs",    6,    ParamType::List,  10,     0, 1000000, "number of right hand sides" ),
     nb        ( "nb",      4,    ParamType::List,  64,     0, 1000000, "block size" ),
+    batch     ( "batch",   6,    ParamType::List, 100,     0, 1000000, "batch size" ),
+    vary      ( "vary",    4,    ParamType::List, 'n',  "ny", "vary matrix sizes within a batch, from n down to n/2" ),
     vl        ( "vl",      7, 2, ParamType::List, -inf, -inf,     inf, "lower bound of eigen/singular values to find" ),
     vu        ( "vu",      7, 2, ParamType::List,  inf, -inf,     inf, "upper bound of eigen/singular values to find" ),
 
@@ -85,6 +85,8 @@ public:
     testsweeper::ParamInt    ku;
     testsweeper::ParamInt    nrhs;
     testsweeper::ParamInt    nb;
+    testsweeper::ParamInt    batch;
+    testsweeper::ParamChar   vary;
     testsweeper::ParamDouble vl;
     testsweeper::ParamDouble vu;
     testsweeper::ParamInt    il;
@@ -470,4 +472,10 @@ void test_potrf_device ( Params& params, bool run );
 void test_getrf_device ( Params& params, bool run );
 void test_geqrf_device ( Params& params, bool run );
 
+//----------------------------------------
+// Host batched functions
+void test_batch_getrf ( Params& params, bool run );
+void test_batch_potrf ( Params& params, bool run );
+void test_batch_geqrf ( Params& params, bool run );
+
 #endif  //  #ifndef TEST_HH
@@ -0,0 +1,194 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_batch_geqrf_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    size_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.ortho();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_tau = (size_t) blas::min( m, n );
+    int64_t minmn = blas::min( m, n );
+
+    std::vector< scalar_t > A_tst( batch * size_A );
+    std::vector< scalar_t > A_ref( batch * size_A );
+    std::vector< scalar_t > tau_tst( batch * size_tau );
+    std::vector< scalar_t > tau_ref( batch * size_tau );
+
+    std::vector< scalar_t* > Aarray( batch );
+    std::vector< scalar_t* > tau_array( batch );
+    for (size_t i = 0; i < batch; ++i) {
+        Aarray[ i ] = &A_tst[ i * size_A ];
+        tau_array[ i ] = &tau_tst[ i * size_tau ];
+        lapack::generate_matrix( params.matrix, m, n, Aarray[ i ], lda );
+    }
+    A_ref = A_tst;
+
+    // wrap scalar arguments in std::vector
+    std::vector< int64_t > m_vec( 1, m );
+    std::vector< int64_t > n_vec( 1, n );
+    std::vector< int64_t > lda_vec( 1, lda );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A[0] = " ); print_matrix( m, n, Aarray[ 0 ], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > neg( 1, -1 );
+        std::vector< int64_t > small( 1, m-1 );
+        assert_throw( lapack::batch::geqrf( neg,   n_vec, Aarray, lda_vec, tau_array, batch ), lapack::Error );
+        assert_throw( lapack::batch::geqrf( m_vec, neg,   Aarray, lda_vec, tau_array, batch ), lapack::Error );
+        assert_throw( lapack::batch::geqrf( m_vec, n_vec, Aarray, small,   tau_array, batch ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::batch::geqrf( m_vec, n_vec, Aarray, lda_vec, tau_array, batch );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::geqrf( m, n );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "A_factor[0] = " ); print_matrix( m, n, Aarray[ 0 ], lda );
+        printf( "tau[0] = " ); print_matrix( 1, minmn, tau_array[ 0 ], 1 );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Following lapack/TESTING/LIN/zqrt01.f but using smaller Q and R,
+        // as in test_geqrf_device; max over the batch.
+        int64_t ldq = m;
+        std::vector< scalar_t > Q( m * minmn ); // m by k
+        int64_t ldr = minmn;
+        std::vector< scalar_t > R( minmn * n ); // k by n
+
+        real_t error1 = 0;
+        real_t error2 = 0;
+        for (size_t i = 0; i < batch; ++i) {
+            scalar_t* Ai_ref = &A_ref[ i * size_A ];
+
+            // Copy details of Q
+            real_t rogue = -10000000000; // -1D+10
+            lapack::laset( lapack::MatrixType::General, m, minmn, rogue, rogue, &Q[0], ldq );
+            lapack::lacpy( lapack::MatrixType::Lower, m, minmn, Aarray[ i ], lda, &Q[0], ldq );
+
+            // Generate the m-by-k matrix Q
+            int64_t info_ungqr = lapack::ungqr( m, minmn, minmn, &Q[0], ldq, tau_array[ i ] );
+            if (info_ungqr != 0) {
+                fprintf( stderr, "lapack::ungqr returned error %lld\n", llong( info_ungqr ) );
+            }
+
+            // Copy R
+            lapack::laset( lapack::MatrixType::Lower, minmn, n, 0.0, 0.0, &R[0], ldr );
+            lapack::lacpy( lapack::MatrixType::Upper, minmn, n, Aarray[ i ], lda, &R[0], ldr );
+
+            // Compute R - Q'*A
+            blas::gemm( blas::Layout::ColMajor,
+                        blas::Op::ConjTrans, blas::Op::NoTrans, minmn, n, m,
+                        -1.0, &Q[0], ldq, Ai_ref, lda, 1.0, &R[0], ldr );
+
+            // Compute norm( R - Q'*A ) / ( N * norm(A) )
+            real_t Anorm = lapack::lange( lapack::Norm::One, m, n, Ai_ref, lda );
+            real_t resid1 = lapack::lange( lapack::Norm::One, minmn, n, &R[0], ldr );
+            if (Anorm > 0)
+                error1 = blas::max( error1, resid1 / (n * Anorm) );
+
+            // Compute norm( I - Q'*Q ) / N
+            lapack::laset( lapack::MatrixType::Upper, minmn, minmn, 0.0, 1.0, &R[0], ldr );
+            blas::herk( blas::Layout::ColMajor, blas::Uplo::Upper, blas::Op::ConjTrans,
+                        minmn, m, -1.0, &Q[0], ldq, 1.0, &R[0], ldr );
+            real_t resid2 = lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper, minmn, &R[0], ldr );
+            error2 = blas::max( error2, resid2 / n );
+        }
+
+        params.error() = error1;
+        params.ortho() = error2;
+        params.okay() = (error1 < tol) && (error2 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (size_t i = 0; i < batch; ++i) {
+            int64_t info_ref = LAPACKE_geqrf( m, n, &A_ref[ i * size_A ], lda,
+                                              &tau_ref[ i * size_tau ] );
+            if (info_ref != 0) {
+                fprintf( stderr, "LAPACKE_geqrf returned error %lld\n", llong( info_ref ) );
+            }
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_geqrf( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_batch_geqrf_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_batch_geqrf_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_batch_geqrf_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_batch_geqrf_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
@@ -0,0 +1,205 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_batch_getrf_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    size_t batch = params.batch();
+    lapack::Op trans = params.trans();
+    bool vary = params.vary() == 'y';
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_ipiv = (size_t) n;
+
+    std::vector< scalar_t > A_tst( batch * size_A );
+    std::vector< scalar_t > A_ref( batch * size_A );
+    std::vector< int64_t > ipiv_tst( batch * size_ipiv );
+    std::vector< lapack_int > ipiv_ref( batch * size_ipiv );
+
+    std::vector< scalar_t* > Aarray( batch );
+    std::vector< int64_t* > ipiv_array( batch );
+    // With vary, matrix i has order n - (i % 5) n/8, from n down to n/2,
+    // so the batch takes the variable-size path.
+    std::vector< int64_t > n_vec( 1, n );
+    if (vary) {
+        n_vec.resize( batch );
+        for (size_t i = 0; i < batch; ++i)
+            n_vec[ i ] = n - (i % 5) * (n / 8);
+    }
+    auto n_i = [&n_vec]( size_t i ) {
+        return n_vec.size() == 1 ? n_vec[ 0 ] : n_vec[ i ];
+    };
+
+    for (size_t i = 0; i < batch; ++i) {
+        Aarray[ i ] = &A_tst[ i * size_A ];
+        ipiv_array[ i ] = &ipiv_tst[ i * size_ipiv ];
+        lapack::generate_matrix( params.matrix, n_i( i ), n_i( i ),
+                                 Aarray[ i ], lda );
+    }
+    A_ref = A_tst;
+
+    // wrap scalar arguments in std::vector
+    std::vector< int64_t > lda_vec( 1, lda );
+    std::vector< int64_t > info( batch );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A[0] = " ); print_matrix( n, n, Aarray[ 0 ], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > neg( 1, -1 );
+        std::vector< int64_t > small( 1, n-1 );
+        assert_throw( lapack::batch::getrf( neg,   n_vec, Aarray, lda_vec, ipiv_array, batch, info ), lapack::Error );
+        assert_throw( lapack::batch::getrf( n_vec, neg,   Aarray, lda_vec, ipiv_array, batch, info ), lapack::Error );
+        assert_throw( lapack::batch::getrf( n_vec, n_vec, Aarray, small,   ipiv_array, batch, info ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::batch::getrf( n_vec, n_vec, Aarray, lda_vec, ipiv_array,
+                          batch, info );
+    time = testsweeper::get_wtime() - time;
+    for (size_t i = 0; i < batch; ++i) {
+        if (info[ i ] != 0) {
+            fprintf( stderr, "lapack::batch::getrf returned error %lld for matrix %lld\n",
+                     llong( info[ i ] ), llong( i ) );
+        }
+    }
+
+    params.time() = time;
+    double gflop = 0;
+    for (size_t i = 0; i < batch; ++i)
+        gflop += lapack::Gflop< scalar_t >::getrf( n_i( i ), n_i( i ) );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "A_factor[0] = " ); print_matrix( n, n, Aarray[ 0 ], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - op(A) x|| / (n * ||A|| * ||x||),
+        // solving with lapack::batch::getrs; max over the batch.
+        int64_t nrhs = 1;
+        int64_t ldb = roundup( blas::max( 1, n ), align );
+        size_t size_B = (size_t) ldb * nrhs;
+        std::vector< scalar_t > B_tst( batch * size_B );
+        std::vector< scalar_t > B_ref( batch * size_B );
+        int64_t idist = 1;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+        B_ref = B_tst;
+
+        std::vector< scalar_t* > Barray( batch );
+        for (size_t i = 0; i < batch; ++i)
+            Barray[ i ] = &B_tst[ i * size_B ];
+
+        lapack::batch::getrs( { trans }, n_vec, { nrhs },
+                              Aarray, lda_vec, ipiv_array,
+                              Barray, { ldb }, batch );
+
+        real_t error = 0;
+        for (size_t i = 0; i < batch; ++i) {
+            scalar_t* Ai_ref = &A_ref[ i * size_A ];
+            scalar_t* Bi_ref = &B_ref[ i * size_B ];
+            int64_t ni = n_i( i );
+            if (ni == 0)
+                continue;
+            blas::gemm( blas::Layout::ColMajor, trans, blas::Op::NoTrans,
+                        ni, nrhs, ni,
+                        -1.0, Ai_ref, lda,
+                              Barray[ i ], ldb,
+                         1.0, Bi_ref, ldb );
+
+            real_t err   = lapack::lange( lapack::Norm::One, ni, nrhs, Bi_ref, ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, ni, nrhs, Barray[ i ], ldb );
+            real_t Anorm = lapack::lange( lapack::Norm::One, ni, ni,   Ai_ref, lda );
+            error = blas::max( error, err / (ni * Anorm * Xnorm) );
+        }
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (size_t i = 0; i < batch; ++i) {
+            int64_t info_ref = LAPACKE_getrf( n_i( i ), n_i( i ),
+                                              &A_ref[ i * size_A ], lda,
+                                              &ipiv_ref[ i * size_ipiv ] );
+            if (info_ref != 0) {
+                fprintf( stderr, "LAPACKE_getrf returned error %lld\n", llong( info_ref ) );
+            }
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_getrf( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_batch_getrf_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_batch_getrf_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_batch_getrf_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_batch_getrf_work< std::complex<double> >( params, run );
+            break;
+    }
+}
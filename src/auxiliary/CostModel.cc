@@ -0,0 +1,333 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/CostModel.hh"
+#include "slate/internal/openmp.hh"
+#include "slate/Exception.hh"
+
+#include <blas.hh>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace slate {
+
+bool CostModel::enabled_ = false;
+MachineParams CostModel::machine_;
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Returns depth of a binomial broadcast or reduction tree over n ranks.
+///
+double tree_depth( int n )
+{
+    return n > 1 ? std::ceil( std::log2( n ) ) : 0;
+}
+
+//------------------------------------------------------------------------------
+/// Returns predicted time from flops over all ranks, and messages and words
+/// along the critical path of one rank.
+///
+double predict( double flops, double messages, double words,
+                int p, int q, int elem_size )
+{
+    auto& machine = CostModel::machine();
+    return flops / (p * q * machine.gflops * 1e9)
+           + messages * machine.latency
+           + words * elem_size / machine.bandwidth;
+}
+
+//------------------------------------------------------------------------------
+/// Reads machine parameters from file.
+/// @return true on success.
+///
+bool read_params( std::string const& file_name, MachineParams* params )
+{
+    if (file_name.empty())
+        return false;
+    FILE* file = fopen( file_name.c_str(), "r" );
+    if (file == nullptr)
+        return false;
+    MachineParams tmp;
+    int cnt = fscanf( file, "%lf %lf %lf",
+                      &tmp.gflops, &tmp.latency, &tmp.bandwidth );
+    fclose( file );
+    if (cnt != 3 || tmp.gflops <= 0 || tmp.latency < 0 || tmp.bandwidth <= 0)
+        return false;
+    *params = tmp;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// Writes machine parameters to file; failure is ignored.
+///
+void write_params( std::string const& file_name, MachineParams const& params )
+{
+    if (file_name.empty())
+        return;
+    FILE* file = fopen( file_name.c_str(), "w" );
+    if (file == nullptr)
+        return;
+    fprintf( file, "%.6e %.6e %.6e\n"
+             "# gemm Gflop/s per rank, latency (s), bandwidth (bytes/s)\n",
+             params.gflops, params.latency, params.bandwidth );
+    fclose( file );
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+/// Returns the machine parameters set by machine( params ) or calibrate(),
+/// else defaults.
+///
+MachineParams const& CostModel::machine()
+{
+    return machine_;
+}
+
+//------------------------------------------------------------------------------
+/// Sets the machine parameters, e.g., measured by the application, and
+/// enables the model. The application must set the same parameters on all
+/// ranks, else ranks may select different methods and deadlock.
+///
+void CostModel::machine( MachineParams const& params )
+{
+    #pragma omp critical(slate_cost_model)
+    {
+        machine_ = params;
+        enabled_ = true;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return true if machine( params ) or calibrate() was called, so
+/// select_algo uses the model; else it uses its fixed heuristics.
+///
+bool CostModel::enabled()
+{
+    return enabled_;
+}
+
+//------------------------------------------------------------------------------
+/// Disables the model and restores default parameters, so select_algo uses
+/// its fixed heuristics again.
+///
+void CostModel::disable()
+{
+    #pragma omp critical(slate_cost_model)
+    {
+        machine_ = MachineParams();
+        enabled_ = false;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Returns the calibration cache file: $SLATE_CALIBRATION_FILE if set,
+/// else $HOME/.slate_calibration, else empty (no caching).
+///
+std::string CostModel::cacheFile()
+{
+    const char* env = getenv( "SLATE_CALIBRATION_FILE" );
+    if (env != nullptr)
+        return env;
+    env = getenv( "HOME" );
+    if (env != nullptr)
+        return std::string( env ) + "/.slate_calibration";
+    return "";
+}
+
+//------------------------------------------------------------------------------
+/// Sets machine parameters from cacheFile() on rank 0 if it exists.
+/// Otherwise, measures them and writes cacheFile():
+/// - gemm rate: all threads of rank 0 each multiply 256 x 256 matrices,
+///   as tasks do on tiles;
+/// - latency and bandwidth: ping-pong of 8 bytes and 1 MiB between
+///   ranks 0 and 1.
+/// The result is broadcast, so all ranks in comm get the same parameters,
+/// and the model is enabled. Collective on comm.
+///
+void CostModel::calibrate( MPI_Comm comm )
+{
+    int mpi_rank, mpi_size;
+    slate_mpi_call(
+        MPI_Comm_rank( comm, &mpi_rank ) );
+    slate_mpi_call(
+        MPI_Comm_size( comm, &mpi_size ) );
+
+    MachineParams params;
+    int found = 0;
+    if (mpi_rank == 0)
+        found = read_params( cacheFile(), &params );
+    slate_mpi_call(
+        MPI_Bcast( &found, 1, MPI_INT, 0, comm ) );
+
+    if (! found) {
+        if (mpi_rank == 0) {
+            const int64_t n = 256;
+            const int repeat = 4;
+            double time = 0;
+            int num_threads = 1;
+            #pragma omp parallel
+            {
+                std::vector<double> A( n*n, 1.0 ), B( n*n, 1.0 ), C( n*n );
+                #pragma omp master
+                num_threads = omp_get_num_threads();
+                #pragma omp barrier
+                double t = omp_get_wtime();
+                for (int i = 0; i < repeat; ++i) {
+                    blas::gemm( blas::Layout::ColMajor,
+                                blas::Op::NoTrans, blas::Op::NoTrans,
+                                n, n, n, 1.0, A.data(), n, B.data(), n,
+                                0.0, C.data(), n );
+                }
+                #pragma omp barrier
+                #pragma omp master
+                time = omp_get_wtime() - t;
+            }
+            params.gflops = 2e-9 * n*n*n * repeat * num_threads / time;
+        }
+
+        if (mpi_size > 1 && mpi_rank <= 1) {
+            const int repeat = 20;
+            const int64_t large = 1024*1024;
+            std::vector<char> buffer( large );
+            int other = 1 - mpi_rank;
+            double time[ 2 ];
+            int64_t sizes[ 2 ] = { 8, large };
+            for (int s = 0; s < 2; ++s) {
+                double t = MPI_Wtime();
+                for (int i = 0; i < repeat; ++i) {
+                    if (mpi_rank == 0) {
+                        slate_mpi_call(
+                            MPI_Send( buffer.data(), sizes[ s ], MPI_CHAR,
+                                      other, 0, comm ) );
+                        slate_mpi_call(
+                            MPI_Recv( buffer.data(), sizes[ s ], MPI_CHAR,
+                                      other, 0, comm, MPI_STATUS_IGNORE ) );
+                    }
+                    else {
+                        slate_mpi_call(
+                            MPI_Recv( buffer.data(), sizes[ s ], MPI_CHAR,
+                                      other, 0, comm, MPI_STATUS_IGNORE ) );
+                        slate_mpi_call(
+                            MPI_Send( buffer.data(), sizes[ s ], MPI_CHAR,
+                                      other, 0, comm ) );
+                    }
+                }
+                time[ s ] = (MPI_Wtime() - t) / (2*repeat);
+            }
+            params.latency = time[ 0 ];
+            if (time[ 1 ] > time[ 0 ])
+                params.bandwidth = large / (time[ 1 ] - time[ 0 ]);
+        }
+
+        if (mpi_rank == 0)
+            write_params( cacheFile(), params );
+    }
+
+    double values[ 3 ] = { params.gflops, params.latency, params.bandwidth };
+    slate_mpi_call(
+        MPI_Bcast( values, 3, MPI_DOUBLE, 0, comm ) );
+    params.gflops    = values[ 0 ];
+    params.latency   = values[ 1 ];
+    params.bandwidth = values[ 2 ];
+    machine( params );
+}
+
+//------------------------------------------------------------------------------
+/// Predicted time of gemmA, C = A B with A stationary, where op(A) is m-by-k
+/// and op(B) is k-by-n. Each block row B(k, :) is broadcast to the p ranks
+/// owning A(:, k); partial products are reduced across the q ranks of each
+/// row to C.
+///
+double CostModel::gemmA(
+    int64_t m, int64_t n, int64_t k, int p, int q, int64_t nb, int elem_size )
+{
+    double mt = std::ceil( double( m ) / nb );
+    double nt = std::ceil( double( n ) / nb );
+    double kt = std::ceil( double( k ) / nb );
+    double flops = 2. * m * n * k;
+    double words = (p*q > 1 ? double( k ) * n / q : 0)
+                 + double( m ) * n / p * tree_depth( q );
+    double messages = kt / q * nt * tree_depth( p )
+                    + mt / p * nt * tree_depth( q );
+    return predict( flops, messages, words, p, q, elem_size );
+}
+
+//------------------------------------------------------------------------------
+/// Predicted time of gemmC, C = A B with C stationary. Each step broadcasts
+/// block column A(:, k) across the q ranks of each row and block row
+/// B(k, :) down the p ranks of each column.
+///
+double CostModel::gemmC(
+    int64_t m, int64_t n, int64_t k, int p, int q, int64_t nb, int elem_size )
+{
+    double mt = std::ceil( double( m ) / nb );
+    double nt = std::ceil( double( n ) / nb );
+    double kt = std::ceil( double( k ) / nb );
+    double flops = 2. * m * n * k;
+    double words = (q > 1 ? double( m ) * k / p : 0)
+                 + (p > 1 ? double( k ) * n / q : 0);
+    double messages = kt * (mt / p * tree_depth( q )
+                            + nt / q * tree_depth( p ));
+    return predict( flops, messages, words, p, q, elem_size );
+}
+
+//------------------------------------------------------------------------------
+/// Predicted time of herkC, C = A A^H with C stationary, where C is n-by-n
+/// and A is n-by-k. Like gemmC with half the flops.
+///
+double CostModel::herkC(
+    int64_t n, int64_t k, int p, int q, int64_t nb, int elem_size )
+{
+    double nt = std::ceil( double( n ) / nb );
+    double kt = std::ceil( double( k ) / nb );
+    double flops = 1. * n * n * k;
+    double words = (q > 1 ? double( n ) * k / p : 0)
+                 + (p > 1 ? double( k ) * n / q : 0);
+    double messages = kt * (nt / p * tree_depth( q )
+                            + nt / q * tree_depth( p ));
+    return predict( flops, messages, words, p, q, elem_size );
+}
+
+//------------------------------------------------------------------------------
+/// Predicted time of trsmA, solving A X = B with A stationary, where A is
+/// m-by-m and B is m-by-n. Like gemmA with k = m and half the flops.
+///
+double CostModel::trsmA(
+    int64_t m, int64_t n, int p, int q, int64_t nb, int elem_size )
+{
+    double mt = std::ceil( double( m ) / nb );
+    double nt = std::ceil( double( n ) / nb );
+    double flops = 1. * m * m * n;
+    double words = (p*q > 1 ? double( m ) * n / q : 0)
+                 + double( m ) * n / p * tree_depth( q );
+    double messages = mt / q * nt * tree_depth( p )
+                    + mt / p * nt * tree_depth( q );
+    return predict( flops, messages, words, p, q, elem_size );
+}
+
+//------------------------------------------------------------------------------
+/// Predicted time of trsmB, solving A X = B with B stationary, where A is
+/// m-by-m and B is m-by-n. Like gemmC with k = m, half of A, and half
+/// the flops.
+///
+double CostModel::trsmB(
+    int64_t m, int64_t n, int p, int q, int64_t nb, int elem_size )
+{
+    double mt = std::ceil( double( m ) / nb );
+    double nt = std::ceil( double( n ) / nb );
+    double flops = 1. * m * m * n;
+    double words = (q > 1 ? 0.5 * m * m / p : 0)
+                 + (p > 1 ? double( m ) * n / q : 0);
+    double messages = mt * (0.5 * mt / p * tree_depth( q )
+                            + nt / q * tree_depth( p ));
+    return predict( flops, messages, words, p, q, elem_size );
+}
+
+} // namespace slate
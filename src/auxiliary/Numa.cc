@@ -0,0 +1,153 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "auxiliary/Numa.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined( __linux__ )
+    #include <dirent.h>
+    #include <sched.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace slate {
+namespace internal {
+namespace numa {
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Map from cpu to NUMA node, read once from sysfs.
+/// Node numbers can be sparse, e.g., node0 and node2 only, so num_nodes is
+/// one more than the largest node number.
+/// Empty if there is a single node or the topology is unknown.
+///
+struct Topology {
+    int num_nodes = 1;
+    std::vector<int> cpu_node;
+
+    Topology()
+    {
+    #if defined( __linux__ )
+        int count = 0;
+        DIR* dir = opendir( "/sys/devices/system/node" );
+        if (dir != nullptr) {
+            while (struct dirent* entry = readdir( dir )) {
+                // Only entries nodeN; skip, e.g., possible, online.
+                int node = -1;
+                char extra;
+                if (sscanf( entry->d_name, "node%d%c", &node, &extra ) != 1
+                    || node < 0)
+                    continue;
+
+                std::ifstream file( std::string( "/sys/devices/system/node/" )
+                                    + entry->d_name + "/cpulist" );
+                if (! file)
+                    continue;
+
+                // Parse cpu list, e.g., "0-3,8-11".
+                std::string list, range;
+                std::getline( file, list );
+                std::istringstream ranges( list );
+                while (std::getline( ranges, range, ',' )) {
+                    int first = -1, last = -1;
+                    char dash = 0;
+                    std::istringstream( range ) >> first >> dash >> last;
+                    if (dash != '-')
+                        last = first;
+                    for (int cpu = first; cpu >= 0 && cpu <= last; ++cpu) {
+                        if (cpu >= int( cpu_node.size() ))
+                            cpu_node.resize( cpu + 1, -1 );
+                        cpu_node[ cpu ] = node;
+                    }
+                }
+                ++count;
+                num_nodes = std::max( num_nodes, node + 1 );
+            }
+            closedir( dir );
+        }
+        if (count <= 1) {
+            num_nodes = 1;
+            cpu_node.clear();
+        }
+    #endif
+    }
+};
+
+Topology const& topology()
+{
+    static Topology topo;
+    return topo;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+/// @return one more than the largest NUMA node number, which is the number
+///         of nodes unless node numbers are sparse; 1 if unknown.
+///
+int num_nodes()
+{
+    return topology().num_nodes;
+}
+
+//------------------------------------------------------------------------------
+/// @return NUMA node of the cpu the calling thread is running on;
+///         0 if there is a single node or it is unknown.
+///
+int current_node()
+{
+    Topology const& topo = topology();
+    #if defined( __linux__ )
+        int cpu = sched_getcpu();
+        if (cpu >= 0 && cpu < int( topo.cpu_node.size() )
+            && topo.cpu_node[ cpu ] >= 0)
+            return topo.cpu_node[ cpu ];
+    #endif
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Gets the NUMA node of the page holding each address, with one system call.
+/// Pages not yet touched have no node.
+///
+/// @param[in] addrs
+///     Addresses to query.
+///
+/// @param[out] nodes
+///     On exit, nodes[ k ] is the node of addrs[ k ], or -1 if unknown.
+///
+void page_nodes(std::vector<void const*> const& addrs, std::vector<int>& nodes)
+{
+    nodes.assign( addrs.size(), -1 );
+    if (addrs.empty() || num_nodes() <= 1)
+        return;
+
+    #if defined( __linux__ ) && defined( SYS_move_pages )
+        // move_pages with nodes = NULL only reports where pages are.
+        std::vector<void*> pages( addrs.size() );
+        for (size_t k = 0; k < addrs.size(); ++k)
+            pages[ k ] = const_cast<void*>( addrs[ k ] );
+        std::vector<int> status( addrs.size(), -1 );
+        long info = syscall( SYS_move_pages, 0, pages.size(), pages.data(),
+                             nullptr, status.data(), 0 );
+        if (info == 0) {
+            for (size_t k = 0; k < addrs.size(); ++k) {
+                if (status[ k ] >= 0)
+                    nodes[ k ] = status[ k ];
+            }
+        }
+    #endif
+}
+
+} // namespace numa
+} // namespace internal
+} // namespace slate
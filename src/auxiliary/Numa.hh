@@ -0,0 +1,33 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_NUMA_HH
+#define SLATE_NUMA_HH
+
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Queries of the NUMA topology, used to place tile updates near memory.
+/// Implemented with Linux sysfs and system calls, without libnuma.
+/// On other systems, there is one node and all queries return node 0
+/// or unknown (-1).
+///
+namespace numa {
+
+int num_nodes();
+
+int current_node();
+
+void page_nodes(std::vector<void const*> const& addrs, std::vector<int>& nodes);
+
+} // namespace numa
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_NUMA_HH
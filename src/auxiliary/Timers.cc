@@ -0,0 +1,159 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/Timers.hh"
+#include "slate/Exception.hh"
+
+#include <set>
+#include <vector>
+
+namespace slate {
+namespace timers {
+
+bool Timers::timing_ = false;
+std::map<std::string, PhaseStats> Timers::phases_;
+
+//------------------------------------------------------------------------------
+/// Erases all phases recorded on this rank.
+///
+void Timers::clear()
+{
+    #pragma omp critical(slate_timers)
+    phases_.clear();
+}
+
+//------------------------------------------------------------------------------
+/// Adds time, gflop, and gbyte to the named phase on this rank.
+///
+void Timers::insert( std::string const& name, double time,
+                     double gflop, double gbyte )
+{
+    #pragma omp critical(slate_timers)
+    {
+        auto& stats = phases_[ name ];
+        stats.time  += time;
+        stats.gflop += gflop;
+        stats.gbyte += gbyte;
+        stats.count += 1;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Aggregates phases across all ranks in comm; collective on comm.
+/// Phases are the union of those recorded on each rank; a rank that did
+/// not record a phase counts as zero for it.
+///
+/// @return map of phase names to min, average, and max across ranks.
+///
+std::map<std::string, PhaseSummary> Timers::reduce( MPI_Comm comm )
+{
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size( comm, &mpi_size ) );
+
+    // Gather the union of phase names, as '\0' separated strings.
+    std::string names;
+    for (auto& phase : phases_) {
+        names += phase.first;
+        names += '\0';
+    }
+    int len = names.size();
+    std::vector<int> lens( mpi_size ), displs( mpi_size+1, 0 );
+    slate_mpi_call(
+        MPI_Allgather( &len, 1, MPI_INT, lens.data(), 1, MPI_INT, comm ) );
+    for (int r = 0; r < mpi_size; ++r)
+        displs[ r+1 ] = displs[ r ] + lens[ r ];
+    std::vector<char> all_names( displs[ mpi_size ] );
+    slate_mpi_call(
+        MPI_Allgatherv( names.data(), len, MPI_CHAR,
+                        all_names.data(), lens.data(), displs.data(),
+                        MPI_CHAR, comm ) );
+    std::set<std::string> name_set;
+    for (size_t i = 0; i < all_names.size(); ) {
+        std::string name( &all_names[ i ] );
+        i += name.size() + 1;
+        name_set.insert( name );
+    }
+
+    // Reduce time, gflop, gbyte, count for each phase.
+    int64_t nphases = name_set.size();
+    const int nfields = 4;
+    std::vector<double> local( nfields*nphases, 0 );
+    int64_t k = 0;
+    for (auto& name : name_set) {
+        auto iter = phases_.find( name );
+        if (iter != phases_.end()) {
+            local[ nfields*k + 0 ] = iter->second.time;
+            local[ nfields*k + 1 ] = iter->second.gflop;
+            local[ nfields*k + 2 ] = iter->second.gbyte;
+            local[ nfields*k + 3 ] = iter->second.count;
+        }
+        ++k;
+    }
+    std::vector<double> vmin( local.size() ), vmax( local.size() ),
+                        vsum( local.size() );
+    slate_mpi_call(
+        MPI_Allreduce( local.data(), vmin.data(), local.size(), MPI_DOUBLE,
+                       MPI_MIN, comm ) );
+    slate_mpi_call(
+        MPI_Allreduce( local.data(), vmax.data(), local.size(), MPI_DOUBLE,
+                       MPI_MAX, comm ) );
+    slate_mpi_call(
+        MPI_Allreduce( local.data(), vsum.data(), local.size(), MPI_DOUBLE,
+                       MPI_SUM, comm ) );
+
+    auto unpack = []( double const* v, PhaseStats& stats ) {
+        stats.time  = v[ 0 ];
+        stats.gflop = v[ 1 ];
+        stats.gbyte = v[ 2 ];
+        stats.count = int64_t( v[ 3 ] );
+    };
+
+    std::map<std::string, PhaseSummary> summary;
+    k = 0;
+    for (auto& name : name_set) {
+        auto& s = summary[ name ];
+        unpack( &vmin[ nfields*k ], s.min );
+        unpack( &vmax[ nfields*k ], s.max );
+        for (int f = 0; f < nfields; ++f)
+            vsum[ nfields*k + f ] /= mpi_size;
+        unpack( &vsum[ nfields*k ], s.avg );
+        ++k;
+    }
+    return summary;
+}
+
+//------------------------------------------------------------------------------
+/// Prints a table of phases with min, average, and max time across ranks,
+/// and the phase's Gflop/s and GB moved, on rank 0 of comm;
+/// collective on comm.
+///
+void Timers::print( MPI_Comm comm, FILE* file )
+{
+    auto summary = reduce( comm );
+
+    int mpi_rank, mpi_size;
+    slate_mpi_call(
+        MPI_Comm_rank( comm, &mpi_rank ) );
+    slate_mpi_call(
+        MPI_Comm_size( comm, &mpi_size ) );
+    if (mpi_rank != 0)
+        return;
+
+    fprintf( file, "%-32s %6s %10s %10s %10s %10s %10s\n",
+             "phase", "count", "min (s)", "avg (s)", "max (s)",
+             "gflop/s", "gbyte" );
+    for (auto& [name, s] : summary) {
+        // Phase totals over the slowest rank's time.
+        double gflops = s.max.time > 0 ? s.max.gflop / s.max.time : 0;
+        fprintf( file, "%-32s %6lld %10.4f %10.4f %10.4f %10.2f %10.4f\n",
+                 name.c_str(), (long long) s.max.count,
+                 s.min.time, s.avg.time, s.max.time,
+                 gflops, s.max.gbyte );
+    }
+}
+
+} // namespace timers
+} // namespace slate
@@ -8,10 +8,19 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <atomic>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <limits>
 #include <string>
+#include <vector>
+
+#if defined( __linux__ )
+    #include <linux/perf_event.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
 
 namespace slate {
 namespace trace {
@@ -184,6 +193,187 @@ std::string comment_;
 std::vector<std::vector<Event>> Trace::events_ =
     std::vector<std::vector<Event>>(omp_get_max_threads());
 
+//------------------------------------------------------------------------------
+/// Returns set of comma-separated block names in $SLATE_TRACE_COUNTERS,
+/// e.g., SLATE_TRACE_COUNTERS="blas::gemm,blas::trsm".
+///
+std::set<std::string> getenvCounterNames()
+{
+    std::set<std::string> names;
+    const char* env = getenv( "SLATE_TRACE_COUNTERS" );
+    if (env != nullptr) {
+        std::string str( env );
+        size_t begin = 0;
+        while (begin < str.size()) {
+            size_t end = str.find( ',', begin );
+            if (end == std::string::npos)
+                end = str.size();
+            if (end > begin)
+                names.insert( str.substr( begin, end - begin ) );
+            begin = end + 1;
+        }
+    }
+    return names;
+}
+
+std::set<std::string> Trace::counter_names_ = getenvCounterNames();
+
+//------------------------------------------------------------------------------
+/// Hardware counter totals for one block name, summed over events on
+/// all ranks and threads.
+///
+struct CounterStats {
+    int64_t count = 0;
+    double time   = 0;
+    double gflop  = 0;
+    double counts[ num_counters ] = {};
+};
+
+std::map<std::string, CounterStats> counter_stats_;
+
+// Bytes moved per last-level cache miss, to estimate bytes/flop.
+const int cache_line_bytes = 64;
+
+//------------------------------------------------------------------------------
+/// Busy, MPI, and span times of one rank, summed over its threads.
+///
+struct RankStats {
+    double span = 0;
+    double busy = 0;
+    double mpi  = 0;
+};
+
+//------------------------------------------------------------------------------
+/// Total time of one block name over all ranks and threads.
+///
+struct NameStats {
+    int64_t count = 0;
+    double time   = 0;
+};
+
+//------------------------------------------------------------------------------
+/// Timing of step k of a factorization, from task::panel and
+/// task::lookahead blocks, over all ranks.
+///
+struct StepStats {
+    double panel_start = std::numeric_limits<double>::max();
+    double panel_stop  = std::numeric_limits<double>::lowest();
+    double lookahead_min = std::numeric_limits<double>::max();
+};
+
+std::vector<RankStats> rank_stats_;
+std::map<std::string, NameStats> name_stats_;
+std::map<int64_t, StepStats> step_stats_;
+
+//------------------------------------------------------------------------------
+/// Returns true if name is an MPI call, i.e., begins with "MPI_".
+///
+bool isMPI(const char* name)
+{
+    return strncmp( name, "MPI_", 4 ) == 0;
+}
+
+//------------------------------------------------------------------------------
+/// Returns true if name is a driver-level block, i.e., begins with "slate::",
+/// which encloses tasks rather than doing work itself.
+///
+bool isDriver(const char* name)
+{
+    return strncmp( name, "slate::", 7 ) == 0;
+}
+
+//------------------------------------------------------------------------------
+/// Returns length of the union of intervals, which is sorted in place.
+///
+double unionLength(std::vector< std::pair<double, double> >& intervals)
+{
+    std::sort( intervals.begin(), intervals.end() );
+    double length = 0;
+    double start = std::numeric_limits<double>::lowest();
+    double stop  = std::numeric_limits<double>::lowest();
+    for (auto& interval : intervals) {
+        if (interval.first > stop) {
+            if (stop > start)
+                length += stop - start;
+            start = interval.first;
+        }
+        stop = std::max( stop, interval.second );
+    }
+    if (stop > start)
+        length += stop - start;
+    return length;
+}
+
+#if defined( __linux__ )
+    // Leader fd of this thread's perf_event group:
+    // -2 if not yet opened, -1 if counters are unavailable.
+    // s_perf_fd is valid only if s_perf_fd_generation matches
+    // s_perf_generation; closeCounters() starts a new generation.
+    static int s_perf_fd = -2;
+    static int s_perf_fd_generation = 0;
+    #pragma omp threadprivate( s_perf_fd, s_perf_fd_generation )
+
+    static std::atomic<int> s_perf_generation( 0 );
+
+    // fds opened by all threads, so one thread can close them.
+    static std::vector<int> s_perf_fds;
+
+    // Same order as CounterStats::counts.
+    const uint64_t perf_configs[ num_counters ] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_REFERENCES,
+        PERF_COUNT_HW_CACHE_MISSES,
+    };
+
+//------------------------------------------------------------------------------
+/// Opens a group of hardware counters for the calling thread, counting
+/// user-space events only. The counters stay open until closeCounters().
+///
+/// @return leader fd of the group, or -1 if counters are unavailable,
+///         e.g., due to perf_event_paranoid or a virtual machine.
+///
+int openCounters()
+{
+    int fds[ num_counters ];
+    for (int i = 0; i < num_counters; ++i) {
+        perf_event_attr attr;
+        memset( &attr, 0, sizeof( attr ) );
+        attr.size = sizeof( attr );
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = perf_configs[ i ];
+        attr.read_format = PERF_FORMAT_GROUP;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        int leader = (i == 0 ? -1 : fds[ 0 ]);
+        fds[ i ] = syscall( SYS_perf_event_open, &attr, 0, -1, leader, 0 );
+        if (fds[ i ] < 0) {
+            for (int j = 0; j < i; ++j)
+                close( fds[ j ] );
+            return -1;
+        }
+    }
+    #pragma omp critical(slate_trace_counters)
+    s_perf_fds.insert( s_perf_fds.end(), fds, fds + num_counters );
+    return fds[ 0 ];
+}
+
+//------------------------------------------------------------------------------
+/// Closes the hardware counters of all threads. Each thread reopens its
+/// counters on its next read.
+///
+void closeCounters()
+{
+    #pragma omp critical(slate_trace_counters)
+    {
+        for (int fd : s_perf_fds)
+            close( fd );
+        s_perf_fds.clear();
+        ++s_perf_generation;
+    }
+}
+#endif
+
 std::map<std::string, Color> function_color_ = {
 
     {"blas::add",   Color::LightSkyBlue},
@@ -258,9 +448,17 @@ std::map<std::string, Color> function_color_ = {
 //------------------------------------------------------------------------------
 /// Create a block, which marks the beginning of an event in the trace.
 ///
+/// If tracing and name is in Trace::counters(), also starts sampling
+/// hardware counters.
+///
 Block::Block( const char* name, int64_t index )
     : event_( name, index, s_nest++ )
-{}
+{
+    if (Trace::tracing_ && ! Trace::counter_names_.empty()
+        && Trace::counter_names_.count( event_.name_ ) > 0) {
+        event_.has_counts_ = Trace::readCounters( event_.counts_ );
+    }
+}
 
 //------------------------------------------------------------------------------
 /// Destroy a block, which marks the end of an event in the trace.
@@ -268,9 +466,47 @@ Block::Block( const char* name, int64_t index )
 Block::~Block()
 {
     s_nest--;
+    if (event_.has_counts_) {
+        int64_t counts[ num_counters ];
+        event_.has_counts_ = Trace::readCounters( counts );
+        for (int i = 0; i < num_counters; ++i)
+            event_.counts_[ i ] = counts[ i ] - event_.counts_[ i ];
+    }
     Trace::insert( event_ );
 }
 
+//------------------------------------------------------------------------------
+/// Reads this thread's hardware counters, opening them on first use.
+///
+/// @param[out] counts
+///     Array of length num_counters: cycles, instructions,
+///     cache references, cache misses.
+///
+/// @return true if counters were read; false if unavailable.
+///
+bool Trace::readCounters(int64_t* counts)
+{
+#if defined( __linux__ )
+    if (s_perf_fd == -2 || s_perf_fd_generation != s_perf_generation) {
+        s_perf_fd = openCounters();
+        s_perf_fd_generation = s_perf_generation;
+    }
+    if (s_perf_fd < 0)
+        return false;
+
+    // PERF_FORMAT_GROUP layout: { nr, value[ nr ] }.
+    uint64_t buffer[ 1 + num_counters ];
+    ssize_t size = read( s_perf_fd, buffer, sizeof( buffer ) );
+    if (size != ssize_t( sizeof( buffer ) ) || buffer[ 0 ] != num_counters)
+        return false;
+    for (int i = 0; i < num_counters; ++i)
+        counts[ i ] = buffer[ 1 + i ];
+    return true;
+#else
+    return false;
+#endif
+}
+
 //------------------------------------------------------------------------------
 ///
 void Trace::insert(Event event)
@@ -427,10 +663,18 @@ void Trace::finish()
 
     // Print the events.
     if (mpi_rank == 0) {
+        counter_stats_.clear();
+        rank_stats_.assign( mpi_size, RankStats() );
+        name_stats_.clear();
+        step_stats_.clear();
         printProcEvents(0, mpi_size, timespan, trace_file);
+        addCounterStats();
+        addAnalysis(0);
         for (int rank = 1; rank < mpi_size; ++rank) {
             recvProcEvents(rank);
             printProcEvents(rank, mpi_size, timespan, trace_file);
+            addCounterStats();
+            addAnalysis(rank);
         }
     }
     else
@@ -442,15 +686,23 @@ void Trace::finish()
         printTicks(timespan, trace_file);
         printComment(trace_file);
         printLegend(trace_file);
+        printCounterStats(trace_file);
+        printAnalysis(trace_file);
 
         fprintf(trace_file, "\n</svg>\n");
         fclose(trace_file);
         fprintf(stderr, "trace file: %s\n", file_name.c_str());
+        printCounterStats(stderr);
+        printAnalysis(stderr);
     }
 
     // Clear events.
     for (auto& thread : events_)
         thread.clear();
+
+    #if defined( __linux__ )
+        closeCounters();
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -496,15 +748,27 @@ void Trace::printProcEvents(int mpi_rank, int mpi_size,
                     double x = (event.start_ - events_[0][0].stop_) * hscale_;
                     double width = (event.stop_ - event.start_) * hscale_;
 
+                    // Append counters to the label, if sampled.
+                    char counts[ 128 ] = "";
+                    if (event.has_counts_) {
+                        snprintf(counts, sizeof(counts),
+                                 " cycles %lld instr %lld"
+                                 " cache-ref %lld cache-miss %lld",
+                                 llong( event.counts_[ 0 ] ),
+                                 llong( event.counts_[ 1 ] ),
+                                 llong( event.counts_[ 2 ] ),
+                                 llong( event.counts_[ 3 ] ));
+                    }
+
                     fprintf(trace_file,
                             "<rect x=\"%.4f\" y=\"%.0f\" "
                             "width=\"%.4f\" height=\"%.0f\" "
                             "class=\"%s\" "
-                            "inkscape:label=\"%s %lld\"/>\n",
+                            "inkscape:label=\"%s %lld%s\"/>\n",
                             x, y,
                             width, h,
                             cleanName(event.name_).c_str(),
-                            event.name_, llong( event.index_ ));
+                            event.name_, llong( event.index_ ), counts);
                 }
             }
         }
@@ -605,6 +869,205 @@ void Trace::printLegend(FILE* trace_file)
     }
 }
 
+//------------------------------------------------------------------------------
+/// Adds counters of events currently in events_ (one rank's events)
+/// to the per-name statistics.
+///
+void Trace::addCounterStats()
+{
+    for (auto& thread : events_) {
+        for (auto& event : thread) {
+            if (event.has_counts_) {
+                auto& stats = counter_stats_[ event.name_ ];
+                stats.count += 1;
+                stats.time  += event.stop_ - event.start_;
+                stats.gflop += event.gflop_;
+                for (int i = 0; i < num_counters; ++i)
+                    stats.counts[ i ] += event.counts_[ i ];
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Prints per-name hardware counter statistics: achieved Gflop/s,
+/// instructions per cycle, cache miss rate, and bytes/flop, estimated as
+/// cache misses * cache line size / flops. Gflop/s and bytes/flop are
+/// available only for blocks that set flops, e.g., Tile BLAS.
+/// If file is the SVG trace, prints as an XML comment.
+///
+void Trace::printCounterStats(FILE* file)
+{
+    if (counter_names_.empty())
+        return;
+
+    bool svg = (file != stderr && file != stdout);
+    fprintf(file, "%s%-30s %8s %10s %10s %6s %8s %10s\n",
+            (svg ? "\n<!-- hardware counters\n" : "\n"),
+            "block", "count", "time (s)", "gflop/s", "IPC", "miss %",
+            "byte/flop");
+    for (auto& name : counter_names_) {
+        auto iter = counter_stats_.find( name );
+        if (iter == counter_stats_.end()) {
+            fprintf(file, "%-30s  counters unavailable or block not run\n",
+                    name.c_str());
+            continue;
+        }
+        auto& stats = iter->second;
+        double cycles = stats.counts[ 0 ];
+        double instr  = stats.counts[ 1 ];
+        double refs   = stats.counts[ 2 ];
+        double misses = stats.counts[ 3 ];
+        double gflops = stats.time > 0 ? stats.gflop / stats.time : 0;
+        double ipc    = cycles > 0 ? instr / cycles : 0;
+        double miss   = refs > 0 ? 100 * misses / refs : 0;
+        double bytes_per_flop = stats.gflop > 0
+                              ? misses * cache_line_bytes / (stats.gflop * 1e9)
+                              : 0;
+        fprintf(file, "%-30s %8lld %10.4f %10.2f %6.2f %8.2f %10.4f\n",
+                name.c_str(), (long long) stats.count, stats.time,
+                gflops, ipc, miss, bytes_per_flop);
+    }
+    if (svg)
+        fprintf(file, "-->\n");
+}
+
+//------------------------------------------------------------------------------
+/// Adds events currently in events_, which are mpi_rank's events,
+/// to the analysis:
+/// - per-rank busy time, the union of non-driver blocks on each thread,
+///   and MPI time, the union of MPI_* blocks;
+/// - per-name total time;
+/// - per-step panel and lookahead times, from task::panel and
+///   task::lookahead blocks with index k.
+/// Times are relative to the rank's first event, as in the SVG,
+/// so ranks are assumed to start together.
+///
+void Trace::addAnalysis(int mpi_rank)
+{
+    double origin = std::numeric_limits<double>::max();
+    double last   = std::numeric_limits<double>::lowest();
+    for (auto& thread : events_) {
+        for (auto& event : thread) {
+            origin = std::min( origin, event.start_ );
+            last   = std::max( last,   event.stop_ );
+        }
+    }
+    if (origin > last)
+        return;  // no events
+
+    auto& rank_stats = rank_stats_[ mpi_rank ];
+    rank_stats.span = last - origin;
+    for (auto& thread : events_) {
+        std::vector< std::pair<double, double> > busy, mpi;
+        for (auto& event : thread) {
+            double start = event.start_ - origin;
+            double stop  = event.stop_  - origin;
+
+            auto& name_stats = name_stats_[ event.name_ ];
+            name_stats.count += 1;
+            name_stats.time  += stop - start;
+
+            if (! isDriver( event.name_ ))
+                busy.push_back( { start, stop } );
+            if (isMPI( event.name_ ))
+                mpi.push_back( { start, stop } );
+
+            if (strcmp( event.name_, "task::panel" ) == 0) {
+                auto& step = step_stats_[ event.index_ ];
+                step.panel_start = std::min( step.panel_start, start );
+                step.panel_stop  = std::max( step.panel_stop,  stop  );
+            }
+            else if (strcmp( event.name_, "task::lookahead" ) == 0) {
+                auto& step = step_stats_[ event.index_ ];
+                step.lookahead_min = std::min( step.lookahead_min,
+                                               stop - start );
+            }
+        }
+        rank_stats.busy += unionLength( busy );
+        rank_stats.mpi  += unionLength( mpi );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Prints the analysis of events from all ranks:
+/// - per rank, idle time of its threads, and busy time split into
+///   MPI and compute;
+/// - total time per block name, MPI or compute, largest first;
+/// - per step k of getrf, potrf, or geqrf: panel time and panel wait,
+///   i.e., the gap between the end of panel k-1 and start of panel k,
+///   which lookahead should hide;
+/// - estimated critical path, the chain of panels, each followed by the
+///   fastest lookahead update of the next column, vs. elapsed time.
+///   A ratio near 1 means the panel chain is the bottleneck; a low ratio
+///   means the trailing update or idle time is.
+/// If file is the SVG trace, prints as an XML comment.
+///
+void Trace::printAnalysis(FILE* file)
+{
+    bool svg = (file != stderr && file != stdout);
+    fprintf(file, "%s", (svg ? "\n<!-- analysis\n" : "\n"));
+
+    // Per rank.
+    double elapsed = 0;
+    fprintf(file, "%-6s %10s %10s %10s %10s %8s\n",
+            "rank", "span (s)", "idle (s)", "mpi (s)", "comp (s)", "idle %");
+    for (size_t rank = 0; rank < rank_stats_.size(); ++rank) {
+        auto& stats = rank_stats_[ rank ];
+        double total = stats.span * num_threads_;
+        double idle  = total - stats.busy;
+        elapsed = std::max( elapsed, stats.span );
+        fprintf(file, "%-6lld %10.4f %10.4f %10.4f %10.4f %8.2f\n",
+                (long long) rank, stats.span, idle, stats.mpi,
+                stats.busy - stats.mpi, total > 0 ? 100 * idle / total : 0.);
+    }
+
+    // Per name, largest total time first.
+    const size_t max_names = 20;
+    std::vector< std::pair<double, std::string> > names;
+    for (auto& [name, stats] : name_stats_)
+        names.push_back( { stats.time, name } );
+    std::sort( names.rbegin(), names.rend() );
+    if (names.size() > max_names)
+        names.resize( max_names );
+    fprintf(file, "\n%-30s %8s %8s %10s\n", "block", "kind", "count", "time (s)");
+    for (auto& [time, name] : names) {
+        fprintf(file, "%-30s %8s %8lld %10.4f\n",
+                name.c_str(),
+                (isMPI( name.c_str() ) ? "mpi"
+                  : isDriver( name.c_str() ) ? "driver" : "compute"),
+                (long long) name_stats_[ name ].count, time);
+    }
+
+    // Per step, if the driver traced its tasks.
+    if (! step_stats_.empty()) {
+        fprintf(file, "\n%-6s %10s %10s %10s %12s\n",
+                "step", "start (s)", "panel (s)", "wait (s)", "lookahead (s)");
+        double critical = 0;
+        double prev_stop = 0;
+        bool first = true;
+        for (auto& [k, step] : step_stats_) {
+            if (step.panel_start > step.panel_stop)
+                continue;  // no panel in this step
+            double panel = step.panel_stop - step.panel_start;
+            double wait  = first ? 0 : step.panel_start - prev_stop;
+            double lookahead = step.lookahead_min
+                               < std::numeric_limits<double>::max()
+                             ? step.lookahead_min : 0;
+            critical += panel + lookahead;
+            prev_stop = step.panel_stop;
+            first = false;
+            fprintf(file, "%-6lld %10.4f %10.4f %10.4f %12.4f\n",
+                    (long long) k, step.panel_start, panel, wait, lookahead);
+        }
+        fprintf(file, "\nestimated critical path %.4f s, elapsed %.4f s,"
+                " ratio %.2f\n",
+                critical, elapsed, elapsed > 0 ? critical / elapsed : 0.);
+    }
+    if (svg)
+        fprintf(file, "-->\n");
+}
+
 //------------------------------------------------------------------------------
 ///
 void Trace::sendProcEvents()
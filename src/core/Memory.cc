@@ -6,10 +6,14 @@
 #include "auxiliary/Debug.hh"
 #include "slate/internal/Memory.hh"
 
+#include <algorithm>
+
 namespace slate {
 
 int Memory::num_devices_;
 Memory::StaticConstructor Memory::static_constructor_;
+std::atomic<int64_t> Memory::in_use_( 0 );
+std::atomic<int64_t> Memory::peak_use_( 0 );
 
 //------------------------------------------------------------------------------
 /// Construct saves block size, but does not allocate any memory.
@@ -140,6 +144,12 @@ void* Memory::alloc(int device, size_t size, blas::Queue* queue)
             }
         }
     }
+
+    // Counted in blocks, since free() doesn't know the size.
+    // Raise peak to use, unless another thread raised it higher.
+    int64_t use  = (in_use_ += block_size_);
+    int64_t peak = peak_use_;
+    while (peak < use && ! peak_use_.compare_exchange_weak( peak, use )) {}
     return block;
 }
 
@@ -159,6 +169,16 @@ void Memory::free(void* block, int device)
             free_blocks_[device].push(block);
         }
     }
+
+    in_use_ -= block_size_;
+}
+
+//------------------------------------------------------------------------------
+/// Resets peakUse() to the current inUse().
+///
+void Memory::resetPeakUse()
+{
+    peak_use_ = in_use_.load();
 }
 
 //------------------------------------------------------------------------------
@@ -200,6 +200,37 @@ void gbmm(
     C.clearWorkspace();
 }
 
+//------------------------------------------------------------------------------
+/// @internal
+/// gbmm for a narrow band on one rank, using LAPACK-style compact band
+/// storage of A.
+///
+template <typename scalar_t>
+void gbmm_compact(
+    scalar_t alpha, BandMatrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C )
+{
+    int64_t m  = A.m();
+    int64_t n  = A.n();
+    int64_t kl = A.lowerBandwidth();
+    int64_t ku = A.upperBandwidth();
+    int64_t nrhs = C.n();
+    int64_t ldab = kl + ku + 1;
+    int64_t ldb = std::max( n, int64_t( 1 ) );
+    int64_t ldc = std::max( m, int64_t( 1 ) );
+
+    std::vector<scalar_t> AB( ldab*n ), Bdata( ldb*nrhs ), Cdata( ldc*nrhs );
+    internal::copyband2lapack( A, kl, ku, AB.data(), ldab );
+    internal::copyge2lapack( B, Bdata.data(), ldb );
+    if (beta != scalar_t( 0.0 ))
+        internal::copyge2lapack( C, Cdata.data(), ldc );
+    internal::gbmm_lapack( Side::Left, m, n, kl, ku, nrhs,
+                           alpha, AB.data(), ldab, Bdata.data(), ldb,
+                           beta, Cdata.data(), ldc );
+    internal::copylapack2ge( Cdata.data(), ldc, C );
+}
+
 } // namespace impl
 
 //------------------------------------------------------------------------------
@@ -247,6 +278,12 @@ void gbmm(
 ///           - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///           - HostBatch: batched BLAS on CPU host.
 ///           - Devices:   batched BLAS on GPU device.
+///         - Option::CompactBand:
+///           Single-rank shortcut: if A, B, and C are on one rank and not
+///           transposed, and the band of A is at most a quarter of the tile
+///           size, multiply using a temporary copy of A in LAPACK-style
+///           compact band storage, which raises peak memory by the copy.
+///           Default false.
 ///
 /// @ingroup gbmm
 ///
@@ -259,6 +296,14 @@ void gbmm(
 {
     Target target = get_option( opts, Option::Target, Target::HostTask );
 
+    if (internal::use_compact_band( A, A.lowerBandwidth(),
+                                    A.upperBandwidth(), opts )
+        && B.mpiSize() == 1 && B.op() == Op::NoTrans
+        && C.mpiSize() == 1 && C.op() == Op::NoTrans) {
+        impl::gbmm_compact( alpha, A, B, beta, C );
+        return;
+    }
+
     switch (target) {
         case Target::Host:
         case Target::HostTask:
@@ -14,6 +14,101 @@ namespace slate {
 
 namespace impl {
 
+//------------------------------------------------------------------------------
+/// @internal
+/// Increases the upper bandwidth of A from ku to kl + ku, for fill-in of U,
+/// inserting and zeroing the new local tiles.
+///
+template <typename scalar_t>
+void gbtrf_insert_fill(
+    BandMatrix<scalar_t>& A, int64_t kl, int64_t ku )
+{
+    const scalar_t zero = 0.0;
+
+    // todo: initially, assume fixed size, square tiles for simplicity
+    int64_t kut = ceildiv( ku, A.tileNb(0) );
+    int64_t ku2t = ceildiv( (ku + kl), A.tileNb(0) );
+    int64_t min_mt_nt = std::min(A.mt(), A.nt());
+
+    // Insert & zero potential fill above upper bandwidth
+    A.upperBandwidth(kl + ku);
+    for (int64_t i = 0; i < min_mt_nt; ++i) {
+        for (int64_t j = i + 1 + kut; j < std::min(i + 1 + ku2t, A.nt()); ++j) {
+            if (A.tileIsLocal(i, j)) {
+                // todo: device?
+                A.tileInsert(i, j);
+                auto T = A(i, j);
+                lapack::laset(lapack::MatrixType::General, T.mb(), T.nb(),
+                              zero, zero, T.data(), T.stride());
+                A.tileModified(i, j);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// gbtrf for a narrow band on one rank. Factors a temporary copy of the
+/// band in LAPACK-style compact storage, then converts the result to the
+/// format of the tiled gbtrf, so gbtrs and tbsm can use it:
+/// pivots are per block column, relative to the diagonal tile, and
+/// each block column's row swaps are also applied to its columns left of
+/// the pivot, as getrf_panel does; LAPACK's gbtrf doesn't apply them.
+/// Throws if U is exactly singular; the factorization is still completed.
+///
+template <typename scalar_t>
+void gbtrf_compact(
+    BandMatrix<scalar_t>& A, Pivots& pivots )
+{
+    int64_t m  = A.m();
+    int64_t n  = A.n();
+    int64_t kl = A.lowerBandwidth();
+    int64_t ku = A.upperBandwidth();
+    int64_t ldab = 2*kl + ku + 1;
+    int64_t min_mt_nt = std::min(A.mt(), A.nt());
+
+    gbtrf_insert_fill( A, kl, ku );
+
+    // LAPACK stores A(i, j) in AB[ kl + ku + i - j + j*ldab ];
+    // the first kl rows are for fill-in.
+    std::vector<scalar_t> AB( ldab*n );
+    std::vector<int64_t> ipiv( std::min(m, n) );
+    internal::copyband2lapack( A, kl, kl + ku, AB.data(), ldab );
+    int64_t info = lapack::gbtrf( m, n, kl, ku, AB.data(), ldab, ipiv.data() );
+    internal::copylapack2band( AB.data(), ldab, kl, kl + ku, A );
+
+    pivots.resize(min_mt_nt);
+    int64_t kk = 0;  // first row and col of block k
+    for (int64_t k = 0; k < min_mt_nt; ++k) {
+        int64_t diag_len = std::min(A.tileMb(k), A.tileNb(k));
+        pivots.at(k).resize(diag_len);
+        auto Akk = A(k, k);
+        for (int64_t d = 0; d < diag_len; ++d) {
+            // Find block row i and offset of the pivot row p.
+            int64_t p = ipiv[ kk + d ] - 1;
+            int64_t i = k, ii = kk;
+            while (p >= ii + A.tileMb(i)) {
+                ii += A.tileMb(i);
+                ++i;
+            }
+            pivots.at(k)[ d ] = Pivot( i - k, p - ii );
+
+            // Swap rows kk + d and p in columns kk : kk + d - 1.
+            if (p != kk + d && d > 0) {
+                auto Aik = A(i, k);
+                blas::swap( d, &Akk.at(d, 0), Akk.stride(),
+                               &Aik.at(p - ii, 0), Aik.stride() );
+            }
+        }
+        kk += A.tileNb(k);
+    }
+
+    if (info != 0) {
+        throw Exception( "gbtrf: U(" + std::to_string( info ) + ", "
+                         + std::to_string( info ) + ") is exactly zero" );
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Distributed parallel band LU factorization.
 /// Generic implementation for any target.
@@ -30,7 +125,6 @@ void gbtrf(
     using BcastList = typename BandMatrix<scalar_t>::BcastList;
 
     // Constants
-    const scalar_t zero = 0.0;
     const scalar_t one = 1.0;
     const int priority_0 = 0;
     const int priority_1 = 1;
@@ -59,25 +153,9 @@ void gbtrf(
 
     // todo: initially, assume fixed size, square tiles for simplicity
     int64_t klt = ceildiv( kl, A.tileNb(0) );
-    int64_t kut = ceildiv( ku, A.tileNb(0) );
     int64_t ku2t = ceildiv( (ku + kl), A.tileNb(0) );
 
-    // Insert & zero potential fill above upper bandwidth
-    A.upperBandwidth(kl + ku);
-    //printf( "kl %lld, ku %lld, kl+ku %lld, A.lowerBW %lld, A.upperBW %lld\n",
-    //        kl, ku, kl + ku, A.lowerBandwidth(), A.upperBandwidth() );
-    for (int64_t i = 0; i < min_mt_nt; ++i) {
-        for (int64_t j = i + 1 + kut; j < std::min(i + 1 + ku2t, A.nt()); ++j) {
-            if (A.tileIsLocal(i, j)) {
-                // todo: device?
-                A.tileInsert(i, j);
-                auto T = A(i, j);
-                lapack::laset(lapack::MatrixType::General, T.mb(), T.nb(),
-                              zero, zero, T.data(), T.stride());
-                A.tileModified(i, j);
-            }
-        }
-    }
+    gbtrf_insert_fill( A, kl, ku );
 
     // set min number for omp nested active parallel regions
     slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
@@ -256,6 +334,13 @@ void gbtrf(
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
+///     - Option::CompactBand:
+///       Single-rank shortcut: if A is on one rank and its band, including
+///       fill-in, is at most a quarter of the tile size, factor a temporary
+///       copy of the band in LAPACK-style compact storage with LAPACK's
+///       gbtrf, which avoids the zeros in full tiles, but raises peak memory
+///       by the copy. Throws slate::Exception if U is exactly singular.
+///       Default false.
 ///
 /// TODO: return value
 /// @retval 0 successful exit
@@ -273,6 +358,13 @@ void gbtrf(
 {
     Target target = get_option( opts, Option::Target, Target::HostTask );
 
+    if (internal::use_compact_band( A, A.lowerBandwidth(),
+                                    A.lowerBandwidth() + A.upperBandwidth(),
+                                    opts )) {
+        impl::gbtrf_compact( A, pivots );
+        return;
+    }
+
     switch (target) {
         case Target::Host:
         case Target::HostTask:
@@ -168,10 +168,9 @@ void ge2tb(
         }
     }
 
-    // Workspace for transposed panels needs one column of tiles.
+    // Workspace for transposed panels needs one column of tiles,
+    // which are inserted for each panel and erased after it is factored.
     auto AT = A.emptyLike(0, 0, Op::ConjTrans);
-    // todo: we really only want to insert 1 column's worth at a time.
-    AT.insertLocalTiles();
 
     // No lookahead is possible, so no need to track dependencies --
     // just execute tasks in order. Also, priority isn't needed.
@@ -334,7 +333,7 @@ void ge2tb(
                 for (int64_t j = 0; j < V_panel.nt(); ++j) {
                     if (V_panel.tileIsLocal(0, j)) {
                         V_panel.tileGetForReading( 0, j, HostNum, LayoutConvert(layout) );
-                        VT_panel.tileGetForWriting( j, 0, HostNum, LayoutConvert(layout) );
+                        VT_panel.tileInsert( j, 0 );
                         tile::deepConjTranspose( V_panel(0, j), VT_panel(j, 0) );
                     }
                 }
@@ -364,9 +363,13 @@ void ge2tb(
                         VT_panel.tileGetForReading( j, 0, HostNum, LayoutConvert(layout) );
                         V_panel.tileGetForWriting( 0, j, HostNum, LayoutConvert(layout) );
                         tile::deepConjTranspose( VT_panel(j, 0), V_panel(0, j) );
+                        VT_panel.tileErase( j, 0, AllDevices );
                     }
                 }
-                // todo: VT_panel.clear();
+                // TVlocal has the T factors now.
+                for (int64_t i = 0; i < TVlT_panel.mt(); ++i) {
+                    TVlT_panel.tileErase( i, 0, AllDevices );
+                }
                 //----------
 
                 // triangle-triangle reductions
@@ -0,0 +1,228 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "slate/Tile_blas.hh"
+#include "internal/internal.hh"
+
+#include <memory>
+#include <new>
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Non-symmetric matrix eigen decomposition.
+/// geev computes all eigenvalues and, optionally, right eigenvectors of a
+/// general matrix A:
+/// 1. reduction to upper Hessenberg form, $A = Q H Q^H$ (see gehrd);
+/// 2. Hessenberg QR iteration, $H = Z T Z^H$ with $T$ in Schur form,
+///    and eigenvectors of $T$, back-transformed by $Z$;
+/// 3. back-transformation of the eigenvectors by $Q$ (see unmhr).
+///
+/// Only steps 1 and 3 are distributed. Step 2 gathers the whole n-by-n
+/// H, and Z if computing eigenvectors, to rank 0 and runs LAPACK hseqr
+/// and trevc there. So geev is limited to matrices that fit in the memory
+/// of one node, and step 2, $O(n^3)$ flops, runs on one node only.
+/// If H, and Z, can't be allocated on rank 0, geev throws on all ranks
+/// before reducing A. The matrix is not balanced (LAPACK gebal).
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///         One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///         On entry, the n-by-n general matrix $A$, with square tiles.
+///         On exit, contents are destroyed.
+///
+/// @param[out] Lambda
+///     The vector Lambda of length n.
+///     If successful, the eigenvalues, in the order computed by hseqr.
+///     For real A, complex conjugate pairs of eigenvalues appear
+///     consecutively, with the positive imaginary part first.
+///
+/// @param[out] V
+///     On entry, if V is empty, does not compute eigenvectors.
+///     Otherwise, the n-by-n matrix $V$ to store right eigenvectors,
+///     with the same tiles as A.
+///     On exit, the right eigenvectors, each with Euclidean norm 1.
+///     As in LAPACK, for real A, if Lambda[ j ] and Lambda[ j+1 ] are a
+///     complex conjugate pair, their eigenvectors are
+///     V( :, j ) + i V( :, j+1 ) and V( :, j ) - i V( :, j+1 ).
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently none.
+///
+/// @ingroup geev
+///
+template <typename scalar_t>
+void geev(
+    Matrix<scalar_t>& A,
+    std::vector< std::complex< blas::real_type<scalar_t> > >& Lambda,
+    Matrix<scalar_t>& V,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using complex_t = std::complex<real_t>;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const auto mpi_real_type = mpi_type< real_t >::value;
+    const auto mpi_complex_type = mpi_type< complex_t >::value;
+
+    int64_t n = A.n();
+    int64_t nb = A.tileNb(0);
+    bool wantv = (V.mt() > 0);
+    int mpi_rank = A.mpiRank();
+
+    slate_error_if( A.m() != A.n() );
+
+    // Step 2 gathers H, and Z, to rank 0. Allocate them first, so all
+    // ranks throw before the reduction if they don't fit on rank 0.
+    std::vector<scalar_t> H_data, Z_data;
+    int H_fits_on_rank_0 = 1;
+    if (mpi_rank == 0) {
+        try {
+            H_data.resize( n*n );
+            if (wantv)
+                Z_data.resize( n*n );
+        }
+        catch (std::bad_alloc const&) {
+            H_fits_on_rank_0 = 0;
+        }
+    }
+    slate_mpi_call(
+        MPI_Bcast( &H_fits_on_rank_0, 1, MPI_INT, 0, A.mpiComm() ) );
+    slate_error_if( ! H_fits_on_rank_0 );
+
+    // 1. Reduce to upper Hessenberg form, A = Q H Q^H.
+    std::vector<scalar_t> tau;
+    gehrd( A, tau, opts );
+
+    // 2. Gathers H to rank 0 for the Hessenberg QR iteration,
+    // which runs on rank 0 only.
+    auto H = Matrix<scalar_t>::fromLAPACK(
+        n, n, H_data.data(), n, nb, 1, 1, A.mpiComm() );
+    redistribute( A, H, opts );
+
+    Lambda.resize( n );
+    int64_t info = 0;
+    if (mpi_rank == 0) {
+        // Remove reflectors below the first subdiagonal.
+        if (n > 2) {
+            lapack::laset( lapack::MatrixType::Lower, n-2, n-2, zero, zero,
+                           &H_data[ 2 ], n );
+        }
+        if (wantv) {
+            info = lapack::hseqr( lapack::JobSchur::Schur, lapack::Job::Vec,
+                                  n, 1, n, &H_data[ 0 ], n, &Lambda[ 0 ],
+                                  &Z_data[ 0 ], n );
+            if (info == 0) {
+                // Eigenvectors of T, back-transformed by Z.
+                std::unique_ptr<bool[]> select( new bool[ n ]() );
+                int64_t m = 0;
+                lapack::trevc( lapack::Sides::Right,
+                               lapack::HowMany::Backtransform,
+                               select.get(), n, &H_data[ 0 ], n,
+                               nullptr, 1, &Z_data[ 0 ], n, n, &m );
+            }
+        }
+        else {
+            scalar_t dummy;
+            info = lapack::hseqr( lapack::JobSchur::Eigenvalues,
+                                  lapack::Job::NoVec,
+                                  n, 1, n, &H_data[ 0 ], n, &Lambda[ 0 ],
+                                  &dummy, 1 );
+        }
+    }
+    MPI_Bcast( &info, 1, MPI_INT64_T, 0, A.mpiComm() );
+    slate_error_if( info != 0 );
+    MPI_Bcast( &Lambda[ 0 ], n, mpi_complex_type, 0, A.mpiComm() );
+
+    if (wantv) {
+        auto Z = Matrix<scalar_t>::fromLAPACK(
+            n, n, Z_data.data(), n, nb, 1, 1, A.mpiComm() );
+        redistribute( Z, V, opts );
+
+        // 3. Back-transform: V = Q V.
+        unmhr( Side::Left, Op::NoTrans, A, tau, V, opts );
+
+        // Normalize to Euclidean norm 1; for real A, a complex conjugate
+        // pair of columns is normalized together.
+        std::vector<real_t> norms( n, 0.0 );
+        int64_t jj = 0;
+        for (int64_t j = 0; j < V.nt(); ++j) {
+            for (int64_t i = 0; i < V.mt(); ++i) {
+                if (V.tileIsLocal( i, j )) {
+                    V.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                    auto T = V( i, j );
+                    for (int64_t tj = 0; tj < T.nb(); ++tj)
+                        for (int64_t ti = 0; ti < T.mb(); ++ti)
+                            norms[ jj + tj ] += std::norm( T( ti, tj ) );
+                }
+            }
+            jj += V.tileNb( j );
+        }
+        MPI_Allreduce( MPI_IN_PLACE, norms.data(), n, mpi_real_type,
+                       MPI_SUM, A.mpiComm() );
+        if constexpr (! is_complex<scalar_t>::value) {
+            for (int64_t j = 0; j < n-1; ++j) {
+                if (Lambda[ j ].imag() > 0) {
+                    norms[ j ] += norms[ j+1 ];
+                    norms[ j+1 ] = norms[ j ];
+                    ++j;
+                }
+            }
+        }
+
+        jj = 0;
+        for (int64_t j = 0; j < V.nt(); ++j) {
+            for (int64_t i = 0; i < V.mt(); ++i) {
+                if (V.tileIsLocal( i, j )) {
+                    V.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                    auto T = V( i, j );
+                    for (int64_t tj = 0; tj < T.nb(); ++tj) {
+                        scalar_t scale = 1 / std::sqrt( norms[ jj + tj ] );
+                        blas::scal( T.mb(), scale, &T.at( 0, tj ), 1 );
+                    }
+                }
+            }
+            jj += V.tileNb( j );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void geev<float>(
+    Matrix<float>& A,
+    std::vector< std::complex<float> >& Lambda,
+    Matrix<float>& V,
+    Options const& opts);
+
+template
+void geev<double>(
+    Matrix<double>& A,
+    std::vector< std::complex<double> >& Lambda,
+    Matrix<double>& V,
+    Options const& opts);
+
+template
+void geev< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    std::vector< std::complex<float> >& Lambda,
+    Matrix< std::complex<float> >& V,
+    Options const& opts);
+
+template
+void geev< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    std::vector< std::complex<double> >& Lambda,
+    Matrix< std::complex<double> >& V,
+    Options const& opts);
+
+} // namespace slate
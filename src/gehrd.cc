@@ -0,0 +1,442 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "slate/Tile_blas.hh"
+#include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel reduction of a general matrix to upper Hessenberg
+/// form, $Q^H A Q = H$, as in LAPACK gehrd.
+///
+/// The blocked algorithm follows LAPACK gehrd and lahr2: each panel of nb
+/// columns is factored on a copy of the tile column replicated on all ranks,
+/// then the trailing matrix is updated from the right and the left.
+/// The trailing matrix updates, which are most of the flops, are applied by
+/// each rank to its local tiles with OpenMP tasks, without communication.
+///
+/// As in lahr2 (and ScaLAPACK pdlahrd), each reflector needs
+/// $y = A v$ before the next reflector can be generated, so each reflector
+/// has one all-reduce, of the rows of $y$ below the panel's diagonal block;
+/// the rows above it are formed and all-reduced once per panel.
+/// Each panel also has one all-reduce of $V^H A$ for the left update.
+///
+/// ATTENTION: only host computation supported for now.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///         One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///         On entry, the n-by-n general matrix $A$,
+///         with square tiles.
+///         On exit, the upper triangle and the first subdiagonal contain
+///         the upper Hessenberg matrix $H$, and the elements below the
+///         first subdiagonal, with tau, represent the unitary matrix $Q$
+///         as a product of elementary reflectors, as in LAPACK.
+///
+/// @param[out] tau
+///         The vector tau of length n-1.
+///         The scalar factors of the elementary reflectors.
+///
+/// @param[in] opts
+///         Additional options, as map of name = value pairs. Currently none.
+///
+/// @ingroup geev_computational
+///
+template <typename scalar_t>
+void gehrd(
+    Matrix<scalar_t>& A,
+    std::vector<scalar_t>& tau,
+    Options const& opts)
+{
+    trace::Block trace_block("slate::gehrd");
+
+    using blas::conj;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const Layout layout = Layout::ColMajor;
+    const auto mpi_scalar_type = mpi_type<scalar_t>::value;
+
+    slate_error_if( A.m() != A.n() );
+    slate_error_if( A.op() != Op::NoTrans );
+
+    int64_t n  = A.n();
+    int64_t nt = A.nt();
+
+    // Global offset of each block row and column; tiles are square.
+    std::vector<int64_t> offset( nt+1, 0 );
+    for (int64_t j = 0; j < nt; ++j) {
+        slate_error_if( A.tileMb( j ) != A.tileNb( j ) );
+        offset[ j+1 ] = offset[ j ] + A.tileNb( j );
+    }
+
+    tau.assign( std::max( n-1, int64_t( 0 ) ), zero );
+
+    // Local tiles right of the panel, as (i, j, tile),
+    // with indices into trail by block row and by block col.
+    struct LocalTile {
+        int64_t i, j;
+        Tile<scalar_t> tile;
+    };
+    std::vector<LocalTile> trail;
+    std::vector< std::vector<int64_t> > trail_rows( nt ), trail_cols( nt );
+
+    // P: panel; Y = A V T; V: reflectors; T: triangular factor;
+    // W = V^H A; all are replicated on all ranks.
+    std::vector<scalar_t> P, Y, Ytop, V, T, W, w, vrow;
+
+    // set min number for omp nested active parallel regions
+    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+
+    #pragma omp parallel
+    #pragma omp master
+    for (int64_t k = 0; k < nt; ++k) {
+        int64_t c0  = offset[ k ];
+        int64_t nbk = A.tileNb( k );
+        int64_t ib  = std::min( nbk, n-1 - c0 );
+        if (ib <= 0)
+            break;
+
+        // Rows 0 : mtop-1 of Y are above the reflectors, which start at
+        // row c0+1; they are needed only for the right update.
+        int64_t mtop = c0 + 1;
+
+        internal::gatherTileColumn( A, k, offset, P );
+
+        trail.clear();
+        for (int64_t i = 0; i < nt; ++i) {
+            trail_rows[ i ].clear();
+            trail_cols[ i ].clear();
+        }
+        for (int64_t j = k+1; j < nt; ++j) {
+            for (int64_t i = 0; i < nt; ++i) {
+                if (A.tileIsLocal( i, j )) {
+                    A.tileGetForWriting( i, j, LayoutConvert( layout ) );
+                    trail_rows[ i ].push_back( trail.size() );
+                    trail_cols[ j ].push_back( trail.size() );
+                    trail.push_back( { i, j, A( i, j ) } );
+                }
+            }
+        }
+
+        Y.assign( n*ib, zero );
+        T.assign( ib*ib, zero );
+        w.resize( ib );
+        vrow.resize( ib );
+        scalar_t ei = zero;
+
+        //--------------------
+        // Panel, as in lahr2, on the replicated tile column.
+        // Unlike lahr2, Y( mtop:n, : ) is computed for all tiles in the loop.
+        for (int64_t i = 0; i < ib; ++i) {
+            int64_t c = c0 + i;
+            scalar_t* Pi = &P[ i*n ];
+
+            if (i > 0) {
+                // b = P( c0+1:n, i ) -= Y( c0+1:n, 0:i ) V( c, 0:i )^H.
+                for (int64_t j = 0; j < i; ++j)
+                    vrow[ j ] = conj( P[ c + j*n ] );
+                blas::gemv( layout, Op::NoTrans, n-c0-1, i,
+                            -one, &Y[ c0+1 ], n,
+                                  &vrow[ 0 ], 1,
+                            one,  &Pi[ c0+1 ], 1 );
+
+                // Apply I - V T^H V^H to b from the left,
+                // with V = [ V1; V2 ], b = [ b1; b2 ], V1 unit lower i-by-i.
+                // w = V1^H b1 + V2^H b2.
+                blas::copy( i, &Pi[ c0+1 ], 1, &w[ 0 ], 1 );
+                blas::trmv( layout, Uplo::Lower, Op::ConjTrans, Diag::Unit,
+                            i, &P[ c0+1 ], n, &w[ 0 ], 1 );
+                blas::gemv( layout, Op::ConjTrans, n-c-1, i,
+                            one, &P[ c+1 ], n,
+                                 &Pi[ c+1 ], 1,
+                            one, &w[ 0 ], 1 );
+                // w = T^H w.
+                blas::trmv( layout, Uplo::Upper, Op::ConjTrans, Diag::NonUnit,
+                            i, &T[ 0 ], ib, &w[ 0 ], 1 );
+                // b2 -= V2 w.
+                blas::gemv( layout, Op::NoTrans, n-c-1, i,
+                            -one, &P[ c+1 ], n,
+                                  &w[ 0 ], 1,
+                            one,  &Pi[ c+1 ], 1 );
+                // b1 -= V1 w.
+                blas::trmv( layout, Uplo::Lower, Op::NoTrans, Diag::Unit,
+                            i, &P[ c0+1 ], n, &w[ 0 ], 1 );
+                blas::axpy( i, -one, &w[ 0 ], 1, &Pi[ c0+1 ], 1 );
+
+                P[ c + (i-1)*n ] = ei;
+            }
+
+            // Generate reflector H(c) to annihilate P( c+2:n, i ).
+            lapack::larfg( n-c-1, &Pi[ c+1 ], &Pi[ std::min( c+2, n-1 ) ], 1,
+                           &tau[ c ] );
+            ei = Pi[ c+1 ];
+            Pi[ c+1 ] = one;
+
+            // Y( mtop:n, i ) = A( mtop:n, c+1:n ) v, with v = P( c+1:n, i ).
+            // Tiles right of the panel contribute local partial sums,
+            // one task per block row; the rest of the panel is added
+            // by rank 0 only.
+            scalar_t* Yi = &Y[ i*n ];
+            if (A.mpiRank() == 0 && i+1 < nbk) {
+                blas::gemv( layout, Op::NoTrans, n-mtop, nbk-i-1,
+                            one,  &P[ mtop + (i+1)*n ], n,
+                                  &Pi[ c+1 ], 1,
+                            zero, &Yi[ mtop ], 1 );
+            }
+            #pragma omp taskgroup
+            for (int64_t bi = 0; bi < nt; ++bi) {
+                if (offset[ bi+1 ] <= mtop || trail_rows[ bi ].empty())
+                    continue;
+
+                #pragma omp task slate_omp_default_none \
+                    shared( trail, trail_rows, offset ) \
+                    firstprivate( bi, mtop, Pi, Yi, one, layout )
+                {
+                    int64_t skip = std::max( mtop - offset[ bi ], int64_t( 0 ) );
+                    for (int64_t index : trail_rows[ bi ]) {
+                        auto& t = trail[ index ];
+                        blas::gemv( layout, Op::NoTrans,
+                                    t.tile.mb() - skip, t.tile.nb(),
+                                    one, &t.tile.data()[ skip ], t.tile.stride(),
+                                         &Pi[ offset[ t.j ] ], 1,
+                                    one, &Yi[ offset[ bi ] + skip ], 1 );
+                    }
+                }
+            }
+            {
+                trace::Block trace_block("MPI_Allreduce");
+                slate_mpi_call(
+                    MPI_Allreduce( MPI_IN_PLACE, &Yi[ mtop ], n-mtop,
+                                   mpi_scalar_type, MPI_SUM, A.mpiComm() ));
+            }
+
+            // T( 0:i, i ) = V( c+1:n, 0:i )^H v;
+            // Y( mtop:n, i ) = tau (Y( mtop:n, i )
+            //                       - Y( mtop:n, 0:i ) T( 0:i, i )).
+            scalar_t* Ti = &T[ i*ib ];
+            if (i > 0) {
+                blas::gemv( layout, Op::ConjTrans, n-c-1, i,
+                            one,  &P[ c+1 ], n,
+                                  &Pi[ c+1 ], 1,
+                            zero, Ti, 1 );
+                blas::gemv( layout, Op::NoTrans, n-mtop, i,
+                            -one, &Y[ mtop ], n,
+                                  Ti, 1,
+                            one,  &Yi[ mtop ], 1 );
+            }
+            blas::scal( n-mtop, tau[ c ], &Yi[ mtop ], 1 );
+
+            // T( 0:i, i ) = -tau T( 0:i, 0:i ) T( 0:i, i ); T( i, i ) = tau.
+            if (i > 0) {
+                blas::scal( i, -tau[ c ], Ti, 1 );
+                blas::trmv( layout, Uplo::Upper, Op::NoTrans, Diag::NonUnit,
+                            i, &T[ 0 ], ib, Ti, 1 );
+            }
+            Ti[ i ] = tau[ c ];
+        }
+        P[ c0+ib + (ib-1)*n ] = ei;
+
+        // Explicit V, n-by-ib, with zeros above and ones on its "diagonal".
+        V.assign( n*ib, zero );
+        for (int64_t j = 0; j < ib; ++j) {
+            int64_t r = c0 + j + 1;
+            V[ r + j*n ] = one;
+            blas::copy( n-r-1, &P[ r+1 + j*n ], 1, &V[ r+1 + j*n ], 1 );
+        }
+
+        //--------------------
+        // Y( 0:mtop, : ) = A( 0:mtop, c0+1:n ) V T, as in lahr2,
+        // with one all-reduce per panel.
+        Ytop.assign( mtop*ib, zero );
+        if (A.mpiRank() == 0 && nbk > 1) {
+            blas::gemm( layout, Op::NoTrans, Op::NoTrans,
+                        mtop, ib, nbk-1,
+                        one,  &P[ n ], n,
+                              &V[ c0+1 ], n,
+                        zero, &Ytop[ 0 ], mtop );
+        }
+        #pragma omp taskgroup
+        for (int64_t bi = 0; bi < nt && offset[ bi ] < mtop; ++bi) {
+            if (trail_rows[ bi ].empty())
+                continue;
+
+            #pragma omp task slate_omp_default_none \
+                shared( trail, trail_rows, offset, V, Ytop ) \
+                firstprivate( bi, mtop, ib, n, one, layout )
+            {
+                int64_t mb = std::min( A.tileMb( bi ), mtop - offset[ bi ] );
+                for (int64_t index : trail_rows[ bi ]) {
+                    auto& t = trail[ index ];
+                    blas::gemm( layout, Op::NoTrans, Op::NoTrans,
+                                mb, ib, t.tile.nb(),
+                                one, t.tile.data(), t.tile.stride(),
+                                     &V[ offset[ t.j ] ], n,
+                                one, &Ytop[ offset[ bi ] ], mtop );
+                }
+            }
+        }
+        {
+            trace::Block trace_block("MPI_Allreduce");
+            slate_mpi_call(
+                MPI_Allreduce( MPI_IN_PLACE, &Ytop[ 0 ], mtop*ib,
+                               mpi_scalar_type, MPI_SUM, A.mpiComm() ));
+        }
+        blas::trmm( layout, Side::Right, Uplo::Upper, Op::NoTrans,
+                    Diag::NonUnit, mtop, ib,
+                    one, &T[ 0 ], ib,
+                         &Ytop[ 0 ], mtop );
+        lapack::lacpy( lapack::MatrixType::General, mtop, ib,
+                       &Ytop[ 0 ], mtop, &Y[ 0 ], n );
+
+        //--------------------
+        // Right update, A( :, c0+ib:n ) -= Y V( c0+ib:n, : )^H,
+        // one task per local tile.
+        #pragma omp taskgroup
+        for (auto& t : trail) {
+            #pragma omp task slate_omp_default_none \
+                shared( t, offset, Y, V ) \
+                firstprivate( ib, n, one, layout )
+            {
+                blas::gemm( layout, Op::NoTrans, Op::ConjTrans,
+                            t.tile.mb(), t.tile.nb(), ib,
+                            -one, &Y[ offset[ t.i ] ], n,
+                                  &V[ offset[ t.j ] ], n,
+                            one,  t.tile.data(), t.tile.stride() );
+            }
+        }
+        // In the last tile column, the panel may be narrower than the tile.
+        if (ib < nbk) {
+            blas::gemm( layout, Op::NoTrans, Op::ConjTrans,
+                        n, nbk-ib, ib,
+                        -one, &Y[ 0 ], n,
+                              &V[ c0+ib ], n,
+                        one,  &P[ ib*n ], n );
+        }
+        // A( 0:c0+1, c0+1:c0+ib ) -= Y( 0:c0+1, : ) V( c0+1:c0+ib, : )^H.
+        if (ib > 1) {
+            blas::gemm( layout, Op::NoTrans, Op::ConjTrans,
+                        c0+1, ib-1, ib,
+                        -one, &Y[ 0 ], n,
+                              &V[ c0+1 ], n,
+                        one,  &P[ n ], n );
+        }
+
+        //--------------------
+        // Left update, A( c0+1:n, c0+ib:n ) -= V T^H V^H A( c0+1:n, c0+ib:n ).
+        // W is indexed by global column; one task per local block col.
+        W.assign( ib*n, zero );
+        #pragma omp taskgroup
+        for (int64_t bj = k+1; bj < nt; ++bj) {
+            if (trail_cols[ bj ].empty())
+                continue;
+
+            #pragma omp task slate_omp_default_none \
+                shared( trail, trail_cols, offset, V, W ) \
+                firstprivate( bj, k, ib, n, one, layout )
+            {
+                for (int64_t index : trail_cols[ bj ]) {
+                    auto& t = trail[ index ];
+                    if (t.i >= k) {
+                        blas::gemm( layout, Op::ConjTrans, Op::NoTrans,
+                                    ib, t.tile.nb(), t.tile.mb(),
+                                    one, &V[ offset[ t.i ] ], n,
+                                         t.tile.data(), t.tile.stride(),
+                                    one, &W[ offset[ bj ]*ib ], ib );
+                    }
+                }
+            }
+        }
+        int64_t nt_cols = n - offset[ k+1 ];
+        if (nt_cols > 0) {
+            trace::Block trace_block("MPI_Allreduce");
+            slate_mpi_call(
+                MPI_Allreduce( MPI_IN_PLACE, &W[ offset[ k+1 ]*ib ],
+                               ib*nt_cols, mpi_scalar_type,
+                               MPI_SUM, A.mpiComm() ));
+        }
+        if (ib < nbk) {
+            blas::gemm( layout, Op::ConjTrans, Op::NoTrans,
+                        ib, nbk-ib, n,
+                        one,  &V[ 0 ], n,
+                              &P[ ib*n ], n,
+                        zero, &W[ (c0+ib)*ib ], ib );
+        }
+        blas::trmm( layout, Side::Left, Uplo::Upper, Op::ConjTrans,
+                    Diag::NonUnit, ib, n-c0-ib,
+                    one, &T[ 0 ], ib,
+                         &W[ (c0+ib)*ib ], ib );
+        #pragma omp taskgroup
+        for (auto& t : trail) {
+            if (t.i < k)
+                continue;
+
+            #pragma omp task slate_omp_default_none \
+                shared( t, offset, V, W ) \
+                firstprivate( ib, n, one, layout )
+            {
+                blas::gemm( layout, Op::NoTrans, Op::NoTrans,
+                            t.tile.mb(), t.tile.nb(), ib,
+                            -one, &V[ offset[ t.i ] ], n,
+                                  &W[ offset[ t.j ]*ib ], ib,
+                            one,  t.tile.data(), t.tile.stride() );
+            }
+        }
+        if (ib < nbk) {
+            blas::gemm( layout, Op::NoTrans, Op::NoTrans,
+                        n, nbk-ib, ib,
+                        -one, &V[ 0 ], n,
+                              &W[ (c0+ib)*ib ], ib,
+                        one,  &P[ ib*n ], n );
+        }
+
+        // Copy the factored panel back to the local tiles of column k.
+        for (int64_t i = 0; i < nt; ++i) {
+            if (A.tileIsLocal( i, k )) {
+                A.tileGetForWriting( i, k, LayoutConvert( layout ) );
+                auto Aik = A( i, k );
+                lapack::lacpy( lapack::MatrixType::General,
+                               Aik.mb(), Aik.nb(),
+                               &P[ offset[ i ] ], n,
+                               Aik.data(), Aik.stride() );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gehrd<float>(
+    Matrix<float>& A,
+    std::vector<float>& tau,
+    Options const& opts);
+
+template
+void gehrd<double>(
+    Matrix<double>& A,
+    std::vector<double>& tau,
+    Options const& opts);
+
+template
+void gehrd< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    std::vector< std::complex<float> >& tau,
+    Options const& opts);
+
+template
+void gehrd< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    std::vector< std::complex<double> >& tau,
+    Options const& opts);
+
+} // namespace slate
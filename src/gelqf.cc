@@ -126,10 +126,9 @@ void gelqf(
         }
     }
 
-    // Workspace for transposed panels needs one column of tiles.
+    // Workspace for transposed panels needs one column of tiles,
+    // which are inserted for each panel and erased after it is factored.
     auto AT = A.emptyLike(0, 0, Op::ConjTrans);
-    // todo: we really only want to insert 1 column's worth at a time.
-    AT.insertLocalTiles();
 
     // LQ tracks dependencies by block-row.
     // OpenMP needs pointer types, but vectors are exception safe
@@ -181,6 +180,7 @@ void gelqf(
                     if (A_panel.tileIsLocal(0, j)) {
                         // Needed if origin is device
                         A_panel.tileGetForWriting( 0, j, LayoutConvert( layout ) );
+                        AT_panel.tileInsert( j, 0 );
                         tile::deepConjTranspose( A_panel(0, j), AT_panel(j, 0) );
                     }
                 }
@@ -209,9 +209,13 @@ void gelqf(
                         // Same as above for TlT
                         AT_panel.tileGetForReading( j, 0, LayoutConvert( layout ) );
                         tile::deepConjTranspose( AT_panel(j, 0), A_panel(0, j) );
+                        AT_panel.tileErase( j, 0, AllDevices );
                     }
                 }
-                // todo: AT_panel.clear();
+                // Tlocal has the T factors now.
+                for (int64_t i = 0; i < TlT_panel.mt(); ++i) {
+                    TlT_panel.tileErase( i, 0, AllDevices );
+                }
                 //--------------------
 
                 // triangle-triangle reductions
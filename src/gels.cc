@@ -25,21 +25,21 @@ namespace slate {
 /// $BX$ is m-by-nrhs.
 /// On input, $B$ is all m rows of $BX$.
 /// On output, $X$ is first n rows of $BX$.
-/// Currently in this case $A$ must be not transposed.
 ///
 /// If m < n, solves under-determined $A X = B$
 /// with minimum norm solution $X$ that minimizes $\norm{ X }_2$.
 /// $BX$ is n-by-nrhs.
 /// On input, $B$ is first m rows of $BX$.
 /// On output, $X$ is all n rows of $BX$.
-/// Currently in this case $A$ must be transposed (only if real) or
-/// conjugate-transposed.
 ///
 /// Several right hand side vectors $b$ and solution vectors $x$ can be
 /// handled in a single call; they are stored as the columns of the
 /// m-by-nrhs right hand side matrix $B$ and the n-by-nrhs solution
 /// matrix $X$.
 ///
+/// If timers::Timers is on, the time of each phase is recorded as
+/// "gels::geqrf", "gels::unmqr", "gels::trsm", etc.
+///
 /// Note these (m, n) differ from (M, N) in (Sca)LAPACK, where the original
 /// $A$ is M-by-N, _before_ appyling any transpose,
 /// while here $A$ is m-by-n, _after_ applying any transpose,.
@@ -60,7 +60,7 @@ namespace slate {
 ///     If (m >= n and $A$ is (conjugate) transposed) or
 ///        (m <  n and $A$ is not transposed),
 ///     $A$ is overwritten by details of its LQ factorization
-///     as returned by gelqf (todo: not currently supported).
+///     as returned by gelqf.
 ///
 /// @param[in,out] BX
 ///     Matrix of size max(m,n)-by-nrhs.
@@ -10,6 +10,8 @@
 #include "slate/TriangularMatrix.hh"
 #include "internal/internal.hh"
 
+#include <lapack/flops.hh>
+
 namespace slate {
 
 //------------------------------------------------------------------------------
@@ -25,15 +27,12 @@ namespace slate {
 /// $BX$ is m-by-nrhs.
 /// On input, $B$ is all m rows of $BX$.
 /// On output, $X$ is first n rows of $BX$.
-/// Currently in this case $A$ must be not transposed.
 ///
 /// If m < n, solves under-determined $A X = B$
 /// with minimum norm solution $X$ that minimizes $\norm{ X }_2$.
 /// $BX$ is n-by-nrhs.
 /// On input, $B$ is first m rows of $BX$.
 /// On output, $X$ is all n rows of $BX$.
-/// Currently in this case $A$ must be transposed (only if real) or
-/// conjugate-transposed.
 ///
 /// Several right hand side vectors $b$ and solution vectors $x$ can be
 /// handled in a single call; they are stored as the columns of the
@@ -50,21 +49,19 @@ namespace slate {
 //------------------------------------------------------------------------------
 /// @param[in,out] A
 ///     On entry, the m-by-n matrix $A$.
-///     On exit:
+///     On exit, let $A_0$ be the original, un-transposed matrix.
 ///     <br>
-///     If (m >= n and $A$ is not transposed) or
-///        (m <  n and $A$ is (conjugate) transposed),
-///     $A$ is overwritten by details of its QR factorization
-///     as returned by geqrf.
+///     If $A_0$ is tall or square, $A_0$ is overwritten by
+///     the $Q$ factor of its CholeskyQR factorization $A_0 = Q R$.
 ///     <br>
-///     If (m >= n and $A$ is (conjugate) transposed) or
-///        (m <  n and $A$ is not transposed),
-///     $A$ is overwritten by details of its LQ factorization
-///     as returned by gelqf (todo: not currently supported).
+///     If $A_0$ is wide, $A_0$ is overwritten by $Q^H$ from the
+///     CholeskyQR factorization $A_0^H = Q R$, which is the LQ-style
+///     factorization $A_0 = L Q^H$ with $L = R^H$.
+///     $A_0^H$ is factored in place; no transposed copy is made.
 ///
 /// @param[out] R
-///     The triangular matrix from the CholeskyQR factorization,
-///     as returned by cholqr.
+///     The min(m, n)-by-min(m, n) upper triangular matrix from the
+///     CholeskyQR factorization, as returned by cholqr.
 ///
 /// @param[in,out] BX
 ///     Matrix of size max(m,n)-by-nrhs.
@@ -119,63 +116,76 @@ void gels_cholqr(
 
     int64_t A0_M = (A.op() == Op::NoTrans ? m : n);
     int64_t A0_N = (A.op() == Op::NoTrans ? n : m);
-    if (A0_M >= A0_N) {
-        assert( A0.m() >= A0.n() );
-
-        // A0 itself is tall: QR factorization
-        R = A0.emptyLike();
-        R = R.slice( 0, A0_N-1, 0, A0_N-1 );
-        R.insertLocalTiles();
-
-        cholqr( A0, R, opts );
-
-        auto R_U = TriangularMatrix( Uplo::Upper, Diag::NonUnit, R );
-
-        if (A.op() == Op::NoTrans) {
-            // Solve A X = (QR) X = B.
-            // Least squares solution X = R^{-1} Y = R^{-1} (Q^H B).
-            // A and Q are m-by-n, R is n-by-n, X and Y are n-by-nrhs,
-            // B is m-by-nrhs, m >= n.
-
-            Matrix<scalar_t> QH = conj_transpose( A );
-
-            // X is first n rows of BX. Y is also n rows.
-            auto X = BX.slice( 0, n-1, 0, nrhs-1 );
-            auto Y = X.emptyLike();
-            Y.insertLocalTiles();
-
-            // Y = Q^H B
-            gemm( one, QH, BX, zero, Y );
-
-            // Copy back the result
-            copy( Y, X );
-
-            // X = R^{-1} Y
-            trsm( Side::Left, one, R_U, X, opts );
-        }
-        else {
-            // Solve A X = A0^H X = (QR)^H X = B.
-            // Minimum norm solution X = Q Y = Q (R^{-H} B).
-            // A is m-by-n, A0 and Q are n-by-m, R is m-by-m, X is n-by-nrhs,
-            // B and Y are m-by-nrhs, m < n.
-
-            // B is first m rows of BX. Y is also m rows.
-            auto B = BX.slice( 0, m-1, 0, nrhs-1 );
-            auto Y = B.emptyLike();
-            Y.insertLocalTiles();
-            copy( B, Y );
-
-            // Y = R^{-H} B
-            auto RH = conj_transpose( R_U );
-            trsm( Side::Left, one, RH, Y, opts );
-
-            // X = Q Y, with Q stored in A0.
-            gemm( one, A0, Y, zero, BX );
-        }
+    int64_t min_mn = std::min( m, n );
+
+    // Factor the tall one of A0 and A0^H, in place, as Q R.
+    // If A0 is wide, this is an LQ-style factorization A0 = L Q^H,
+    // with L = R^H, done on the conjugate-transposed view of A0.
+    Matrix<scalar_t> Atall = A0;
+    if (A0_M < A0_N)
+        Atall = conj_transpose( A0 );
+    assert( Atall.m() >= Atall.n() );
+
+    R = A0.emptyLike();
+    R = R.slice( 0, min_mn-1, 0, min_mn-1 );
+    R.insertLocalTiles();
+
+    timers::Phase t_cholqr( "gels::cholqr" );
+    cholqr( Atall, R, opts );
+    t_cholqr.stop( 2*blas::Gflop<scalar_t>::gemm( min_mn, min_mn, Atall.m() ) );
+
+    auto R_U = TriangularMatrix( Uplo::Upper, Diag::NonUnit, R );
+
+    if ((A0_M >= A0_N) == (A.op() == Op::NoTrans)) {
+        // op(A) itself is tall, A = Atall.
+        // Solve A X = (QR) X = B.
+        // Least squares solution X = R^{-1} Y = R^{-1} (Q^H B).
+        // A and Q are m-by-n, R is n-by-n, X and Y are n-by-nrhs,
+        // B is m-by-nrhs, m >= n.
+
+        Matrix<scalar_t> QH = conj_transpose( Atall );
+
+        // X is first n rows of BX. Y is also n rows.
+        auto X = BX.slice( 0, n-1, 0, nrhs-1 );
+        auto Y = X.emptyLike();
+        Y.insertLocalTiles();
+
+        // Y = Q^H B
+        timers::Phase t_gemm( "gels::gemm" );
+        gemm( one, QH, BX, zero, Y );
+        t_gemm.stop( blas::Gflop<scalar_t>::gemm( n, nrhs, m ) );
+
+        // Copy back the result
+        copy( Y, X );
+
+        // X = R^{-1} Y
+        timers::Phase t_trsm( "gels::trsm" );
+        trsm( Side::Left, one, R_U, X, opts );
+        t_trsm.stop( blas::Gflop<scalar_t>::trsm( Side::Left, n, nrhs ) );
     }
     else {
-        // todo: LQ factorization
-        slate_not_implemented( "least squares using LQ" );
+        // op(A) is wide, A = Atall^H.
+        // Solve A X = (QR)^H X = B.
+        // Minimum norm solution X = Q Y = Q (R^{-H} B).
+        // A is m-by-n, Q is n-by-m, R is m-by-m, X is n-by-nrhs,
+        // B and Y are m-by-nrhs, m < n.
+
+        // B is first m rows of BX. Y is also m rows.
+        auto B = BX.slice( 0, m-1, 0, nrhs-1 );
+        auto Y = B.emptyLike();
+        Y.insertLocalTiles();
+        copy( B, Y );
+
+        // Y = R^{-H} B
+        timers::Phase t_trsm( "gels::trsm" );
+        auto RH = conj_transpose( R_U );
+        trsm( Side::Left, one, RH, Y, opts );
+        t_trsm.stop( blas::Gflop<scalar_t>::trsm( Side::Left, m, nrhs ) );
+
+        // X = Q Y, with Q stored in Atall.
+        timers::Phase t_gemm( "gels::gemm" );
+        gemm( one, Atall, Y, zero, BX );
+        t_gemm.stop( blas::Gflop<scalar_t>::gemm( n, nrhs, m ) );
     }
     // todo: return value for errors?
     // R or L is singular => A is not full rank
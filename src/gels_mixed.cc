@@ -0,0 +1,261 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "slate/Tile_blas.hh"
+#include "slate/TriangularMatrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel iterative-refinement least squares solve.
+///
+/// Solves the over-determined system $A X = B$, with least squares
+/// solution $X$ that minimizes $\norm{ A X - B }_2$, where $A$ is an
+/// m-by-n matrix, m >= n, with full rank.
+///
+/// gels_mixed first factors $A = Q R$ in low precision (single), using
+/// geqrf or cholqr, and solves for an initial $X$ in low precision.
+/// It then refines $X$ using the corrected semi-normal equations:
+/// \[
+///     R = B - A X, \quad
+///     R_{lo}^H R_{lo} D = A^H R, \quad
+///     X = X + D,
+/// \]
+/// where the residual and $A^H R$ are computed in high precision (double)
+/// and the triangular solves with $R_{lo}$ are in low precision.
+/// This converges if $\kappa(A)^2 \epsilon_{\mathrm{lo}}$ is sufficiently
+/// less than 1. If the approach fails, the method falls back to a
+/// high precision (double) QR factorization and solve.
+///
+/// The iterative refinement process is stopped if iter > itermax or
+/// for all the RHS, $1 \le j \le nrhs$, we have:
+///     $\norm{A^H r_j}_{inf} < \sqrt{n} \norm{A}_{1} \epsilon_{\mathrm{hi}}
+///         (\norm{A}_{1} \norm{x_j}_{inf} + \norm{r_j}_{inf}),$
+/// where:
+/// - iter is the number of the current iteration in the iterative refinement
+///    process
+/// - $r_j = b_j - A x_j$ is the residual, which need not be small
+///    if the system is not consistent
+/// - $\norm{x_j}_{inf}$ is the infinity-norm of the solution
+/// - $\epsilon_{\mathrm{hi}}$ is the machine epsilon of double precision.
+///
+/// The value itermax is fixed to 30.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_hi
+///     One of double, std::complex<double>.
+///
+/// @tparam scalar_lo
+///     One of float, std::complex<float>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the m-by-n matrix $A$, m >= n, not transposed.
+///     On exit, if iterative refinement has been successfully used
+///     (iter >= 0), $A$ is unchanged. If high precision (double)
+///     factorization has been used (iter < 0), $A$ is overwritten
+///     by details of its QR factorization, as in gels_qr.
+///
+/// @param[in,out] BX
+///     Matrix of size m-by-nrhs.
+///     On entry, the m-by-nrhs right hand side matrix $B$.
+///     On exit, the first n rows contain the n-by-nrhs solution matrix $X$.
+///
+/// @param[out] iter
+///     The number of the iterations in the iterative refinement
+///     process, needed for the convergence. If failed, it is set
+///     to be -(1+itermax), where itermax = 30.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::MethodGels:
+///       Low precision factorization. Possible values:
+///       - MethodGels::Geqrf: QR factorization [default].
+///       - MethodGels::Cholqr: Cholesky QR factorization, which requires
+///         $\kappa(A)^2 \epsilon_{\mathrm{lo}} < 1$.
+///     - Option::Lookahead:
+///       Number of panels to overlap with matrix updates.
+///       lookahead >= 0. Default 1.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup gels
+///
+template <typename scalar_hi, typename scalar_lo>
+void gels_mixed(
+    Matrix<scalar_hi>& A,
+    Matrix<scalar_hi>& BX,
+    int& iter,
+    Options const& opts)
+{
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+    Method method = get_option( opts, Option::MethodGels, MethodGels::Geqrf );
+    if (method == MethodGels::Auto)
+        method = MethodGels::select_algo( A, BX, opts );
+
+    bool converged = false;
+    const int itermax = 30;
+    using real_hi = blas::real_type<scalar_hi>;
+    const real_hi eps = std::numeric_limits<real_hi>::epsilon();
+    const scalar_hi zero_hi = 0.0;
+    const scalar_hi one_hi  = 1.0;
+    const scalar_lo one_lo  = 1.0;
+    iter = 0;
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t nrhs = BX.n();
+
+    slate_error_if( A.op() != Op::NoTrans );
+    slate_error_if( m < n );
+    slate_error_if( BX.m() != m );
+
+    // X is first n rows of BX.
+    auto X = BX.slice( 0, n-1, 0, nrhs-1 );
+
+    // workspace
+    auto B     = BX.emptyLike();
+    auto R     = BX.emptyLike();
+    auto AHR   = X.emptyLike();
+    auto D     = X.emptyLike();
+    auto A_lo  = A.template emptyLike<scalar_lo>();
+    auto BX_lo = BX.template emptyLike<scalar_lo>();
+    auto D_lo  = X.template emptyLike<scalar_lo>();
+
+    std::vector<real_hi> colnorms_X( nrhs );
+    std::vector<real_hi> colnorms_R( nrhs );
+    std::vector<real_hi> colnorms_AHR( nrhs );
+
+    // insert local tiles
+    B.    insertLocalTiles( target );
+    R.    insertLocalTiles( target );
+    AHR.  insertLocalTiles( target );
+    D.    insertLocalTiles( target );
+    A_lo. insertLocalTiles( target );
+    BX_lo.insertLocalTiles( target );
+    D_lo. insertLocalTiles( target );
+
+    // Save B, since BX is overwritten.
+    slate::copy( BX, B, opts );
+
+    // norm of A
+    real_hi Anorm = norm( Norm::One, A, opts );
+
+    // stopping criteria
+    real_hi cte = Anorm * eps * std::sqrt( n );
+
+    // Convert A and B from high to low precision.
+    copy( A, A_lo, opts );
+    copy( BX, BX_lo, opts );
+
+    // Least squares solve in low precision, keeping the triangular factor.
+    Matrix<scalar_lo> R_lo;
+    if (method == MethodGels::Cholqr) {
+        gels_cholqr( A_lo, R_lo, BX_lo, opts );
+    }
+    else {
+        TriangularFactors<scalar_lo> T_lo;
+        gels_qr( A_lo, T_lo, BX_lo, opts );
+        R_lo = A_lo.slice( 0, n-1, 0, n-1 );
+    }
+    auto R_U  = TriangularMatrix<scalar_lo>( Uplo::Upper, Diag::NonUnit, R_lo );
+    auto R_UH = conj_transpose( R_U );
+    auto AH   = conj_transpose( A );
+
+    // Convert the low precision solution to high precision.
+    auto X_lo = BX_lo.slice( 0, n-1, 0, nrhs-1 );
+    copy( X_lo, X, opts );
+
+    // iterative refinement
+    for (int iiter = 0; iiter <= itermax; ++iiter) {
+        // Compute R = B - A * X.
+        slate::copy( B, R, opts );
+        gemm<scalar_hi>(
+            -one_hi, A,
+                     X,
+            one_hi,  R, opts );
+
+        // Compute AHR = A^H R.
+        gemm<scalar_hi>(
+            one_hi, AH,
+                    R,
+            zero_hi, AHR, opts );
+
+        // Check whether the nrhs normwise backward error of the normal
+        // equations satisfies the stopping criterion.
+        // Also converts AHR to low precision, storing the result in D_lo.
+        colNorms( Norm::Max, R, colnorms_R.data(), opts );
+        internal::iterRefColNorms(
+            X, AHR, D_lo, colnorms_X.data(), colnorms_AHR.data(), opts );
+
+        converged = true;
+        for (int64_t j = 0; j < nrhs; ++j) {
+            if (colnorms_AHR[ j ]
+                > cte * (Anorm * colnorms_X[ j ] + colnorms_R[ j ])) {
+                converged = false;
+                break;
+            }
+        }
+        if (converged) {
+            iter = iiter;
+            break;
+        }
+        if (iiter == itermax)
+            break;
+
+        // Solve R_lo^H R_lo D_lo = AHR_lo.
+        trsm( Side::Left, one_lo, R_UH, D_lo, opts );
+        trsm( Side::Left, one_lo, R_U,  D_lo, opts );
+
+        // Update the current iterate, X += D.
+        copy( D_lo, D, opts );
+        add( one_hi, D, one_hi, X, opts );
+    }
+
+    if (! converged) {
+        // If we are at this place of the code, this is because we have performed
+        // iter = itermax iterations and never satisfied the stopping criterion,
+        // set up the iter flag accordingly and follow up with double precision
+        // routine.
+        iter = -itermax - 1;
+
+        slate::copy( B, BX, opts );
+        TriangularFactors<scalar_hi> T;
+        gels_qr( A, T, BX, opts );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template <>
+void gels_mixed<double>(
+    Matrix<double>& A,
+    Matrix<double>& BX,
+    int& iter,
+    Options const& opts)
+{
+    gels_mixed<double, float>( A, BX, iter, opts );
+}
+
+template <>
+void gels_mixed< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& BX,
+    int& iter,
+    Options const& opts)
+{
+    gels_mixed<std::complex<double>, std::complex<float>>(
+        A, BX, iter, opts );
+}
+
+} // namespace slate
@@ -10,6 +10,8 @@
 #include "slate/TriangularMatrix.hh"
 #include "internal/internal.hh"
 
+#include <lapack/flops.hh>
+
 namespace slate {
 
 //------------------------------------------------------------------------------
@@ -25,15 +27,12 @@ namespace slate {
 /// $BX$ is m-by-nrhs.
 /// On input, $B$ is all m rows of $BX$.
 /// On output, $X$ is first n rows of $BX$.
-/// Currently in this case $A$ must be not transposed.
 ///
 /// If m < n, solves under-determined $A X = B$
 /// with minimum norm solution $X$ that minimizes $\norm{ X }_2$.
 /// $BX$ is n-by-nrhs.
 /// On input, $B$ is first m rows of $BX$.
 /// On output, $X$ is all n rows of $BX$.
-/// Currently in this case $A$ must be transposed (only if real) or
-/// conjugate-transposed.
 ///
 /// Several right hand side vectors $b$ and solution vectors $x$ can be
 /// handled in a single call; they are stored as the columns of the
@@ -60,7 +59,7 @@ namespace slate {
 ///     If (m >= n and $A$ is (conjugate) transposed) or
 ///        (m <  n and $A$ is not transposed),
 ///     $A$ is overwritten by details of its LQ factorization
-///     as returned by gelqf (todo: not currently supported).
+///     as returned by gelqf.
 ///
 /// @param[out] T
 ///     The triangular matrices of the block reflectors from the
@@ -76,6 +75,9 @@ namespace slate {
 ///     - Option::Lookahead:
 ///       Number of panels to overlap with matrix updates.
 ///       lookahead >= 0. Default 1.
+///     - Option::PanelAggregation:
+///       Number of consecutive panels to merge into one block reflector
+///       in unmqr. Default 1.
 ///     - Option::Target:
 ///       Implementation to target. Possible values:
 ///       - HostTask:  OpenMP tasks on CPU host [default].
@@ -119,11 +121,20 @@ void gels_qr(
 
     int64_t A0_M = (A.op() == Op::NoTrans ? m : n);
     int64_t A0_N = (A.op() == Op::NoTrans ? n : m);
+
+    // Estimated flops of phases, for timers.
+    const double unm_gflop = lapack::Gflop<scalar_t>::unmqr(
+        lapack::Side::Left, std::max( m, n ), nrhs, std::min( m, n ) );
+    const double trsm_gflop = blas::Gflop<scalar_t>::trsm(
+        Side::Left, std::min( m, n ), nrhs );
+
     if (A0_M >= A0_N) {
         assert( A0.m() >= A0.n() );
 
         // A0 itself is tall: QR factorization
+        timers::Phase t_geqrf( "gels::geqrf" );
         geqrf( A0, T, opts );
+        t_geqrf.stop( lapack::Gflop<scalar_t>::geqrf( A0_M, A0_N ) );
 
         int64_t min_mn = std::min( m, n );
         auto R_ = A0.slice( 0, min_mn-1, 0, min_mn-1 );
@@ -135,13 +146,17 @@ void gels_qr(
 
             // Y = Q^H B
             // B is all m rows of BX.
+            timers::Phase t_unmqr( "gels::unmqr" );
             unmqr( Side::Left, Op::ConjTrans, A0, T, BX, opts );
+            t_unmqr.stop( unm_gflop );
 
             // X is first n rows of BX.
             auto X = BX.slice( 0, n-1, 0, nrhs-1 );
 
             // X = R^{-1} Y
+            timers::Phase t_trsm( "gels::trsm" );
             trsm( Side::Left, one, R, X, opts );
+            t_trsm.stop( trsm_gflop );
         }
         else {
             // Solve A X = A0^H X = (QR)^H X = B.
@@ -151,8 +166,10 @@ void gels_qr(
             auto B = BX.slice( 0, m-1, 0, nrhs-1 );
 
             // Y = R^{-H} B
+            timers::Phase t_trsm( "gels::trsm" );
             auto RH = conj_transpose( R );
             trsm( Side::Left, one, RH, B, opts );
+            t_trsm.stop( trsm_gflop );
 
             // X is all n rows of BX.
             // Zero out rows m:n-1 of BX.
@@ -162,12 +179,64 @@ void gels_qr(
             }
 
             // X = Q Y
+            timers::Phase t_unmqr( "gels::unmqr" );
             unmqr( Side::Left, Op::NoTrans, A0, T, BX, opts );
+            t_unmqr.stop( unm_gflop );
         }
     }
     else {
-        // todo: LQ factorization
-        slate_not_implemented( "least squares using LQ" );
+        assert( A0.m() < A0.n() );
+
+        // A0 itself is wide: LQ factorization
+        timers::Phase t_gelqf( "gels::gelqf" );
+        gelqf( A0, T, opts );
+        t_gelqf.stop( lapack::Gflop<scalar_t>::gelqf( A0_M, A0_N ) );
+
+        int64_t min_mn = std::min( m, n );
+        auto L_ = A0.slice( 0, min_mn-1, 0, min_mn-1 );
+        auto L = TriangularMatrix<scalar_t>(Uplo::Lower, Diag::NonUnit, L_);
+
+        if (A.op() == Op::NoTrans) {
+            // Solve A0 X = (LQ) X = B.
+            // Minimum norm solution X = Q^H Y = Q^H (L^{-1} B).
+
+            // B is first m rows of BX.
+            auto B = BX.slice( 0, m-1, 0, nrhs-1 );
+
+            // Y = L^{-1} B
+            timers::Phase t_trsm( "gels::trsm" );
+            trsm( Side::Left, one, L, B, opts );
+            t_trsm.stop( trsm_gflop );
+
+            // X is all n rows of BX.
+            // Zero out rows m:n-1 of BX.
+            auto Z = BX.slice( m, n-1, 0, nrhs-1 );
+            set( zero, Z );
+
+            // X = Q^H Y
+            timers::Phase t_unmlq( "gels::unmlq" );
+            unmlq( Side::Left, Op::ConjTrans, A0, T, BX, opts );
+            t_unmlq.stop( unm_gflop );
+        }
+        else {
+            // Solve A X = A0^H X = (LQ)^H X = B.
+            // Least squares solution X = L^{-H} Y = L^{-H} (Q B).
+
+            // Y = Q B
+            // B is all m rows of BX.
+            timers::Phase t_unmlq( "gels::unmlq" );
+            unmlq( Side::Left, Op::NoTrans, A0, T, BX, opts );
+            t_unmlq.stop( unm_gflop );
+
+            // X is first n rows of BX.
+            auto X = BX.slice( 0, n-1, 0, nrhs-1 );
+
+            // X = L^{-H} Y
+            timers::Phase t_trsm( "gels::trsm" );
+            auto LH = conj_transpose( L );
+            trsm( Side::Left, one, LH, X, opts );
+            t_trsm.stop( trsm_gflop );
+        }
     }
     // todo: return value for errors?
     // R or L is singular => A is not full rank
@@ -53,6 +53,15 @@ namespace slate {
 ///           - Auto: let the routine decides [default]
 ///           - gemmA: select gemmA routine
 ///           - gemmC: select gemmC routine
+///         - Option::Gemm3M:
+///           Experimental. For complex types with HostTask and gemmC,
+///           multiply tiles using 3 real gemms instead of 4 (3M algorithm).
+///           This saves 25% of the flops, with a somewhat larger error.
+///           Default false.
+///         - Option::GemmPacked:
+///           For real types with HostTask and gemmC, if BLAS is MKL, pack
+///           each tile of A and B once with MKL's packed gemm and reuse it
+///           for all tiles of C it updates. Ignored otherwise. Default false.
 ///         - Option::Target:
 ///           Implementation to target. Possible values:
 ///           - HostTask:  OpenMP tasks on CPU host [default].
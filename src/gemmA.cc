@@ -46,6 +46,8 @@ void gemmA(
     int64_t lookahead = get_option<int64_t>( opts, Option::Lookahead, 1 );
     auto tileStrategy = get_option<TileReleaseStrategy>(
             opts, Option::TileReleaseStrategy, TileReleaseStrategy::Slate );
+    Method method_reduce = get_option<Method>(
+            opts, Option::MethodReduce, MethodReduce::Auto );
 
     Options local_opts = opts;
     local_opts[ Option::Lookahead ] = lookahead;
@@ -129,7 +131,7 @@ void gemmA(
                                           {A.sub( i, i, 0, A.nt()-1 )}
                                         } );
             int tag_0 = 0;
-            C.template listReduce( reduce_list_C, layout, tag_0 );
+            C.template listReduce( reduce_list_C, layout, tag_0, method_reduce );
         }
         // Clean the memory introduced by internal::gemmA on Devices
         if (target == Target::Devices) {
@@ -192,7 +194,7 @@ void gemmA(
                                               {A.sub( i, i, 0, A.nt()-1 )}
                                             } );
                 int tag_k = k;
-                C.template listReduce( reduce_list_C, layout, tag_k );
+                C.template listReduce( reduce_list_C, layout, tag_k, method_reduce );
             }
             // Clean the memory introduced by internal::gemmA on Devices
             if (target == Target::Devices) {
@@ -265,6 +267,10 @@ void gemmA(
 ///         - Option::Lookahead:
 ///           Number of blocks to overlap communication and computation.
 ///           lookahead >= 0. Default 1.
+///         - Option::MethodReduce:
+///           Algorithm to sum partial C tiles across process rows.
+///           Possible values: Auto [default], Binomial, ReduceScatter,
+///           Pipelined. See MethodReduce.
 ///         - Option::Target:
 ///           Implementation to target. Possible values:
 ///           - HostTask:  OpenMP tasks on CPU host [default].
@@ -67,6 +67,11 @@ void gemmC(
         C.reserveDeviceWorkspace();
     }
 
+    // With a single rank on the host, all tiles are local, so skip the
+    // broadcasts and workspace release. Devices still use the broadcasts
+    // to prefetch tiles.
+    bool is_comm = target == Target::Devices || C.mpiSize() > 1;
+
     // set min number for omp nested active parallel regions
     slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
 
@@ -85,17 +90,19 @@ void gemmC(
         // send first block col of A and block row of B
         #pragma omp task depend(out:bcast[0])
         {
-            // broadcast A(i, 0) to ranks owning block row C(i, :)
-            BcastListTag bcast_list_A;
-            for (int64_t i = 0; i < A.mt(); ++i)
-                bcast_list_A.push_back({i, 0, {C.sub(i, i, 0, C.nt()-1)}, i});
-            A.template listBcastMT<target>(bcast_list_A, layout);
-
-            // broadcast B(0, j) to ranks owning block col C(:, j)
-            BcastListTag bcast_list_B;
-            for (int64_t j = 0; j < B.nt(); ++j)
-                bcast_list_B.push_back({0, j, {C.sub(0, C.mt()-1, j, j)}, j});
-            B.template listBcastMT<target>(bcast_list_B, layout);
+            if (is_comm) {
+                // broadcast A(i, 0) to ranks owning block row C(i, :)
+                BcastListTag bcast_list_A;
+                for (int64_t i = 0; i < A.mt(); ++i)
+                    bcast_list_A.push_back({i, 0, {C.sub(i, i, 0, C.nt()-1)}, i});
+                A.template listBcastMT<target>(bcast_list_A, layout);
+
+                // broadcast B(0, j) to ranks owning block col C(:, j)
+                BcastListTag bcast_list_B;
+                for (int64_t j = 0; j < B.nt(); ++j)
+                    bcast_list_B.push_back({0, j, {C.sub(0, C.mt()-1, j, j)}, j});
+                B.template listBcastMT<target>(bcast_list_B, layout);
+            }
         }
 
         // send next lookahead block cols of A and block rows of B
@@ -103,17 +110,19 @@ void gemmC(
             #pragma omp task depend(in:bcast[k-1]) \
                              depend(out:bcast[k])
             {
-                // broadcast A(i, k) to ranks owning block row C(i, :)
-                BcastListTag bcast_list_A;
-                for (int64_t i = 0; i < A.mt(); ++i)
-                    bcast_list_A.push_back({i, k, {C.sub(i, i, 0, C.nt()-1)}, i});
-                A.template listBcastMT<target>(bcast_list_A, layout);
+                if (is_comm) {
+                    // broadcast A(i, k) to ranks owning block row C(i, :)
+                    BcastListTag bcast_list_A;
+                    for (int64_t i = 0; i < A.mt(); ++i)
+                        bcast_list_A.push_back({i, k, {C.sub(i, i, 0, C.nt()-1)}, i});
+                    A.template listBcastMT<target>(bcast_list_A, layout);
 
-                // broadcast B(k, j) to ranks owning block col C(:, j)
-                BcastListTag bcast_list_B;
-                for (int64_t j = 0; j < B.nt(); ++j)
-                    bcast_list_B.push_back({k, j, {C.sub(0, C.mt()-1, j, j)}, j});
-                B.template listBcastMT<target>(bcast_list_B, layout);
+                    // broadcast B(k, j) to ranks owning block col C(:, j)
+                    BcastListTag bcast_list_B;
+                    for (int64_t j = 0; j < B.nt(); ++j)
+                        bcast_list_B.push_back({k, j, {C.sub(0, C.mt()-1, j, j)}, j});
+                    B.template listBcastMT<target>(bcast_list_B, layout);
+                }
             }
         }
 
@@ -131,13 +140,15 @@ void gemmC(
             auto A_colblock = A.sub(0, A.mt()-1, 0, 0);
             auto B_rowblock = B.sub(0, 0, 0, B.nt()-1);
 
-            // Erase remote tiles on all devices including host
-            A_colblock.releaseRemoteWorkspace();
-            B_rowblock.releaseRemoteWorkspace();
+            if (is_comm) {
+                // Erase remote tiles on all devices including host
+                A_colblock.releaseRemoteWorkspace();
+                B_rowblock.releaseRemoteWorkspace();
 
-            // Erase local workspace on devices.
-            A_colblock.releaseLocalWorkspace();
-            B_rowblock.releaseLocalWorkspace();
+                // Erase local workspace on devices.
+                A_colblock.releaseLocalWorkspace();
+                B_rowblock.releaseLocalWorkspace();
+            }
         }
 
         for (int64_t k = 1; k < A.nt(); ++k) {
@@ -148,21 +159,23 @@ void gemmC(
                                  depend(in:bcast[k+lookahead-1]) \
                                  depend(out:bcast[k+lookahead])
                 {
-                    // broadcast A(i, k+la) to ranks owning block row C(i, :)
-                    BcastListTag bcast_list_A;
-                    for (int64_t i = 0; i < A.mt(); ++i) {
-                        bcast_list_A.push_back(
-                            {i, k+lookahead, {C.sub(i, i, 0, C.nt()-1)}, i});
-                    }
-                    A.template listBcastMT<target>(bcast_list_A, layout);
-
-                    // broadcast B(k+la, j) to ranks owning block col C(:, j)
-                    BcastListTag bcast_list_B;
-                    for (int64_t j = 0; j < B.nt(); ++j) {
-                        bcast_list_B.push_back(
-                            {k+lookahead, j, {C.sub(0, C.mt()-1, j, j)}, j});
+                    if (is_comm) {
+                        // broadcast A(i, k+la) to ranks owning block row C(i, :)
+                        BcastListTag bcast_list_A;
+                        for (int64_t i = 0; i < A.mt(); ++i) {
+                            bcast_list_A.push_back(
+                                {i, k+lookahead, {C.sub(i, i, 0, C.nt()-1)}, i});
+                        }
+                        A.template listBcastMT<target>(bcast_list_A, layout);
+
+                        // broadcast B(k+la, j) to ranks owning block col C(:, j)
+                        BcastListTag bcast_list_B;
+                        for (int64_t j = 0; j < B.nt(); ++j) {
+                            bcast_list_B.push_back(
+                                {k+lookahead, j, {C.sub(0, C.mt()-1, j, j)}, j});
+                        }
+                        B.template listBcastMT<target>(bcast_list_B, layout);
                     }
-                    B.template listBcastMT<target>(bcast_list_B, layout);
                 }
             }
 
@@ -180,13 +193,15 @@ void gemmC(
                 auto A_colblock = A.sub(0, A.mt()-1, k, k);
                 auto B_rowblock = B.sub(k, k, 0, B.nt()-1);
 
-                // Erase remote tiles on all devices including host
-                A_colblock.releaseRemoteWorkspace();
-                B_rowblock.releaseRemoteWorkspace();
+                if (is_comm) {
+                    // Erase remote tiles on all devices including host
+                    A_colblock.releaseRemoteWorkspace();
+                    B_rowblock.releaseRemoteWorkspace();
 
-                // Erase local workspace on devices.
-                A_colblock.releaseLocalWorkspace();
-                B_rowblock.releaseLocalWorkspace();
+                    // Erase local workspace on devices.
+                    A_colblock.releaseLocalWorkspace();
+                    B_rowblock.releaseLocalWorkspace();
+                }
             }
         }
         #pragma omp taskwait
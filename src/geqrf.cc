@@ -192,6 +192,8 @@ void geqrf(
             // panel, high priority
             #pragma omp task depend(inout:block[k]) priority(1)
             {
+                trace::Block trace_block( "task::panel", k );
+
                 // local panel factorization
                 internal::geqrf<target>(
                                 std::move(A_panel),
@@ -261,6 +263,8 @@ void geqrf(
                                  depend(inout:block[j]) \
                                  priority(1)
                 {
+                    trace::Block trace_block( "task::lookahead", k );
+
                     // Apply local reflectors
                     int queue_jk1 = j-k+1;
                     internal::unmqr<target>(
@@ -292,6 +296,8 @@ void geqrf(
                                  depend(inout:block[k+1+lookahead]) \
                                  depend(inout:block[A_nt-1])
                 {
+                    trace::Block trace_block( "task::trailing", k );
+
                     // Apply local reflectors.
                     int queue_jk1 = j-k+1;
                     internal::unmqr<target>(
@@ -10,6 +10,8 @@
 #include "internal/internal.hh"
 #include "internal/internal_util.hh"
 
+#include <lapack/flops.hh>
+
 namespace slate {
 
 //------------------------------------------------------------------------------
@@ -27,6 +29,10 @@ namespace slate {
 /// quality (see below). If the approach fails, the method falls back to a
 /// high precision (double) factorization and solve.
 ///
+/// If timers::Timers is on, the time of each phase is recorded as
+/// "gesv_mixed::getrf_lo", "gesv_mixed::getrs_lo", "gesv_mixed::residual",
+/// etc.
+///
 /// The iterative refinement is not going to be a winning strategy if
 /// the ratio of low-precision performance over high-precision performance is
 /// too small. A reasonable strategy should take the number of right-hand
@@ -113,7 +119,8 @@ void gesv_mixed(
     const int itermax = 30;
     using real_hi = blas::real_type<scalar_hi>;
     const real_hi eps = std::numeric_limits<real_hi>::epsilon();
-    const scalar_hi one_hi = 1.0;
+    const scalar_hi zero_hi = 0.0;
+    const scalar_hi one_hi  = 1.0;
     iter = 0;
 
     assert( B.mt() == A.mt() );
@@ -166,27 +173,36 @@ void gesv_mixed(
     // Convert A from high to low precision, store result in A_lo.
     copy( A, A_lo, opts );
 
+    // Estimated flops of phases, for timers.
+    const double getrs_gflop = lapack::Gflop<scalar_hi>::getrs( A.n(), X.n() );
+    const double gemm_gflop = blas::Gflop<scalar_hi>::gemm( A.m(), X.n(), A.n() );
+
     // Compute the LU factorization of A_lo.
+    timers::Phase t_getrf_lo( "gesv_mixed::getrf_lo" );
     getrf( A_lo, pivots, opts );
-
+    t_getrf_lo.stop( lapack::Gflop<scalar_lo>::getrf( A.m(), A.n() ) );
 
     // Solve the system A_lo * X_lo = B_lo.
+    timers::Phase t_getrs_lo( "gesv_mixed::getrs_lo" );
     getrs( A_lo, pivots, X_lo, opts );
+    t_getrs_lo.stop( getrs_gflop );
 
-    // Convert X_lo to high precision.
-    copy( X_lo, X, opts );
+    // Convert X_lo to high precision, X = X_lo, and set R = B.
+    internal::iterRefUpdate( X_lo, zero_hi, X, B, R, opts );
 
     // Compute R = B - A * X.
-    slate::copy( B, R, opts );
+    timers::Phase t_residual( "gesv_mixed::residual" );
     gemm<scalar_hi>(
         -one_hi, A,
                  X,
         one_hi,  R, opts );
+    t_residual.stop( gemm_gflop );
 
     // Check whether the nrhs normwise backward error satisfies the
     // stopping criterion. If yes, set iter=0 and return.
-    colNorms( Norm::Max, X, colnorms_X.data(), opts );
-    colNorms( Norm::Max, R, colnorms_R.data(), opts );
+    // Also converts R to low precision, storing the result in X_lo.
+    internal::iterRefColNorms(
+        X, R, X_lo, colnorms_X.data(), colnorms_R.data(), opts );
 
     if (internal::iterRefConverged<real_hi>( colnorms_R, colnorms_X, cte )) {
         iter = 0;
@@ -195,29 +211,28 @@ void gesv_mixed(
 
     // iterative refinement
     for (int iiter = 0; iiter < itermax && ! converged; ++iiter) {
-        // Convert R from high to low precision, store result in X_lo.
-        copy( R, X_lo, opts );
-
         // Solve the system A_lo * X_lo = R_lo.
+        timers::Phase t_getrs_lo( "gesv_mixed::getrs_lo" );
         getrs( A_lo, pivots, X_lo, opts );
+        t_getrs_lo.stop( getrs_gflop );
 
-        // Convert X_lo back to double precision and update the current iterate.
-        copy( X_lo, R, opts );
-        add<scalar_hi>(
-              one_hi, R,
-              one_hi, X, opts );
+        // Convert X_lo back to double precision and update the current
+        // iterate, X += X_lo, and set R = B.
+        internal::iterRefUpdate( X_lo, one_hi, X, B, R, opts );
 
         // Compute R = B - A * X.
-        slate::copy( B, R, opts );
+        timers::Phase t_residual( "gesv_mixed::residual" );
         gemm<scalar_hi>(
             -one_hi, A,
                      X,
             one_hi,  R, opts );
+        t_residual.stop( gemm_gflop );
 
         // Check whether nrhs normwise backward error satisfies the
         // stopping criterion. If yes, set iter = iiter > 0 and return.
-        colNorms( Norm::Max, X, colnorms_X.data(), opts );
-        colNorms( Norm::Max, R, colnorms_R.data(), opts );
+        // Also converts R to low precision, storing the result in X_lo.
+        internal::iterRefColNorms(
+            X, R, X_lo, colnorms_X.data(), colnorms_R.data(), opts );
 
         if (internal::iterRefConverged<real_hi>( colnorms_R, colnorms_X, cte )) {
             iter = iiter+1;
@@ -233,11 +248,15 @@ void gesv_mixed(
         iter = -itermax - 1;
 
         // Compute the LU factorization of A.
+        timers::Phase t_getrf( "gesv_mixed::getrf" );
         getrf( A, pivots, opts );
+        t_getrf.stop( lapack::Gflop<scalar_hi>::getrf( A.m(), A.n() ) );
 
         // Solve the system A * X = B.
+        timers::Phase t_getrs( "gesv_mixed::getrs" );
         slate::copy( B, X, opts );
         getrs( A, pivots, X, opts );
+        t_getrs.stop( getrs_gflop );
     }
 
     if (target == Target::Devices) {
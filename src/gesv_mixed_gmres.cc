@@ -199,22 +199,24 @@ void gesv_mixed_gmres(
     // Solve the system A * X = B in low precision.
     slate::copy( B, X_lo, opts );
     getrs( A_lo, pivots, X_lo, opts );
-    slate::copy( X_lo, X, opts );
+    // Convert X_lo to high precision, X = X_lo, and set R = B.
+    internal::iterRefUpdate( X_lo, zero, X, B, R, opts );
 
 
     // IR
     int iiter = 0;
     while (iiter < itermax) {
 
-        // Check for convergence
-        slate::copy( B, R, opts );
+        // Check for convergence, R = B - A * X.
         gemm<scalar_hi>(
             -one, A,
                   X,
             one,  R,
             opts);
-        colNorms( Norm::Max, X, colnorms_X.data(), opts );
-        colNorms( Norm::Max, R, colnorms_R.data(), opts );
+        // Also computes the initial vector, v0 = R.
+        auto v0 = V.slice( 0, V.m()-1, 0, 0 );
+        internal::iterRefColNorms(
+            X, R, v0, colnorms_X.data(), colnorms_R.data(), opts );
         if (internal::iterRefConverged<real_hi>( colnorms_R, colnorms_X, cte ))
         {
             iter = iiter;
@@ -224,10 +226,7 @@ void gesv_mixed_gmres(
 
         // GMRES
 
-        // Compute initial vector
-        auto v0 = V.slice( 0, V.m()-1, 0, 0 );
-        slate::copy( R, v0, opts );
-
+        // Normalize initial vector
         std::vector<real_hi> arnoldi_residual = { norm( Norm::Fro, v0, opts ) };
         if (arnoldi_residual[0] == 0) {
             // Solver broke down, but residual is not small enough yet.
@@ -337,6 +336,9 @@ void gesv_mixed_gmres(
                  S_j,
             one, X,
             opts );
+
+        // Reset R = B for the next convergence check.
+        slate::copy( B, R, opts );
     }
 
     if (! converged) {
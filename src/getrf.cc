@@ -64,6 +64,11 @@ void getrf(
 
     bool is_shared = target == Target::Devices && lookahead > 0;
 
+    // With a single rank, all tiles and pivots are local, so skip the
+    // broadcasts. Devices still use the broadcasts to prefetch tiles.
+    bool is_single_rank = A.mpiSize() == 1;
+    bool is_comm = target == Target::Devices || ! is_single_rank;
+
     // OpenMP needs pointer types, but vectors are exception safe
     std::vector< uint8_t > column_vector(A_nt);
     uint8_t* column = column_vector.data();
@@ -93,23 +98,27 @@ void getrf(
             // panel, high priority
             #pragma omp task depend(inout:column[k]) priority(1)
             {
+                trace::Block trace_block( "task::panel", k );
+
                 // factor A(k:mt-1, k)
                 internal::getrf_panel<Target::HostTask>(
                     A.sub(k, A_mt-1, k, k), diag_len, ib, pivots.at(k),
                     pivot_threshold, max_panel_threads, priority_1, k );
 
-                BcastList bcast_list_A;
-                int tag_k = k;
-                for (int64_t i = k; i < A_mt; ++i) {
-                    // send A(i, k) across row A(i, k+1:nt-1)
-                    bcast_list_A.push_back({i, k, {A.sub(i, i, k+1, A_nt-1)}});
+                if (is_comm) {
+                    BcastList bcast_list_A;
+                    int tag_k = k;
+                    for (int64_t i = k; i < A_mt; ++i) {
+                        // send A(i, k) across row A(i, k+1:nt-1)
+                        bcast_list_A.push_back({i, k, {A.sub(i, i, k+1, A_nt-1)}});
+                    }
+                    A.template listBcast<target>(
+                        bcast_list_A, Layout::ColMajor, tag_k, life_1, is_shared );
                 }
-                A.template listBcast<target>(
-                    bcast_list_A, Layout::ColMajor, tag_k, life_1, is_shared );
 
                 // Root broadcasts the pivot to all ranks.
                 // todo: Panel ranks send the pivots to the right.
-                {
+                if (! is_single_rank) {
                     trace::Block trace_block("MPI_Bcast");
 
                     MPI_Bcast(pivots.at(k).data(),
@@ -122,6 +131,8 @@ void getrf(
                 #pragma omp task depend(in:column[k]) \
                                  depend(inout:column[j]) priority(1)
                 {
+                    trace::Block trace_block( "task::lookahead", k );
+
                     // swap rows in A(k:mt-1, j)
                     int tag_j = j;
                     int queue_jk1 = j-k+1;
@@ -141,14 +152,15 @@ void getrf(
 
                     // send A(k, j) across column A(k+1:mt-1, j)
                     // todo: trsm still operates in ColMajor
-                    A.tileBcast(k, j, A.sub(k+1, A_mt-1, j, j), Layout::ColMajor, tag_j);
+                    if (! is_single_rank)
+                        A.tileBcast(k, j, A.sub(k+1, A_mt-1, j, j), Layout::ColMajor, tag_j);
 
                     // A(k+1:mt-1, j) -= A(k+1:mt-1, k) * A(k, j)
                     internal::gemm<target>(
                         -one, A.sub(k+1, A_mt-1, k, k),
                               A.sub(k, k, j, j),
                         one,  A.sub(k+1, A_mt-1, j, j),
-                        target_layout, priority_1, queue_jk1 );
+                        target_layout, priority_1, queue_jk1, opts );
                 }
             }
             // pivot to the left
@@ -177,6 +189,8 @@ void getrf(
                                  depend(inout:column[k+1+lookahead]) \
                                  depend(inout:column[A_nt-1])
                 {
+                    trace::Block trace_block( "task::trailing", k );
+
                     // swap rows in A(k:mt-1, kl+1:nt-1)
                     int tag_kl1 = k+1+lookahead;
                     // todo: target
@@ -197,21 +211,23 @@ void getrf(
                         priority_0, Layout::ColMajor, queue_1 );
 
                     // send A(k, kl+1:A_nt-1) across A(k+1:mt-1, kl+1:nt-1)
-                    BcastList bcast_list_A;
-                    for (int64_t j = k+1+lookahead; j < A_nt; ++j) {
-                        // send A(k, j) across column A(k+1:mt-1, j)
-                        bcast_list_A.push_back({k, j, {A.sub(k+1, A_mt-1, j, j)}});
+                    if (is_comm) {
+                        BcastList bcast_list_A;
+                        for (int64_t j = k+1+lookahead; j < A_nt; ++j) {
+                            // send A(k, j) across column A(k+1:mt-1, j)
+                            bcast_list_A.push_back({k, j, {A.sub(k+1, A_mt-1, j, j)}});
+                        }
+                        // todo: trsm still operates in ColMajor
+                        A.template listBcast<target>(
+                            bcast_list_A, Layout::ColMajor, tag_kl1);
                     }
-                    // todo: trsm still operates in ColMajor
-                    A.template listBcast<target>(
-                        bcast_list_A, Layout::ColMajor, tag_kl1);
 
                     // A(k+1:mt-1, kl+1:nt-1) -= A(k+1:mt-1, k) * A(k, kl+1:nt-1)
                     internal::gemm<target>(
                         -one, A.sub(k+1, A_mt-1, k, k),
                               A.sub(k, k, k+1+lookahead, A_nt-1),
                         one,  A.sub(k+1, A_mt-1, k+1+lookahead, A_nt-1),
-                        target_layout, priority_0, queue_1 );
+                        target_layout, priority_0, queue_1, opts );
                 }
             }
             if (is_shared) {
@@ -294,6 +310,15 @@ void getrf(
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
 ///
+///     - Option::TileAffinity:
+///       With HostTask, on multi-socket nodes, update each tile preferably
+///       from threads on the NUMA node holding it. Default true.
+///
+///     - Option::Gemm3M:
+///       Experimental. For complex types with HostTask, update the trailing
+///       matrix using the 3M algorithm, 3 real gemms instead of 4.
+///       Default false.
+///
 ///    - Option::PivotThreshold:
 ///      Strictness of the pivot selection.  Between 0 and 1 with 1 giving
 ///      partial pivoting and 0 giving no pivoting.  Default 1.
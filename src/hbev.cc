@@ -0,0 +1,256 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/HermitianBandMatrix.hh"
+#include "slate/Tile_blas.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Copies the tiles of the band Hermitian matrix A that hold its band to
+/// Aband on rank 0, and zeros entries of Aband outside A's bandwidth,
+/// which A does not reference. Aband has bandwidth nb = A.tileNb( 0 ),
+/// as hb2st requires. If A is diagonal (kd = 0), A has no off-diagonal
+/// tiles, so those tiles of Aband are only zeroed.
+/// Assumes A.bandwidth() <= nb.
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+void hbevGather(
+    HermitianBandMatrix<scalar_t>& A,
+    HermitianBandMatrix<scalar_t>& Aband)
+{
+    const scalar_t zero = 0.0;
+    const Layout layout = Layout::ColMajor;
+
+    bool upper = A.uplo() == Uplo::Upper;
+    int64_t kd = A.bandwidth();
+    int mpi_rank = A.mpiRank();
+
+    int64_t jj = 0;
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        int64_t istart = upper ? std::max( int64_t( 0 ), j-1 ) : j;
+        int64_t iend   = upper ? j : std::min( j+1, A.mt()-1 );
+        int64_t ii = 0;
+        for (int64_t i = 0; i < istart; ++i)
+            ii += A.tileMb( i );
+
+        for (int64_t i = istart; i <= iend; ++i) {
+            bool in_band = i == j || kd > 0;
+            if (mpi_rank == 0) {
+                auto Bij = Aband( i, j );
+                if (! in_band) {
+                    // A has no tile here; Bij is zeroed below.
+                }
+                else if (A.tileIsLocal( i, j )) {
+                    A.tileGetForReading( i, j, LayoutConvert( layout ) );
+                    auto Aij = A( i, j );
+                    Aij.uplo( Uplo::General );
+                    Bij.uplo( Uplo::General );
+                    tile::gecopy( Aij, Bij );
+                }
+                else {
+                    Bij.recv( A.tileRank( i, j ), A.mpiComm(), layout );
+                }
+
+                // Zero outside the band, i.e., |row - col| > kd.
+                for (int64_t c = 0; c < Bij.nb(); ++c) {
+                    for (int64_t r = 0; r < Bij.mb(); ++r) {
+                        int64_t dist = upper ? (jj + c) - (ii + r)
+                                             : (ii + r) - (jj + c);
+                        if (dist > kd)
+                            Bij.at( r, c ) = zero;
+                    }
+                }
+            }
+            else if (in_band && A.tileIsLocal( i, j )) {
+                A.tileGetForReading( i, j, LayoutConvert( layout ) );
+                A( i, j ).send( 0, A.mpiComm() );
+            }
+            ii += A.tileMb( i );
+        }
+        jj += A.tileNb( j );
+    }
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Hermitian band matrix eigen decomposition.
+/// hbev computes all eigenvalues and, optionally, eigenvectors of a
+/// Hermitian band matrix A.
+/// Unlike heev, there is no reduction of a dense matrix to band form
+/// (he2hb) and its back-transform, which take most of heev's $O(n^3)$ flops:
+/// A is reduced from band to tridiagonal form (hb2st), the tridiagonal
+/// eigenproblem is solved, and the eigenvectors are back-transformed
+/// by the hb2st reflectors only.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///         One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///         On entry, the n-by-n Hermitian band matrix $A$, with bandwidth
+///         kd <= nb, the tile size. Currently only lower is supported.
+///         Not modified; its band is copied to workspace.
+///
+/// @param[out] Lambda
+///     The vector Lambda of length n.
+///     If successful, the eigenvalues in ascending order.
+///
+/// @param[out] Z
+///     On entry, if Z is empty, does not compute eigenvectors.
+///     Otherwise, the n-by-n matrix $Z$ to store eigenvectors,
+///     with the same tile size as A.
+///     On exit, orthonormal eigenvectors of the matrix A.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::MethodEig:
+///       Tridiagonal eigensolver, if computing eigenvectors.
+///       - MethodEig::QR: QR iteration (steqr2).
+///       - MethodEig::DC: divide and conquer (stedc) [default].
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup heev
+///
+template <typename scalar_t>
+void hbev(
+    HermitianBandMatrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const auto mpi_real_type = mpi_type< blas::real_type<scalar_t> >::value;
+
+    int64_t n = A.n();
+    int64_t nb = A.tileNb(0);
+    bool wantz = (Z.mt() > 0);
+
+    slate_error_if( A.bandwidth() > nb );
+    if (A.uplo() == Uplo::Upper)
+        slate_not_implemented( "Uplo::Upper isn't supported." );
+
+    MethodEig method = get_option( opts, Option::MethodEig, MethodEig::DC );
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    // Copy band.
+    // Currently, gathers band matrix to rank 0, as in heev.
+    HermitianBandMatrix<scalar_t> Aband(A.uplo(), n, nb, nb, 1, 1, A.mpiComm());
+    Aband.insertLocalTiles();
+    impl::hbevGather( A, Aband );
+
+    // Currently, hb2st and sterf are run on a single node.
+    Lambda.resize(n);
+    std::vector<real_t> E(n - 1);
+    // Matrix to store Householder vectors.
+    // Could pack into a lower triangular matrix, but we store each
+    // parallelogram in a 2nb-by-nb tile, with nt(nt + 1)/2 tiles.
+    int64_t vm = 2*nb;
+    int64_t nt = A.nt();
+    int64_t vn = nt*(nt + 1)/2*nb;
+    Matrix<scalar_t> V(vm, vn, vm, nb, 1, 1, A.mpiComm());
+    if (A.mpiRank() == 0) {
+        V.insertLocalTiles();
+
+        // 1. Reduce band to real symmetric tri-diagonal.
+        hb2st(Aband, V, opts);
+
+        // Copy diagonal and super-diagonal to vectors.
+        internal::copyhb2st( Aband, Lambda, E );
+    }
+
+    // 2. Tri-diagonal eigenvalue solver.
+    if (wantz) {
+        // Bcast the Lambda and E vectors (diagonal and sup/super-diagonal).
+        MPI_Bcast( &Lambda[0], n,   mpi_real_type, 0, A.mpiComm() );
+        MPI_Bcast( &E[0],      n-1, mpi_real_type, 0, A.mpiComm() );
+        if (method == MethodEig::QR) {
+            // QR iteration to get eigenvalues and eigenvectors of tridiagonal.
+            steqr2( Job::Vec, Lambda, E, Z );
+        }
+        else {
+            // Divide and conquer to get eigvals and eigvecs of tridiagonal.
+            if constexpr (! is_complex<scalar_t>::value) {
+                // real
+                stedc( Lambda, E, Z );
+            }
+            else {
+                // D&C computes real Z, then copy to complex Z to back-transform.
+                auto Zreal = Z.template emptyLike<real_t>();
+                Zreal.insertLocalTiles();
+                stedc( Lambda, E, Zreal );
+                copy( Zreal, Z );
+            }
+        }
+
+        // Find the total number of processors.
+        int mpi_size;
+        slate_mpi_call(
+            MPI_Comm_size(A.mpiComm(), &mpi_size));
+
+        Matrix<scalar_t> Z1d(Z.m(), Z.n(), Z.tileNb(0), 1, mpi_size, Z.mpiComm());
+        Z1d.insertLocalTiles(target);
+        redistribute(Z, Z1d, opts);
+
+        // 3. Back-transform: Z = Q2 * Z.
+        unmtr_hb2st( Side::Left, Op::NoTrans, V, Z1d, opts );
+
+        redistribute(Z1d, Z, opts);
+    }
+    else {
+        if (A.mpiRank() == 0) {
+            // QR iteration to get eigenvalues.
+            sterf<real_t>( Lambda, E, opts );
+        }
+        // Bcast eigenvalues.
+        MPI_Bcast( &Lambda[0], n, mpi_real_type, 0, A.mpiComm() );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void hbev<float>(
+    HermitianBandMatrix<float>& A,
+    std::vector<float>& Lambda,
+    Matrix<float>& Z,
+    Options const& opts);
+
+template
+void hbev<double>(
+    HermitianBandMatrix<double>& A,
+    std::vector<double>& Lambda,
+    Matrix<double>& Z,
+    Options const& opts);
+
+template
+void hbev< std::complex<float> >(
+    HermitianBandMatrix< std::complex<float> >& A,
+    std::vector<float>& Lambda,
+    Matrix< std::complex<float> >& Z,
+    Options const& opts);
+
+template
+void hbev< std::complex<double> >(
+    HermitianBandMatrix< std::complex<double> >& A,
+    std::vector<double>& Lambda,
+    Matrix< std::complex<double> >& Z,
+    Options const& opts);
+
+} // namespace slate
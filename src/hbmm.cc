@@ -420,6 +420,57 @@ void hbmm(
     C.releaseWorkspace();
 }
 
+//------------------------------------------------------------------------------
+/// @internal
+/// hbmm for a narrow band on one rank, using LAPACK-style compact band
+/// storage of A, expanded to both triangles.
+///
+template <typename scalar_t>
+void hbmm_compact(
+    Side side,
+    scalar_t alpha, HermitianBandMatrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C )
+{
+    using blas::conj;
+    using blas::real;
+
+    int64_t n  = A.n();
+    int64_t kd = A.bandwidth();
+    int64_t ldab = 2*kd + 1;
+    int64_t Cm = C.m();
+    int64_t Cn = C.n();
+    int64_t ldc = std::max( Cm, int64_t( 1 ) );
+
+    // Copy the stored triangle, then fill in the other one,
+    // so A(r, c) is in AB[ kd + r - c + c*ldab ].
+    std::vector<scalar_t> AB( ldab*n ), Bdata( ldc*Cn ), Cdata( ldc*Cn );
+    bool lower = A.uplo() == Uplo::Lower;
+    if (lower)
+        internal::copyband2lapack( A, kd, 0, &AB[ kd ], ldab );
+    else
+        internal::copyband2lapack( A, 0, kd, AB.data(), ldab );
+    for (int64_t c = 0; c < n; ++c) {
+        AB[ kd + c*ldab ] = real( AB[ kd + c*ldab ] );
+        for (int64_t r = std::max( int64_t( 0 ), c - kd ); r < c; ++r) {
+            // (r, c) is above the diagonal, (c, r) below.
+            if (lower)
+                AB[ kd + r - c + c*ldab ] = conj( AB[ kd + c - r + r*ldab ] );
+            else
+                AB[ kd + c - r + r*ldab ] = conj( AB[ kd + r - c + c*ldab ] );
+        }
+    }
+
+    internal::copyge2lapack( B, Bdata.data(), ldc );
+    if (beta != scalar_t( 0.0 ))
+        internal::copyge2lapack( C, Cdata.data(), ldc );
+    internal::gbmm_lapack( side, n, n, kd, kd,
+                           side == Side::Left ? Cn : Cm,
+                           alpha, AB.data(), ldab, Bdata.data(), ldc,
+                           beta, Cdata.data(), ldc );
+    internal::copylapack2ge( Cdata.data(), ldc, C );
+}
+
 } // namespace impl
 
 //------------------------------------------------------------------------------
@@ -473,6 +524,12 @@ void hbmm(
 ///           - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///           - HostBatch: batched BLAS on CPU host.
 ///           - Devices:   batched BLAS on GPU device.
+///         - Option::CompactBand:
+///           Single-rank shortcut: if A, B, and C are on one rank and not
+///           transposed, and the band of A is at most a quarter of the tile
+///           size, multiply using a temporary copy of A in LAPACK-style
+///           compact band storage, which raises peak memory by the copy.
+///           Default false.
 ///
 /// @ingroup hbmm
 ///
@@ -485,6 +542,13 @@ void hbmm(Side side,
 {
     Target target = get_option( opts, Option::Target, Target::HostTask );
 
+    if (internal::use_compact_band( A, A.bandwidth(), A.bandwidth(), opts )
+        && B.mpiSize() == 1 && B.op() == Op::NoTrans
+        && C.mpiSize() == 1 && C.op() == Op::NoTrans) {
+        impl::hbmm_compact( side, alpha, A, B, beta, C );
+        return;
+    }
+
     switch (target) {
         case Target::Host:
         case Target::HostTask:
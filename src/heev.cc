@@ -9,6 +9,9 @@
 #include "slate/Tile_blas.hh"
 #include "slate/HermitianBandMatrix.hh"
 #include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+#include <lapack/flops.hh>
 
 namespace slate {
 
@@ -20,6 +23,9 @@ namespace slate {
 /// First stage: reduction to band tridiagonal form (see he2hb);
 /// Second stage: reduction from band to tridiagonal form (see hb2st).
 ///
+/// If timers::Timers is on, the time of each phase is recorded as
+/// "heev::he2hb", "heev::hb2st", etc.
+///
 //------------------------------------------------------------------------------
 /// @tparam scalar_t
 ///         One of float, double, std::complex<float>, std::complex<double>.
@@ -94,21 +100,31 @@ void heev(
         alpha = sqrt_big;
     }
 
+    // Estimated flops and bytes of phases, for timers.
+    const double n3_gflop = lapack::Gflop<scalar_t>::unmqr(
+        lapack::Side::Left, n, n, n );
+    const double n2_gbyte = 1e-9 * n * n * sizeof(scalar_t);
+
     if (alpha != 1.0) {
         // Scale by sqrt_sml/Anorm or sqrt_big/Anorm.
+        timers::Phase t_scale( "heev::scale" );
         scale( alpha, Anorm, A, opts );
     }
 
     // 1. Reduce to band form.
+    timers::Phase t_he2hb( "heev::he2hb" );
     TriangularFactors<scalar_t> T;
     he2hb(A, T, opts);
+    t_he2hb.stop( lapack::Gflop<scalar_t>::hetrd( n ) );
 
     // Copy band.
     // Currently, gathers band matrix to rank 0.
+    timers::Phase t_gather( "heev::he2hbGather" );
     int64_t nb = A.tileNb(0);
     HermitianBandMatrix<scalar_t> Aband(A.uplo(), n, nb, nb, 1, 1, A.mpiComm());
     Aband.insertLocalTiles();
     Aband.he2hbGather(A);
+    t_gather.stop( 0, 1e-9 * n * (nb + 1) * sizeof(scalar_t) );
 
     // Currently, hb2st and sterf are run on a single node.
     Lambda.resize(n);
@@ -125,7 +141,9 @@ void heev(
         V.insertLocalTiles();
 
         // 2. Reduce band to real symmetric tri-diagonal.
+        timers::Phase t_hb2st( "heev::hb2st" );
         hb2st(Aband, V, opts);
+        t_hb2st.stop();
 
         // Copy diagonal and super-diagonal to vectors.
         internal::copyhb2st( Aband, Lambda, E );
@@ -136,43 +154,75 @@ void heev(
         // Bcast the Lambda and E vectors (diagonal and sup/super-diagonal).
         MPI_Bcast( &Lambda[0], n,   mpi_real_type, 0, A.mpiComm() );
         MPI_Bcast( &E[0],      n-1, mpi_real_type, 0, A.mpiComm() );
-        if (method == MethodEig::QR) {
-            // QR iteration to get eigenvalues and eigenvectors of tridiagonal.
-            steqr2( Job::Vec, Lambda, E, Z );
+        // Find the total number of processors.
+        int mpi_size, mpi_rank;
+        slate_mpi_call(
+            MPI_Comm_size(A.mpiComm(), &mpi_size));
+        slate_mpi_call(
+            MPI_Comm_rank(A.mpiComm(), &mpi_rank));
+
+        // Z1d is Z in 1-D block columns, for the hb2st back-transform.
+        Matrix<scalar_t> Z1d;
+        std::vector<scalar_t> Z1d_data;
+
+        timers::Phase t_tridiag( method == MethodEig::QR
+                                 ? "heev::steqr2" : "heev::stedc" );
+        if (is_complex<scalar_t>::value && method != MethodEig::QR) {
+            // Divide and conquer computes real eigvecs of tridiagonal.
+            // Instead of a separate real Z, copied to complex Z and then
+            // redistributed, compute them in 1-D block columns in the
+            // storage of Z1d, viewed as real, and widen them in place.
+            int64_t Z_nb = Z.tileNb(0);
+            int64_t lld = std::max( int64_t( 1 ), Z.m() );
+            int64_t nlocal = num_local_rows_cols(
+                Z.n(), Z_nb, mpi_rank, 0, mpi_size );
+            Z1d_data.resize( lld * nlocal );
+            Z1d = Matrix<scalar_t>::fromScaLAPACK(
+                Z.m(), Z.n(), Z1d_data.data(), lld, Z_nb,
+                1, mpi_size, Z.mpiComm() );
+            auto Zreal = Matrix<real_t>::fromScaLAPACK(
+                Z.m(), Z.n(), reinterpret_cast<real_t*>( Z1d_data.data() ),
+                lld, Z_nb, 1, mpi_size, Z.mpiComm() );
+            stedc( Lambda, E, Zreal );
+            internal::real2complex_inplace( lld * nlocal, Z1d_data.data() );
+            t_tridiag.stop();
         }
         else {
-            // Divide and conquer to get eigvals and eigvecs of tridiagonal.
-            if constexpr (! is_complex<scalar_t>::value) {
-                // real
-                stedc( Lambda, E, Z );
+            if (method == MethodEig::QR) {
+                // QR iteration to get eigenvalues and eigenvectors of tridiagonal.
+                steqr2( Job::Vec, Lambda, E, Z );
             }
-            else {
-                // D&C computes real Z, then copy to complex Z to back-transform.
-                auto Zreal = Z.template emptyLike<real_t>();
-                Zreal.insertLocalTiles();
-                stedc( Lambda, E, Zreal );
-                copy( Zreal, Z );
+            else if constexpr (! is_complex<scalar_t>::value) {
+                // Divide and conquer to get eigvals and eigvecs of tridiagonal.
+                stedc( Lambda, E, Z );
             }
-        }
+            t_tridiag.stop();
 
-        // Find the total number of processors.
-        int mpi_size;
-        slate_mpi_call(
-            MPI_Comm_size(A.mpiComm(), &mpi_size));
-
-        Matrix<scalar_t> Z1d(Z.m(), Z.n(), Z.tileNb(0), 1, mpi_size, Z.mpiComm());
-        Z1d.insertLocalTiles(target);
-        redistribute(Z, Z1d, opts);
+            Z1d = Matrix<scalar_t>(
+                Z.m(), Z.n(), Z.tileNb(0), 1, mpi_size, Z.mpiComm() );
+            Z1d.insertLocalTiles(target);
+            timers::Phase t_redist1( "heev::redistribute" );
+            redistribute(Z, Z1d, opts);
+            t_redist1.stop( 0, n2_gbyte );
+        }
 
         // Back-transform: Z = Q1 * Q2 * Z.
+        timers::Phase t_unmtr_hb2st( "heev::unmtr_hb2st" );
         unmtr_hb2st( Side::Left, Op::NoTrans, V, Z1d, opts );
+        t_unmtr_hb2st.stop( n3_gflop );
 
+        timers::Phase t_redist2( "heev::redistribute" );
         redistribute(Z1d, Z, opts);
+        t_redist2.stop( 0, n2_gbyte );
+
+        timers::Phase t_unmtr_he2hb( "heev::unmtr_he2hb" );
         unmtr_he2hb( Side::Left, Op::NoTrans, A, T, Z, opts );
+        t_unmtr_he2hb.stop( n3_gflop );
     }
     else {
         if (A.mpiRank() == 0) {
             // QR iteration to get eigenvalues.
+            timers::Phase t_sterf( "heev::sterf" );
             sterf<real_t>( Lambda, E, opts );
         }
         // Bcast eigenvalues.
@@ -43,6 +43,8 @@ void hemmA(
 
     // Options
     int64_t lookahead = get_option<int64_t>( opts, Option::Lookahead, 1 );
+    Method method_reduce = get_option<Method>(
+            opts, Option::MethodReduce, MethodReduce::Auto );
 
     // if on right, change to left by transposing A, B, C to get
     // op(C) = op(A)*op(B)
@@ -307,7 +309,8 @@ void hemmA(
                                   A.sub(i, A.mt()-1, i, i) }
                                 });
                         }
-                        C.template listReduce<target>(reduce_list_C, layout);
+                        C.template listReduce<target>(
+                            reduce_list_C, layout, 0, method_reduce);
                         reduce_list_C.clear();
                         // Release the memory
                         if (C.tileExists(i, j) && ! C.tileIsLocal(i, j))
@@ -540,7 +543,8 @@ void hemmA(
                                   }
                                 });
                         }
-                        C.template listReduce<target>(reduce_list_C, layout);
+                        C.template listReduce<target>(
+                            reduce_list_C, layout, 0, method_reduce);
                         reduce_list_C.clear();
                         // Release the memory
                         if (C.tileExists(i, j) && ! C.tileIsLocal(i, j))
@@ -603,6 +607,10 @@ void hemmA(
 ///         - Option::Lookahead:
 ///           Number of blocks to overlap communication and computation.
 ///           lookahead >= 0. Default 1.
+///         - Option::MethodReduce:
+///           Algorithm to sum partial C tiles across process rows.
+///           Possible values: Auto [default], Binomial, ReduceScatter,
+///           Pipelined. See MethodReduce.
 ///         - Option::Target:
 ///           Implementation to target. Possible values:
 ///           - HostTask:  OpenMP tasks on CPU host [default].
@@ -165,6 +165,52 @@ void copyhb2st(HermitianBandMatrix<scalar_t>& A,
                std::vector< blas::real_type<scalar_t> >& D,
                std::vector< blas::real_type<scalar_t> >& E);
 
+//-----------------------------------------
+// Compact (LAPACK-style) band storage, used by band routines for narrow
+// bands; see use_compact_band().
+template <typename scalar_t>
+void copyband2lapack(BaseBandMatrix<scalar_t>& A, int64_t kl, int64_t ku,
+                     scalar_t* AB, int64_t ldab);
+
+template <typename scalar_t>
+void copylapack2band(scalar_t const* AB, int64_t ldab, int64_t kl, int64_t ku,
+                     BaseBandMatrix<scalar_t>& A);
+
+template <typename scalar_t>
+void copyge2lapack(Matrix<scalar_t>& B, scalar_t* Bdata, int64_t ldb);
+
+template <typename scalar_t>
+void copylapack2ge(scalar_t const* Bdata, int64_t ldb, Matrix<scalar_t>& B);
+
+template <typename scalar_t>
+void gbmm_lapack(Side side, int64_t m, int64_t n, int64_t kl, int64_t ku,
+                 int64_t nrhs,
+                 scalar_t alpha, scalar_t const* AB, int64_t ldab,
+                                 scalar_t const* B,  int64_t ldb,
+                 scalar_t beta,  scalar_t*       C,  int64_t ldc);
+
+//------------------------------------------------------------------------------
+/// Returns whether band routines should take the single-rank shortcut of
+/// copying A, with kl subdiagonals and ku superdiagonals, to LAPACK-style
+/// compact band storage and calling LAPACK band kernels. Full tiles of a
+/// narrow band are mostly zeros, so this saves most of the flops, but the
+/// compact copy is in addition to A's tiles, so peak memory increases.
+/// This requires Option::CompactBand = true (default false), A on one rank,
+/// not transposed, and not on devices, and the band kl + ku + 1 at most
+/// a quarter of the tile size.
+///
+template <typename scalar_t>
+bool use_compact_band(BaseMatrix<scalar_t>& A, int64_t kl, int64_t ku,
+                      Options const& opts)
+{
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+    return get_option<int64_t>( opts, Option::CompactBand, 0 ) != 0
+           && target != Target::Devices
+           && A.mpiSize() == 1
+           && A.op() == Op::NoTrans
+           && 4*(kl + ku + 1) <= A.tileNb( 0 );
+}
+
 //------------------------------------------------------------------------------
 // Level 3 BLAS and LAPACK auxiliary
 
@@ -615,6 +661,15 @@ void unmlq(Side side, Op op,
            Matrix<scalar_t>&& C,
            Matrix<scalar_t>&& W);
 
+//-----------------------------------------
+// larfb()
+template <Target target=Target::HostTask, typename scalar_t>
+void larfb(Side side, Op op,
+           Matrix<scalar_t>&& V,
+           Matrix<scalar_t>&& T,
+           Matrix<scalar_t>&& C,
+           int priority=0);
+
 //-----------------------------------------
 // unmtr_hb2st()
 template <Target target=Target::HostTask, typename scalar_t>
@@ -667,6 +722,25 @@ void norm1est(
     std::vector<int64_t>& isave,
     Options const& opts = Options());
 
+//------------------------------------------------------------------------------
+// Fused iterative refinement steps
+template <typename src_scalar_t, typename scalar_t>
+void iterRefUpdate(
+    Matrix<src_scalar_t>& D, scalar_t beta,
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& R,
+    Options const& opts);
+
+template <typename scalar_t, typename dst_scalar_t>
+void iterRefColNorms(
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& R,
+    Matrix<dst_scalar_t>& Y,
+    blas::real_type<scalar_t>* colnorms_X,
+    blas::real_type<scalar_t>* colnorms_R,
+    Options const& opts);
+
 } // namespace internal
 } // namespace slate
 
@@ -16,6 +16,7 @@
 
 #ifdef BLAS_HAVE_MKL
     #include <mkl_cblas.h>
+    #include <mkl_service.h>
 #endif
 
 #include <complex>
@@ -144,6 +145,86 @@ inline void cblas_gemm_batch(
                       beta_array,  (void**)       C_array, ldc_array,
                       group_count, group_size);
 }
+
+//------------------------------------------------------------------------------
+// Packed gemm, which MKL provides only for real single and double.
+// gemm_pack_get_size returns size in bytes.
+template <typename scalar_t>
+size_t cblas_gemm_pack_get_size(
+    const CBLAS_IDENTIFIER identifier, const int m, const int n, const int k);
+
+template <>
+inline size_t cblas_gemm_pack_get_size<float>(
+    const CBLAS_IDENTIFIER identifier, const int m, const int n, const int k)
+{
+    return cblas_sgemm_pack_get_size(identifier, m, n, k);
+}
+
+template <>
+inline size_t cblas_gemm_pack_get_size<double>(
+    const CBLAS_IDENTIFIER identifier, const int m, const int n, const int k)
+{
+    return cblas_dgemm_pack_get_size(identifier, m, n, k);
+}
+
+//------------------------------------------------------------------------------
+inline void cblas_gemm_pack(
+    const CBLAS_LAYOUT layout,
+    const CBLAS_IDENTIFIER identifier,
+    const CBLAS_TRANSPOSE trans,
+    const int m, const int n, const int k,
+    const float alpha,
+    const float* src, const int ld,
+    float* dest)
+{
+    cblas_sgemm_pack(layout, identifier, trans, m, n, k,
+                     alpha, src, ld, dest);
+}
+
+//------------------------------------------------------------------------------
+inline void cblas_gemm_pack(
+    const CBLAS_LAYOUT layout,
+    const CBLAS_IDENTIFIER identifier,
+    const CBLAS_TRANSPOSE trans,
+    const int m, const int n, const int k,
+    const double alpha,
+    const double* src, const int ld,
+    double* dest)
+{
+    cblas_dgemm_pack(layout, identifier, trans, m, n, k,
+                     alpha, src, ld, dest);
+}
+
+//------------------------------------------------------------------------------
+/// transA and transB are CblasPacked or a CBLAS_TRANSPOSE value.
+inline void cblas_gemm_compute(
+    const CBLAS_LAYOUT layout,
+    const MKL_INT transA,
+    const MKL_INT transB,
+    const int m, const int n, const int k,
+    const float* A, const int lda,
+    const float* B, const int ldb,
+    const float beta,
+    float* C, const int ldc)
+{
+    cblas_sgemm_compute(layout, transA, transB, m, n, k,
+                        A, lda, B, ldb, beta, C, ldc);
+}
+
+//------------------------------------------------------------------------------
+inline void cblas_gemm_compute(
+    const CBLAS_LAYOUT layout,
+    const MKL_INT transA,
+    const MKL_INT transB,
+    const int m, const int n, const int k,
+    const double* A, const int lda,
+    const double* B, const int ldb,
+    const double beta,
+    double* C, const int ldc)
+{
+    cblas_dgemm_compute(layout, transA, transB, m, n, k,
+                        A, lda, B, ldb, beta, C, ldc);
+}
 #endif // BLAS_HAVE_MKL
 
 } // namespace slate
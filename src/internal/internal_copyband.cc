@@ -0,0 +1,327 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/Matrix.hh"
+#include "slate/BaseBandMatrix.hh"
+#include "slate/types.hh"
+#include "slate/Tile_blas.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Calls body( i, j, ii, jj ) for each tile (i, j) of A that intersects the
+/// band -kl <= row - col <= ku, where (ii, jj) is the global index of the
+/// tile's first element.
+///
+template <typename scalar_t, typename body_t>
+void for_each_band_tile(
+    BaseBandMatrix<scalar_t>& A, int64_t kl, int64_t ku, body_t&& body)
+{
+    // First block row in the band of block col j; non-decreasing in j.
+    int64_t i_begin = 0, ii_begin = 0;
+    int64_t jj = 0;
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        int64_t nb = A.tileNb( j );
+        while (i_begin < A.mt() && ii_begin + A.tileMb( i_begin ) <= jj - ku) {
+            ii_begin += A.tileMb( i_begin );
+            ++i_begin;
+        }
+        int64_t ii = ii_begin;
+        for (int64_t i = i_begin; i < A.mt() && ii <= jj + nb - 1 + kl; ++i) {
+            body( i, j, ii, jj );
+            ii += A.tileMb( i );
+        }
+        jj += nb;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies the band -kl <= row - col <= ku of A to LAPACK-style compact band
+/// storage AB, where A(r, c) is stored in AB[ ku + r - c + c*ldab ].
+/// Elements of AB outside the band are not referenced.
+/// A must not be transposed, and all its tiles in the band must be local.
+///
+/// @param[in] A
+///     The m-by-n band matrix A.
+///
+/// @param[in] kl
+///     Number of subdiagonals to copy.
+///
+/// @param[in] ku
+///     Number of superdiagonals to copy.
+///
+/// @param[out] AB
+///     Array of dimension ldab-by-n.
+///
+/// @param[in] ldab
+///     Leading dimension of AB, ldab >= kl + ku + 1.
+///
+template <typename scalar_t>
+void copyband2lapack(
+    BaseBandMatrix<scalar_t>& A, int64_t kl, int64_t ku,
+    scalar_t* AB, int64_t ldab)
+{
+    trace::Block trace_block("slate::copyband2lapack");
+    slate_assert( A.op() == Op::NoTrans );
+    slate_assert( ldab >= kl + ku + 1 );
+
+    int64_t m = A.m();
+    for_each_band_tile( A, kl, ku,
+        [&]( int64_t i, int64_t j, int64_t ii, int64_t jj ) {
+            if (! A.tileExists( i, j ))
+                return;
+            A.tileGetForReading( i, j, LayoutConvert::ColMajor );
+            auto T = A( i, j );
+            scalar_t const* Tdata = T.data();
+            int64_t ldt = T.stride();
+            for (int64_t c = jj; c < jj + T.nb(); ++c) {
+                int64_t r0 = std::max( ii, c - ku );
+                int64_t r1 = std::min( { ii + T.mb(), c + kl + 1, m } );
+                for (int64_t r = r0; r < r1; ++r)
+                    AB[ ku + r - c + c*ldab ] = Tdata[ (r - ii) + (c - jj)*ldt ];
+            }
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Copies LAPACK-style compact band storage AB back to the band
+/// -kl <= row - col <= ku of A; inverse of copyband2lapack.
+/// Elements of A outside the band are not modified.
+///
+template <typename scalar_t>
+void copylapack2band(
+    scalar_t const* AB, int64_t ldab, int64_t kl, int64_t ku,
+    BaseBandMatrix<scalar_t>& A)
+{
+    trace::Block trace_block("slate::copylapack2band");
+    slate_assert( A.op() == Op::NoTrans );
+    slate_assert( ldab >= kl + ku + 1 );
+
+    int64_t m = A.m();
+    for_each_band_tile( A, kl, ku,
+        [&]( int64_t i, int64_t j, int64_t ii, int64_t jj ) {
+            if (! A.tileExists( i, j ))
+                return;
+            A.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+            auto T = A( i, j );
+            scalar_t* Tdata = T.data();
+            int64_t ldt = T.stride();
+            for (int64_t c = jj; c < jj + T.nb(); ++c) {
+                int64_t r0 = std::max( ii, c - ku );
+                int64_t r1 = std::min( { ii + T.mb(), c + kl + 1, m } );
+                for (int64_t r = r0; r < r1; ++r)
+                    Tdata[ (r - ii) + (c - jj)*ldt ] = AB[ ku + r - c + c*ldab ];
+            }
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Copies the general matrix B, with all tiles local, to the column-major
+/// array Bdata.
+///
+template <typename scalar_t>
+void copyge2lapack(
+    Matrix<scalar_t>& B, scalar_t* Bdata, int64_t ldb)
+{
+    slate_assert( B.op() == Op::NoTrans );
+    int64_t jj = 0;
+    for (int64_t j = 0; j < B.nt(); ++j) {
+        int64_t ii = 0;
+        for (int64_t i = 0; i < B.mt(); ++i) {
+            B.tileGetForReading( i, j, LayoutConvert::ColMajor );
+            auto T = B( i, j );
+            lapack::lacpy( lapack::MatrixType::General, T.mb(), T.nb(),
+                           T.data(), T.stride(), &Bdata[ ii + jj*ldb ], ldb );
+            ii += T.mb();
+        }
+        jj += B.tileNb( j );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies the column-major array Bdata to the general matrix B, with all
+/// tiles local; inverse of copyge2lapack.
+///
+template <typename scalar_t>
+void copylapack2ge(
+    scalar_t const* Bdata, int64_t ldb, Matrix<scalar_t>& B)
+{
+    slate_assert( B.op() == Op::NoTrans );
+    int64_t jj = 0;
+    for (int64_t j = 0; j < B.nt(); ++j) {
+        int64_t ii = 0;
+        for (int64_t i = 0; i < B.mt(); ++i) {
+            B.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+            auto T = B( i, j );
+            lapack::lacpy( lapack::MatrixType::General, T.mb(), T.nb(),
+                           &Bdata[ ii + jj*ldb ], ldb, T.data(), T.stride() );
+            ii += T.mb();
+        }
+        jj += B.tileNb( j );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Band matrix multiply with A in LAPACK-style compact band storage:
+///     C = alpha A B + beta C, if side = Left, or
+///     C = alpha B A + beta C, if side = Right,
+/// where A is m-by-n with kl subdiagonals and ku superdiagonals,
+/// and B and C have nrhs columns (Left) or rows (Right).
+/// Touches only the band of A, so the cost is O( (kl + ku + 1) n nrhs ).
+///
+template <typename scalar_t>
+void gbmm_lapack(
+    Side side, int64_t m, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    scalar_t alpha, scalar_t const* AB, int64_t ldab,
+                    scalar_t const* B,  int64_t ldb,
+    scalar_t beta,  scalar_t*       C,  int64_t ldc)
+{
+    trace::Block trace_block("slate::gbmm_lapack");
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const Layout layout = Layout::ColMajor;
+
+    // C = beta C
+    int64_t Cm = side == Side::Left ? m    : nrhs;
+    int64_t Cn = side == Side::Left ? nrhs : n;
+    if (beta == zero) {
+        lapack::laset( lapack::MatrixType::General, Cm, Cn,
+                       zero, zero, C, ldc );
+    }
+    else if (beta != one) {
+        for (int64_t j = 0; j < Cn; ++j)
+            blas::scal( Cm, beta, &C[ j*ldc ], 1 );
+    }
+
+    for (int64_t c = 0; c < n; ++c) {
+        int64_t r0 = std::max( int64_t( 0 ), c - ku );
+        int64_t r1 = std::min( m, c + kl + 1 );
+        if (r1 <= r0)
+            continue;
+        scalar_t const* Ac = &AB[ ku + r0 - c + c*ldab ];
+        if (side == Side::Left) {
+            // C(r0:r1, :) += alpha A(r0:r1, c) B(c, :)
+            blas::geru( layout, r1 - r0, nrhs,
+                        alpha, Ac, 1, &B[ c ], ldb, &C[ r0 ], ldc );
+        }
+        else {
+            // C(:, c) += alpha B(:, r0:r1) A(r0:r1, c)
+            blas::gemv( layout, Op::NoTrans, nrhs, r1 - r0,
+                        alpha, &B[ r0*ldb ], ldb, Ac, 1,
+                        one, &C[ c*ldc ], 1 );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+// ----------------------------------------
+template
+void copyband2lapack<float>(
+    BaseBandMatrix<float>& A, int64_t kl, int64_t ku,
+    float* AB, int64_t ldab);
+
+template
+void copylapack2band<float>(
+    float const* AB, int64_t ldab, int64_t kl, int64_t ku,
+    BaseBandMatrix<float>& A);
+
+template
+void copyge2lapack<float>(
+    Matrix<float>& B, float* Bdata, int64_t ldb);
+
+template
+void copylapack2ge<float>(
+    float const* Bdata, int64_t ldb, Matrix<float>& B);
+
+template
+void gbmm_lapack<float>(
+    Side side, int64_t m, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float alpha, float const* AB, int64_t ldab,
+    float const* B, int64_t ldb,
+    float beta, float* C, int64_t ldc);
+
+// ----------------------------------------
+template
+void copyband2lapack<double>(
+    BaseBandMatrix<double>& A, int64_t kl, int64_t ku,
+    double* AB, int64_t ldab);
+
+template
+void copylapack2band<double>(
+    double const* AB, int64_t ldab, int64_t kl, int64_t ku,
+    BaseBandMatrix<double>& A);
+
+template
+void copyge2lapack<double>(
+    Matrix<double>& B, double* Bdata, int64_t ldb);
+
+template
+void copylapack2ge<double>(
+    double const* Bdata, int64_t ldb, Matrix<double>& B);
+
+template
+void gbmm_lapack<double>(
+    Side side, int64_t m, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double alpha, double const* AB, int64_t ldab,
+    double const* B, int64_t ldb,
+    double beta, double* C, int64_t ldc);
+
+// ----------------------------------------
+template
+void copyband2lapack< std::complex<float> >(
+    BaseBandMatrix< std::complex<float> >& A, int64_t kl, int64_t ku,
+    std::complex<float>* AB, int64_t ldab);
+
+template
+void copylapack2band< std::complex<float> >(
+    std::complex<float> const* AB, int64_t ldab, int64_t kl, int64_t ku,
+    BaseBandMatrix< std::complex<float> >& A);
+
+template
+void copyge2lapack< std::complex<float> >(
+    Matrix< std::complex<float> >& B, std::complex<float>* Bdata, int64_t ldb);
+
+template
+void copylapack2ge< std::complex<float> >(
+    std::complex<float> const* Bdata, int64_t ldb, Matrix< std::complex<float> >& B);
+
+template
+void gbmm_lapack< std::complex<float> >(
+    Side side, int64_t m, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float> alpha, std::complex<float> const* AB, int64_t ldab,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float> beta, std::complex<float>* C, int64_t ldc);
+
+// ----------------------------------------
+template
+void copyband2lapack< std::complex<double> >(
+    BaseBandMatrix< std::complex<double> >& A, int64_t kl, int64_t ku,
+    std::complex<double>* AB, int64_t ldab);
+
+template
+void copylapack2band< std::complex<double> >(
+    std::complex<double> const* AB, int64_t ldab, int64_t kl, int64_t ku,
+    BaseBandMatrix< std::complex<double> >& A);
+
+template
+void copyge2lapack< std::complex<double> >(
+    Matrix< std::complex<double> >& B, std::complex<double>* Bdata, int64_t ldb);
+
+template
+void copylapack2ge< std::complex<double> >(
+    std::complex<double> const* Bdata, int64_t ldb, Matrix< std::complex<double> >& B);
+
+template
+void gbmm_lapack< std::complex<double> >(
+    Side side, int64_t m, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double> alpha, std::complex<double> const* AB, int64_t ldab,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double> beta, std::complex<double>* C, int64_t ldc);
+
+} // namespace internal
+} // namespace slate
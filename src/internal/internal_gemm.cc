@@ -8,6 +8,7 @@
 #include "slate/Tile_blas.hh"
 #include "internal/internal.hh"
 #include "internal/internal_batch.hh"
+#include "internal/internal_util.hh"
 
 namespace slate {
 namespace internal {
@@ -50,6 +51,161 @@ void gemm(scalar_t alpha, Matrix<scalar_t>&& A,
          layout, priority, queue_index, opts);
 }
 
+#ifdef BLAS_HAVE_MKL
+//------------------------------------------------------------------------------
+/// Host OpenMP task implementation of gemm that packs each tile of A and B
+/// once into MKL's packed format, then reuses it for all tiles of C in its
+/// block row or column, instead of having gemm pack it again for each tile
+/// of C. MKL provides packed gemm only for real single and double.
+///
+/// Tiles of A are packed for n = C.tileNb(0), and tiles of B for
+/// m = C.tileMb(0), so C tiles of other sizes, on the bottom and right
+/// edges, use regular gemm. alpha is applied when packing A.
+///
+/// Assumes op(C) is NoTrans and tiles are column major and on host.
+///
+/// @return false, having done nothing, if tile sizes of C aren't uniform
+/// except for the last block row and column, or if allocating the packed
+/// buffers fails; the caller then uses regular gemm.
+///
+template <typename scalar_t>
+bool gemm_packed(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    std::vector< typename BaseMatrix<scalar_t>::ij_tuple > const& C_tiles,
+    std::vector<int> const& C_home,
+    int priority, bool call_tile_tick )
+{
+    const scalar_t one = 1.0;
+    int64_t mb = C.tileMb( 0 );
+    int64_t nb = C.tileNb( 0 );
+    int64_t kb = A.tileNb( 0 );  // A is one block column
+
+    for (int64_t i = 1; i < C.mt() - 1; ++i) {
+        if (C.tileMb( i ) != mb)
+            return false;
+    }
+    for (int64_t j = 1; j < C.nt() - 1; ++j) {
+        if (C.tileNb( j ) != nb)
+            return false;
+    }
+
+    std::vector<scalar_t*> A_packed( C.mt(), nullptr );
+    std::vector<scalar_t*> B_packed( C.nt(), nullptr );
+    auto free_packed = [&]() {
+        for (auto ptr : A_packed) {
+            if (ptr != nullptr)
+                mkl_free( ptr );
+        }
+        for (auto ptr : B_packed) {
+            if (ptr != nullptr)
+                mkl_free( ptr );
+        }
+    };
+
+    bool alloc_failed = false;
+    for (auto ij : C_tiles) {
+        int64_t i = std::get<0>( ij );
+        int64_t j = std::get<1>( ij );
+        if (A_packed[ i ] == nullptr && C.tileNb( j ) == nb) {
+            size_t bytes = cblas_gemm_pack_get_size<scalar_t>(
+                CblasAMatrix, C.tileMb( i ), nb, kb );
+            A_packed[ i ] = (scalar_t*) mkl_malloc( bytes, 64 );
+            alloc_failed = alloc_failed || A_packed[ i ] == nullptr;
+        }
+        if (B_packed[ j ] == nullptr
+            && C.tileMb( i ) == mb && C.tileNb( j ) == nb) {
+            size_t bytes = cblas_gemm_pack_get_size<scalar_t>(
+                CblasBMatrix, mb, C.tileNb( j ), kb );
+            B_packed[ j ] = (scalar_t*) mkl_malloc( bytes, 64 );
+            alloc_failed = alloc_failed || B_packed[ j ] == nullptr;
+        }
+    }
+    if (alloc_failed) {
+        free_packed();
+        return false;
+    }
+
+    #pragma omp taskgroup
+    {
+        for (int64_t i = 0; i < C.mt(); ++i) {
+            if (A_packed[ i ] != nullptr) {
+                #pragma omp task slate_omp_default_none \
+                    shared( A, A_packed ) \
+                    firstprivate( i, nb, alpha ) priority( priority )
+                {
+                    auto Ai = A( i, 0 );
+                    cblas_gemm_pack(
+                        CblasColMajor, CblasAMatrix,
+                        cblas_trans_const( Ai.op() ),
+                        Ai.mb(), nb, Ai.nb(),
+                        alpha, Ai.data(), Ai.stride(), A_packed[ i ] );
+                }
+            }
+        }
+        for (int64_t j = 0; j < C.nt(); ++j) {
+            if (B_packed[ j ] != nullptr) {
+                #pragma omp task slate_omp_default_none \
+                    shared( B, B_packed ) \
+                    firstprivate( j, mb, one ) priority( priority )
+                {
+                    auto Bj = B( 0, j );
+                    cblas_gemm_pack(
+                        CblasColMajor, CblasBMatrix,
+                        cblas_trans_const( Bj.op() ),
+                        mb, Bj.nb(), Bj.mb(),
+                        one, Bj.data(), Bj.stride(), B_packed[ j ] );
+                }
+            }
+        }
+    }
+
+    int err = 0;
+    std::string err_msg;
+    localityTasks( C_tiles.size(), C_home, priority, [&]( int64_t k ) {
+        int64_t i = std::get<0>( C_tiles[ k ] );
+        int64_t j = std::get<1>( C_tiles[ k ] );
+        try {
+            C.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+            auto Ai = A( i, 0 );
+            auto Bj = B( 0, j );
+            auto Cij = C( i, j );
+            if (Cij.nb() == nb) {
+                // Packed A; packed B if it fits.
+                bool use_B_packed = B_packed[ j ] != nullptr && Cij.mb() == mb;
+                cblas_gemm_compute(
+                    CblasColMajor, CblasPacked,
+                    use_B_packed ? MKL_INT( CblasPacked )
+                                 : MKL_INT( cblas_trans_const( Bj.op() ) ),
+                    Cij.mb(), Cij.nb(), Ai.nb(),
+                    A_packed[ i ], Ai.stride(),
+                    use_B_packed ? B_packed[ j ] : Bj.data(), Bj.stride(),
+                    beta, Cij.data(), Cij.stride() );
+            }
+            else {
+                tile::gemm( alpha, Ai, Bj, beta, Cij );
+            }
+            if (call_tile_tick) {
+                A.tileTick( i, 0 );
+                B.tileTick( 0, j );
+            }
+        }
+        catch (std::exception& e) {
+            err = __LINE__;
+            err_msg = std::string( e.what() );
+        }
+    });
+
+    free_packed();
+
+    if (err)
+        slate_error( err_msg+", line "+std::to_string( err ) );
+
+    return true;
+}
+#endif // BLAS_HAVE_MKL
+
 //------------------------------------------------------------------------------
 /// General matrix multiply to update trailing matrix,
 /// where A is a single block column and B is a single block row.
@@ -80,48 +236,68 @@ void gemm(internal::TargetType<Target::HostTask>,
     bool call_tile_tick = tile_release_strategy == TileReleaseStrategy::Internal
                           || tile_release_strategy == TileReleaseStrategy::All;
 
+    bool tile_affinity = get_option<bool>( opts, Option::TileAffinity, true );
+    bool gemm3m = get_option<bool>( opts, Option::Gemm3M, false );
+
     int err = 0;
     std::string err_msg;
     std::set<ij_tuple> A_tiles_set, B_tiles_set;
+    std::vector<ij_tuple> C_tiles;
     for (int64_t i = 0; i < C.mt(); ++i) {
         for (int64_t j = 0; j < C.nt(); ++j) {
             if (C.tileIsLocal(i, j)) {
                 A_tiles_set.insert({i, 0});
                 B_tiles_set.insert({0, j});
+                C_tiles.push_back({i, j});
             }
         }
     }
     A.tileGetForReading(A_tiles_set, LayoutConvert(layout));
     B.tileGetForReading(B_tiles_set, LayoutConvert(layout));
 
-    #pragma omp taskgroup
-    for (int64_t i = 0; i < C.mt(); ++i) {
-        for (int64_t j = 0; j < C.nt(); ++j) {
-            if (C.tileIsLocal(i, j)) {
-                #pragma omp task slate_omp_default_none \
-                    shared( A, B, C, err, err_msg ) \
-                    firstprivate(i, j, layout, alpha, beta, call_tile_tick) \
-                    priority(priority)
-                {
-                    try {
-                        C.tileGetForWriting(i, j, LayoutConvert(layout));
-                        tile::gemm(
-                            alpha, A(i, 0), B(0, j),
-                            beta,  C(i, j) );
-                        if (call_tile_tick) {
-                            // todo: shouldn't tileRelease()?
-                            A.tileTick(i, 0);
-                            B.tileTick(0, j);
-                        }
-                    }
-                    catch (std::exception& e) {
-                        err = __LINE__;
-                        err_msg = std::string(e.what());
-                    }
-                }
-            }
+    // Update C tiles on their home NUMA node, if possible.
+    std::vector<int> C_home = tileHomeNodes( C, C_tiles, tile_affinity );
+
+#ifdef BLAS_HAVE_MKL
+    // If tiles of A or B are reused by several C tiles, pack them once.
+    bool use_packed = get_option<bool>( opts, Option::GemmPacked, false );
+    if constexpr (! is_complex<scalar_t>::value) {
+        if (use_packed && layout == Layout::ColMajor
+            && C.op() == Op::NoTrans
+            && (C_tiles.size() > A_tiles_set.size()
+                || C_tiles.size() > B_tiles_set.size())
+            && gemm_packed( alpha, A, B, beta, C, C_tiles, C_home,
+                            priority, call_tile_tick )) {
+            return;
         }
     }
+#endif
+    localityTasks( C_tiles.size(), C_home, priority, [&]( int64_t k ) {
+        int64_t i = std::get<0>( C_tiles[ k ] );
+        int64_t j = std::get<1>( C_tiles[ k ] );
+        try {
+            C.tileGetForWriting(i, j, LayoutConvert(layout));
+            if (gemm3m) {
+                tile::gemm3m(
+                    alpha, A(i, 0), B(0, j),
+                    beta,  C(i, j) );
+            }
+            else {
+                tile::gemm(
+                    alpha, A(i, 0), B(0, j),
+                    beta,  C(i, j) );
+            }
+            if (call_tile_tick) {
+                // todo: shouldn't tileRelease()?
+                A.tileTick(i, 0);
+                B.tileTick(0, j);
+            }
+        }
+        catch (std::exception& e) {
+            err = __LINE__;
+            err_msg = std::string(e.what());
+        }
+    });
 
     if (err)
         slate_error(err_msg+", line "+std::to_string(err));
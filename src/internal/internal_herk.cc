@@ -8,6 +8,7 @@
 #include "slate/types.hh"
 #include "slate/Tile_blas.hh"
 #include "internal/internal.hh"
+#include "internal/internal_util.hh"
 #include "internal/internal_batch.hh"
 
 namespace slate {
@@ -65,64 +66,67 @@ void herk(internal::TargetType<Target::HostTask>,
     //       by watching 'layout' and 'C(i, j).layout()'
     assert(layout == Layout::ColMajor);
 
+    bool tile_affinity = get_option<bool>( opts, Option::TileAffinity, true );
+    bool gemm3m = get_option<bool>( opts, Option::Gemm3M, false );
+
     // Lower, NoTrans
-    int err = 0;
-    #pragma omp taskgroup
+    using ij_tuple = std::tuple<int64_t, int64_t>;
+    std::vector<ij_tuple> C_tiles;
     for (int64_t j = 0; j < C.nt(); ++j) {
         for (int64_t i = j; i < C.mt(); ++i) {  // lower
-            if (C.tileIsLocal(i, j)) {
-                if (i == j) {
-                    #pragma omp task slate_omp_default_none \
-                        shared( A, C, err ) priority( priority ) \
-                        firstprivate(j, layout, alpha, beta, call_tile_tick)
-                    {
-                        try {
-                            A.tileGetForReading(j, 0, LayoutConvert(layout));
-                            C.tileGetForWriting(j, j, LayoutConvert(layout));
-                            tile::herk(
-                                alpha, A(j, 0),
-                                beta,  C(j, j) );
-
-                            if (call_tile_tick) {
-                                // todo: should tileRelease()?
-                                A.tileTick(j, 0);
-                                // todo: why the second tick?
-                                A.tileTick(j, 0);
-                            }
-                        }
-                        catch (std::exception& e) {
-                            err = __LINE__;
-                        }
-                    }
+            if (C.tileIsLocal(i, j))
+                C_tiles.push_back({i, j});
+        }
+    }
+
+    // Update C tiles on their home NUMA node, if possible.
+    int err = 0;
+    std::vector<int> C_home = tileHomeNodes( C, C_tiles, tile_affinity );
+    localityTasks( C_tiles.size(), C_home, priority, [&]( int64_t k ) {
+        int64_t i = std::get<0>( C_tiles[ k ] );
+        int64_t j = std::get<1>( C_tiles[ k ] );
+        try {
+            if (i == j) {
+                A.tileGetForReading(j, 0, LayoutConvert(layout));
+                C.tileGetForWriting(j, j, LayoutConvert(layout));
+                tile::herk(
+                    alpha, A(j, 0),
+                    beta,  C(j, j) );
+
+                if (call_tile_tick) {
+                    // todo: should tileRelease()?
+                    A.tileTick(j, 0);
+                    // todo: why the second tick?
+                    A.tileTick(j, 0);
+                }
+            }
+            else {
+                A.tileGetForReading(i, 0, LayoutConvert(layout));
+                A.tileGetForReading(j, 0, LayoutConvert(layout));
+                C.tileGetForWriting(i, j, LayoutConvert(layout));
+                auto Aj0 = A(j, 0);
+                if (gemm3m) {
+                    tile::gemm3m(
+                        alpha_, A(i, 0), conj_transpose( Aj0 ),
+                        beta_,  C(i, j) );
                 }
                 else {
-                    #pragma omp task slate_omp_default_none \
-                        shared( A, C, err ) priority( priority ) \
-                        firstprivate(i, j, layout, alpha_, beta_, call_tile_tick)
-                    {
-                        try {
-                            A.tileGetForReading(i, 0, LayoutConvert(layout));
-                            A.tileGetForReading(j, 0, LayoutConvert(layout));
-                            C.tileGetForWriting(i, j, LayoutConvert(layout));
-                            auto Aj0 = A(j, 0);
-                            tile::gemm(
-                                alpha_, A(i, 0), conj_transpose( Aj0 ),
-                                beta_,  C(i, j) );
-
-                            if (call_tile_tick) {
-                                // todo: should tileRelease()?
-                                A.tileTick(i, 0);
-                                A.tileTick(j, 0);
-                            }
-                        }
-                        catch (std::exception& e) {
-                            err = __LINE__;
-                        }
-                    }
+                    tile::gemm(
+                        alpha_, A(i, 0), conj_transpose( Aj0 ),
+                        beta_,  C(i, j) );
+                }
+
+                if (call_tile_tick) {
+                    // todo: should tileRelease()?
+                    A.tileTick(i, 0);
+                    A.tileTick(j, 0);
                 }
             }
         }
-    }
+        catch (std::exception& e) {
+            err = __LINE__;
+        }
+    });
 
     if (err)
         throw std::exception();
@@ -0,0 +1,336 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Sweeps over the local tiles once, setting
+/// X = convert( D ) + beta X and R = B.
+/// Host OpenMP task implementation.
+/// Assumes D, X, B, R have the same tile sizes and distribution.
+/// @ingroup gesv_internal
+///
+template <typename src_scalar_t, typename scalar_t>
+void iterref_update_tiles(
+    Matrix<src_scalar_t>& D, scalar_t beta,
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& R)
+{
+    const Layout layout = Layout::ColMajor;
+    const scalar_t zero = 0.0;
+
+    #pragma omp taskgroup
+    for (int64_t i = 0; i < X.mt(); ++i) {
+        for (int64_t j = 0; j < X.nt(); ++j) {
+            if (X.tileIsLocal(i, j)) {
+                #pragma omp task slate_omp_default_none \
+                    shared( D, X, B, R ) \
+                    firstprivate( i, j, beta, zero, layout, HostNum )
+                {
+                    D.tileGetForReading(i, j, LayoutConvert(layout));
+                    B.tileGetForReading(i, j, LayoutConvert(layout));
+                    X.tileGetForWriting(i, j, LayoutConvert(layout));
+                    R.tileGetForWriting(i, j, LayoutConvert(layout));
+                    auto Dij = D(i, j);
+                    auto Xij = X(i, j);
+                    auto Bij = B(i, j);
+                    auto Rij = R(i, j);
+                    assert(Xij.op() == Op::NoTrans && Rij.op() == Op::NoTrans);
+
+                    const src_scalar_t* Ddata = Dij.data();
+                    const scalar_t* Bdata = Bij.data();
+                    scalar_t* Xdata = Xij.data();
+                    scalar_t* Rdata = Rij.data();
+                    int64_t ldd = Dij.stride();
+                    int64_t ldx = Xij.stride();
+                    int64_t ldb = Bij.stride();
+                    int64_t ldr = Rij.stride();
+                    for (int64_t jj = 0; jj < Xij.nb(); ++jj) {
+                        for (int64_t ii = 0; ii < Xij.mb(); ++ii) {
+                            scalar_t dx = scalar_t( Ddata[ ii + jj*ldd ] );
+                            // Don't read X when beta = 0; it may be unset.
+                            if (beta == zero)
+                                Xdata[ ii + jj*ldx ] = dx;
+                            else
+                                Xdata[ ii + jj*ldx ] = dx + beta*Xdata[ ii + jj*ldx ];
+                            Rdata[ ii + jj*ldr ] = Bdata[ ii + jj*ldb ];
+                        }
+                    }
+                    D.tileTick(i, j);
+                    B.tileTick(i, j);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Sweeps over the local tiles once, computing the local column max norms
+/// of X and R, and setting Y = convert( R ).
+/// Host OpenMP task implementation.
+/// Assumes X, R, Y have the same tile sizes and distribution.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t, typename dst_scalar_t>
+void iterref_colnorms_tiles(
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& R,
+    Matrix<dst_scalar_t>& Y,
+    blas::real_type<scalar_t>* colnorms_X,
+    blas::real_type<scalar_t>* colnorms_R)
+{
+    using real_t = blas::real_type<scalar_t>;
+    const Layout layout = Layout::ColMajor;
+
+    int64_t mt = X.mt();
+    int64_t n  = X.n();
+
+    // Max of each column in each tile.
+    std::vector<real_t> cols_maxima_X(n*mt, 0.0);
+    std::vector<real_t> cols_maxima_R(n*mt, 0.0);
+
+    #pragma omp taskgroup
+    for (int64_t i = 0; i < mt; ++i) {
+        int64_t jj = 0;
+        for (int64_t j = 0; j < X.nt(); ++j) {
+            if (X.tileIsLocal(i, j)) {
+                #pragma omp task slate_omp_default_none \
+                    shared( X, R, Y, cols_maxima_X, cols_maxima_R ) \
+                    firstprivate( i, j, jj, n, layout )
+                {
+                    X.tileGetForReading(i, j, LayoutConvert(layout));
+                    R.tileGetForReading(i, j, LayoutConvert(layout));
+                    Y.tileGetForWriting(i, j, LayoutConvert(layout));
+                    auto Xij = X(i, j);
+                    auto Rij = R(i, j);
+                    auto Yij = Y(i, j);
+                    assert(Xij.op() == Op::NoTrans && Yij.op() == Op::NoTrans);
+
+                    const scalar_t* Xdata = Xij.data();
+                    const scalar_t* Rdata = Rij.data();
+                    dst_scalar_t* Ydata = Yij.data();
+                    int64_t ldx = Xij.stride();
+                    int64_t ldr = Rij.stride();
+                    int64_t ldy = Yij.stride();
+                    real_t* max_X = &cols_maxima_X[ n*i + jj ];
+                    real_t* max_R = &cols_maxima_R[ n*i + jj ];
+                    for (int64_t c = 0; c < Xij.nb(); ++c) {
+                        for (int64_t r = 0; r < Xij.mb(); ++r) {
+                            scalar_t rval = Rdata[ r + c*ldr ];
+                            max_X[ c ] = max_nan( max_X[ c ],
+                                                  std::abs( Xdata[ r + c*ldx ] ) );
+                            max_R[ c ] = max_nan( max_R[ c ], std::abs( rval ) );
+                            Ydata[ r + c*ldy ] = dst_scalar_t( rval );
+                        }
+                    }
+                }
+            }
+            jj += X.tileNb(j);
+        }
+    }
+
+    // Find max of each column.
+    // Absolute values are >= 0, so it is safe to initialize to 0.
+    std::fill_n(colnorms_X, n, 0.0);
+    std::fill_n(colnorms_R, n, 0.0);
+    for (int64_t i = 0; i < mt; ++i) {
+        for (int64_t c = 0; c < n; ++c) {
+            colnorms_X[ c ] = max_nan( colnorms_X[ c ], cols_maxima_X[ n*i + c ] );
+            colnorms_R[ c ] = max_nan( colnorms_R[ c ], cols_maxima_R[ n*i + c ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Updates the iterate and resets the residual in an iterative refinement
+/// step:
+///     X = convert( D ) + beta X,
+///     R = B,
+/// where D is the correction from the low-precision solve, and beta is
+/// one to accumulate the correction or zero to take it as the iterate.
+/// R is then ready for R = B - A X.
+///
+/// On host targets, this is one sweep over the local tiles, fusing the
+/// precision conversion of D, the add, and the copy of B, which would
+/// otherwise be copy( D, R ), add( R, X ), copy( B, R ).
+/// With Target::Devices, it calls those routines.
+///
+/// Assumes D, X, B, R have the same tile sizes and distribution.
+/// @ingroup gesv_internal
+///
+template <typename src_scalar_t, typename scalar_t>
+void iterRefUpdate(
+    Matrix<src_scalar_t>& D, scalar_t beta,
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& R,
+    Options const& opts)
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    if (target == Target::Devices) {
+        if (beta == zero) {
+            slate::copy( D, X, opts );
+        }
+        else {
+            slate::copy( D, R, opts );
+            slate::add( one, R, beta, X, opts );
+        }
+        slate::copy( B, R, opts );
+        return;
+    }
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        iterref_update_tiles( D, beta, X, B, R );
+        #pragma omp taskwait
+        X.tileUpdateAllOrigin();
+        R.tileUpdateAllOrigin();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Computes the column max norms of the iterate X and the residual R,
+/// and sets Y = convert( R ), the input to the next low-precision solve,
+/// in an iterative refinement step.
+///
+/// On host targets, this is one sweep over the local tiles and one
+/// MPI_Allreduce for both norms, instead of colNorms( X ), colNorms( R ),
+/// and copy( R, Y ). Y is set even if the iteration has converged.
+/// With Target::Devices, it calls those routines.
+///
+/// Assumes X, R, Y have the same tile sizes and distribution.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t, typename dst_scalar_t>
+void iterRefColNorms(
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& R,
+    Matrix<dst_scalar_t>& Y,
+    blas::real_type<scalar_t>* colnorms_X,
+    blas::real_type<scalar_t>* colnorms_R,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    if (target == Target::Devices) {
+        colNorms( Norm::Max, X, colnorms_X, opts );
+        colNorms( Norm::Max, R, colnorms_R, opts );
+        slate::copy( R, Y, opts );
+        return;
+    }
+
+    int64_t n = X.n();
+    assert(R.n() == n);
+
+    // Local maxes of X in [0, n), of R in [n, 2n).
+    std::vector<real_t> local_maxes(2*n);
+    std::vector<real_t> maxes(2*n);
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        iterref_colnorms_tiles( X, R, Y, &local_maxes[ 0 ], &local_maxes[ n ] );
+        #pragma omp taskwait
+        Y.tileUpdateAllOrigin();
+    }
+
+    MPI_Op op_max_nan;
+    #pragma omp critical(slate_mpi)
+    {
+        slate_mpi_call(
+            MPI_Op_create(mpi_max_nan, true, &op_max_nan));
+    }
+
+    #pragma omp critical(slate_mpi)
+    {
+        trace::Block trace_block("MPI_Allreduce");
+        slate_mpi_call(
+            MPI_Allreduce(local_maxes.data(), maxes.data(),
+                          2*n, mpi_type<real_t>::value,
+                          op_max_nan, X.mpiComm()));
+    }
+
+    #pragma omp critical(slate_mpi)
+    {
+        slate_mpi_call(
+            MPI_Op_free(&op_max_nan));
+    }
+
+    std::copy(&maxes[ 0 ], &maxes[ n ],   colnorms_X);
+    std::copy(&maxes[ n ], &maxes[ 2*n ], colnorms_R);
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+// ----------------------------------------
+template
+void iterRefUpdate<float, double>(
+    Matrix<float>& D, double beta,
+    Matrix<double>& X,
+    Matrix<double>& B,
+    Matrix<double>& R,
+    Options const& opts);
+
+template
+void iterRefUpdate< std::complex<float>, std::complex<double> >(
+    Matrix< std::complex<float> >& D, std::complex<double> beta,
+    Matrix< std::complex<double> >& X,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& R,
+    Options const& opts);
+
+// ----------------------------------------
+template
+void iterRefColNorms<double, float>(
+    Matrix<double>& X,
+    Matrix<double>& R,
+    Matrix<float>& Y,
+    double* colnorms_X,
+    double* colnorms_R,
+    Options const& opts);
+
+template
+void iterRefColNorms<double, double>(
+    Matrix<double>& X,
+    Matrix<double>& R,
+    Matrix<double>& Y,
+    double* colnorms_X,
+    double* colnorms_R,
+    Options const& opts);
+
+template
+void iterRefColNorms< std::complex<double>, std::complex<float> >(
+    Matrix< std::complex<double> >& X,
+    Matrix< std::complex<double> >& R,
+    Matrix< std::complex<float> >& Y,
+    double* colnorms_X,
+    double* colnorms_R,
+    Options const& opts);
+
+template
+void iterRefColNorms< std::complex<double>, std::complex<double> >(
+    Matrix< std::complex<double> >& X,
+    Matrix< std::complex<double> >& R,
+    Matrix< std::complex<double> >& Y,
+    double* colnorms_X,
+    double* colnorms_R,
+    Options const& opts);
+
+} // namespace internal
+} // namespace slate
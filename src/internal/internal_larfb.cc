@@ -0,0 +1,283 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/Matrix.hh"
+#include "slate/types.hh"
+#include "slate/Tile_blas.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Multiply matrix by a block reflector merged from several panels.
+/// Dispatches to target implementations.
+/// @ingroup geqrf_internal
+///
+template <Target target, typename scalar_t>
+void larfb(Side side, Op op,
+           Matrix<scalar_t>&& V,
+           Matrix<scalar_t>&& T,
+           Matrix<scalar_t>&& C,
+           int priority)
+{
+    larfb(internal::TargetType<target>(),
+          side, op, V, T, C, priority);
+}
+
+//------------------------------------------------------------------------------
+/// Multiply matrix by a block reflector merged from several panels,
+/// host OpenMP task implementation.
+/// C = op(Q) C for side = left, or
+/// C = C op(Q) for side = right,
+/// where Q = I - V T V^H is the product of the panels' block reflectors
+/// I - V(:, p) T(p, p) V(:, p)^H, p = 0, ..., V.nt()-1, in order.
+///
+/// Panel p's reflectors start at block row p of V. Their number is
+/// min( V.tileNb( p ), rows of V from block row p ), and T(p, p) holds
+/// their upper triangular factor, as from a local geqrf of the panel.
+/// For LQ, pass V as the conjugate transpose of the panels' block rows;
+/// since the LQ Q = I - V T^H V^H, also pass op flipped, as LAPACK unmlq
+/// does.
+///
+/// The merged T is formed as in LAPACK larft (forward, columnwise),
+///     T = [ T0  -T0 V0^H V1 T1 ]
+///         [ 0    T1            ],
+/// then applied with one pass over C, as in LAPACK larfb.
+/// Assumes each block col (left) or block row (right) of C resides on a
+/// single rank, which also holds all tiles of V and the diagonal of T.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void larfb(internal::TargetType<Target::HostTask>,
+           Side side, Op op,
+           Matrix<scalar_t>& V,
+           Matrix<scalar_t>& T,
+           Matrix<scalar_t>& C,
+           int priority)
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const Layout layout = Layout::ColMajor;
+
+    int64_t mt = C.mt();
+    int64_t nt = C.nt();
+    int64_t vt = V.mt();
+    int64_t np = V.nt();
+
+    // Local block cols (left) or block rows (right) of C.
+    std::vector<int64_t> local_indices;
+    if (side == Side::Left) {
+        assert(vt == mt);
+        for (int64_t j = 0; j < nt; ++j) {
+            if (C.tileIsLocal(0, j))
+                local_indices.push_back(j);
+        }
+    }
+    else {
+        assert(vt == nt);
+        for (int64_t i = 0; i < mt; ++i) {
+            if (C.tileIsLocal(i, 0))
+                local_indices.push_back(i);
+        }
+    }
+    if (local_indices.empty())
+        return;
+
+    // Row offsets of block rows of V, and offsets of each panel's
+    // reflectors in the merged T.
+    std::vector<int64_t> row_offset(vt + 1, 0);
+    for (int64_t i = 0; i < vt; ++i)
+        row_offset[i+1] = row_offset[i] + V.tileMb(i);
+    int64_t m = row_offset[vt];
+
+    std::vector<int64_t> col_offset(np + 1, 0);
+    for (int64_t p = 0; p < np; ++p) {
+        int64_t kp = std::max(int64_t(0),
+                              std::min(V.tileNb(p), m - row_offset[p]));
+        col_offset[p+1] = col_offset[p] + kp;
+    }
+    int64_t k = col_offset[np];
+    if (k == 0)
+        return;
+
+    // Gather V into an m-by-k matrix, with explicit zeros above and
+    // ones on the diagonal of each reflector.
+    std::vector<scalar_t> Vdata(m*k, zero);
+    for (int64_t p = 0; p < np; ++p) {
+        int64_t kp = col_offset[p+1] - col_offset[p];
+        for (int64_t i = p; i < vt && kp > 0; ++i) {
+            V.tileGetForReading(i, p, LayoutConvert(layout));
+            auto Vip = V(i, p);
+            for (int64_t jj = 0; jj < kp; ++jj) {
+                int64_t diag = row_offset[p] + jj;
+                scalar_t* Vcol = &Vdata[ (col_offset[p] + jj)*m ];
+                for (int64_t ii = 0; ii < Vip.mb(); ++ii) {
+                    int64_t row = row_offset[i] + ii;
+                    if (row > diag)
+                        Vcol[ row ] = Vip(ii, jj);
+                    else if (row == diag)
+                        Vcol[ row ] = one;
+                }
+            }
+        }
+    }
+
+    // Merge the panels' T factors into a k-by-k T, adding one panel at a time.
+    std::vector<scalar_t> Tdata(k*k, zero);
+    std::vector<scalar_t> Y;
+    for (int64_t p = 0; p < np; ++p) {
+        int64_t k0 = col_offset[p];
+        int64_t kp = col_offset[p+1] - k0;
+        if (kp == 0)
+            continue;
+
+        T.tileGetForReading(p, p, LayoutConvert(layout));
+        auto Tpp = T(p, p);
+        assert(kp <= std::min(Tpp.mb(), Tpp.nb()));
+        for (int64_t jj = 0; jj < kp; ++jj) {
+            for (int64_t ii = 0; ii <= jj; ++ii)
+                Tdata[ (k0 + ii) + (k0 + jj)*k ] = Tpp(ii, jj);
+        }
+        if (k0 == 0)
+            continue;
+
+        scalar_t* Tp = &Tdata[ k0 + k0*k ];
+
+        // Y = V(:, 0:k0-1)^H V(:, k0:k0+kp-1), k0-by-kp.
+        Y.resize(k0*kp);
+        blas::gemm(layout, Op::ConjTrans, Op::NoTrans,
+                   k0, kp, m,
+                   one,  &Vdata[ 0 ], m,
+                         &Vdata[ k0*m ], m,
+                   zero, &Y[ 0 ], k0);
+
+        // T(0:k0-1, k0:k0+kp-1) = -T(0:k0-1, 0:k0-1) Y Tp.
+        // The merged T stays upper triangular.
+        blas::trmm(layout, Side::Left, Uplo::Upper,
+                   Op::NoTrans, Diag::NonUnit,
+                   k0, kp, one, &Tdata[ 0 ], k, &Y[ 0 ], k0);
+        blas::trmm(layout, Side::Right, Uplo::Upper,
+                   Op::NoTrans, Diag::NonUnit,
+                   k0, kp, -one, Tp, k, &Y[ 0 ], k0);
+        lapack::lacpy(lapack::MatrixType::General, k0, kp,
+                      &Y[ 0 ], k0, &Tdata[ k0*k ], k);
+    }
+
+    Tile<scalar_t> Ttile(k, k, &Tdata[ 0 ], k, HostNum, TileKind::UserOwned);
+    if (op != Op::NoTrans)
+        Ttile = conj_transpose( Ttile );
+
+    #pragma omp taskgroup
+    for (int64_t index : local_indices) {
+        #pragma omp task slate_omp_default_none \
+            shared( C, Vdata, Ttile, row_offset ) \
+            firstprivate( index, side, m, k, vt, zero, one, layout ) \
+            priority( priority )
+        {
+            if (side == Side::Left) {
+                // op(Q) C(:, j) = C(:, j) - V op(T) V^H C(:, j).
+                int64_t j = index;
+                int64_t nb = C.tileNb(j);
+                std::vector<scalar_t> Wdata(k*nb), W2data(k*nb);
+                Tile<scalar_t> W(k, nb, &Wdata[ 0 ], k,
+                                 HostNum, TileKind::UserOwned);
+                Tile<scalar_t> W2(k, nb, &W2data[ 0 ], k,
+                                  HostNum, TileKind::UserOwned);
+
+                // W = V^H C(:, j)
+                for (int64_t i = 0; i < vt; ++i) {
+                    C.tileGetForWriting(i, j, LayoutConvert(layout));
+                    Tile<scalar_t> Vi(C.tileMb(i), k, &Vdata[ row_offset[i] ], m,
+                                      HostNum, TileKind::UserOwned);
+                    tile::gemm(one,  conj_transpose( Vi ), C(i, j),
+                               (i == 0 ? zero : one), W);
+                }
+
+                // W2 = op(T) W
+                tile::gemm(one, Ttile, W, zero, W2);
+
+                // C(:, j) -= V W2
+                for (int64_t i = 0; i < vt; ++i) {
+                    Tile<scalar_t> Vi(C.tileMb(i), k, &Vdata[ row_offset[i] ], m,
+                                      HostNum, TileKind::UserOwned);
+                    auto Cij = C(i, j);
+                    tile::gemm(-one, Vi, W2, one, Cij);
+                }
+            }
+            else {
+                // C(i, :) op(Q) = C(i, :) - C(i, :) V op(T) V^H.
+                int64_t i = index;
+                int64_t mb = C.tileMb(i);
+                std::vector<scalar_t> Wdata(mb*k), W2data(mb*k);
+                Tile<scalar_t> W(mb, k, &Wdata[ 0 ], mb,
+                                 HostNum, TileKind::UserOwned);
+                Tile<scalar_t> W2(mb, k, &W2data[ 0 ], mb,
+                                  HostNum, TileKind::UserOwned);
+
+                // W = C(i, :) V
+                for (int64_t j = 0; j < vt; ++j) {
+                    C.tileGetForWriting(i, j, LayoutConvert(layout));
+                    Tile<scalar_t> Vj(C.tileNb(j), k, &Vdata[ row_offset[j] ], m,
+                                      HostNum, TileKind::UserOwned);
+                    tile::gemm(one,  C(i, j), Vj,
+                               (j == 0 ? zero : one), W);
+                }
+
+                // W2 = W op(T)
+                tile::gemm(one, W, Ttile, zero, W2);
+
+                // C(i, :) -= W2 V^H
+                for (int64_t j = 0; j < vt; ++j) {
+                    Tile<scalar_t> Vj(C.tileNb(j), k, &Vdata[ row_offset[j] ], m,
+                                      HostNum, TileKind::UserOwned);
+                    auto Cij = C(i, j);
+                    tile::gemm(-one, W2, conj_transpose( Vj ), one, Cij);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+// ----------------------------------------
+template
+void larfb<Target::HostTask, float>(
+    Side side, Op op,
+    Matrix<float>&& V,
+    Matrix<float>&& T,
+    Matrix<float>&& C,
+    int priority);
+
+// ----------------------------------------
+template
+void larfb<Target::HostTask, double>(
+    Side side, Op op,
+    Matrix<double>&& V,
+    Matrix<double>&& T,
+    Matrix<double>&& C,
+    int priority);
+
+// ----------------------------------------
+template
+void larfb< Target::HostTask, std::complex<float> >(
+    Side side, Op op,
+    Matrix< std::complex<float> >&& V,
+    Matrix< std::complex<float> >&& T,
+    Matrix< std::complex<float> >&& C,
+    int priority);
+
+// ----------------------------------------
+template
+void larfb< Target::HostTask, std::complex<double> >(
+    Side side, Op op,
+    Matrix< std::complex<double> >&& V,
+    Matrix< std::complex<double> >&& T,
+    Matrix< std::complex<double> >&& C,
+    int priority);
+
+} // namespace internal
+} // namespace slate
@@ -8,6 +8,7 @@
 #include "slate/types.hh"
 #include "slate/Tile_blas.hh"
 #include "internal/internal.hh"
+#include "internal/internal_util.hh"
 #include "internal/internal_batch.hh"
 
 namespace slate {
@@ -56,45 +57,39 @@ void trsm(internal::TargetType<Target::HostTask>,
     if (B.numLocalTiles() > 0) {
         A.tileGetForReading(0, 0, LayoutConvert(layout));
     }
+    bool tile_affinity = get_option<bool>( opts, Option::TileAffinity, true );
+
     // alternatively, if (side == right), (conj)-transpose both A and B,
     // then assume side == left; see slate::trsm
-    #pragma omp taskgroup
+    using ij_tuple = std::tuple<int64_t, int64_t>;
+    std::vector<ij_tuple> B_tiles;
     if (side == Side::Right) {
         assert(B.nt() == 1);
         for (int64_t i = 0; i < B.mt(); ++i) {
-            if (B.tileIsLocal(i, 0)) {
-                #pragma omp task slate_omp_default_none \
-                    shared( A, B ) \
-                    firstprivate(i, layout, side, alpha) priority(priority)
-                {
-                    B.tileGetForWriting(i, 0, LayoutConvert(layout));
-                    tile::trsm(
-                        side, A.diag(),
-                        alpha, A(0, 0), B(i, 0) );
-                    // todo: should tileRelease()?
-                    A.tileTick(0, 0);
-                }
-            }
+            if (B.tileIsLocal(i, 0))
+                B_tiles.push_back({i, 0});
         }
     }
     else {
         assert(B.mt() == 1);
         for (int64_t j = 0; j < B.nt(); ++j) {
-            if (B.tileIsLocal(0, j)) {
-                #pragma omp task slate_omp_default_none \
-                    shared( A, B ) \
-                    firstprivate(j, layout, side, alpha) priority(priority)
-                {
-                    B.tileGetForWriting(0, j, LayoutConvert(layout));
-                    tile::trsm(
-                        side, A.diag(),
-                        alpha, A(0, 0), B(0, j) );
-                    // todo: should tileRelease()?
-                    A.tileTick(0, 0);
-                }
-            }
+            if (B.tileIsLocal(0, j))
+                B_tiles.push_back({0, j});
         }
     }
+
+    // Solve with B tiles on their home NUMA node, if possible.
+    std::vector<int> B_home = tileHomeNodes( B, B_tiles, tile_affinity );
+    localityTasks( B_tiles.size(), B_home, priority, [&]( int64_t k ) {
+        int64_t i = std::get<0>( B_tiles[ k ] );
+        int64_t j = std::get<1>( B_tiles[ k ] );
+        B.tileGetForWriting(i, j, LayoutConvert(layout));
+        tile::trsm(
+            side, A.diag(),
+            alpha, A(0, 0), B(i, j) );
+        // todo: should tileRelease()?
+        A.tileTick(0, 0);
+    });
 }
 
 //------------------------------------------------------------------------------
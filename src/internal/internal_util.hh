@@ -11,9 +11,12 @@
 
 #include "slate/internal/mpi.hh"
 #include "slate/Matrix.hh"
+#include "auxiliary/Numa.hh"
 
+#include <atomic>
 #include <cmath>
 #include <complex>
+#include <memory>
 
 #include <blas.hh>
 
@@ -109,7 +112,139 @@ slate::Matrix<scalar_t> alloc_basis(slate::BaseMatrix<scalar_t>& A, int64_t n,
     return V;
 }
 
+//------------------------------------------------------------------------------
+/// Helper function to widen n real values, stored at the start of array A,
+/// in place to complex: A[ i ] = x[ i ] + 0i for i = 0, ..., n-1.
+/// Goes backwards, so each real value is read before it is overwritten.
+/// Lets a real solver, e.g., stedc or bdsqr, write into complex storage
+/// without a separate real copy. Does nothing for real types.
+template <typename scalar_t>
+void real2complex_inplace(int64_t n, scalar_t* A)
+{
+    if constexpr (is_complex<scalar_t>::value) {
+        using real_t = blas::real_type<scalar_t>;
+        real_t const* x = reinterpret_cast<real_t*>( A );
+        for (int64_t i = n-1; i >= 0; --i) {
+            real_t xi = x[ i ];
+            A[ i ] = scalar_t( xi, 0 );
+        }
+    }
+}
+
+
+//------------------------------------------------------------------------------
+/// Helper function to copy tile column k of A into P, replicated on all ranks.
+/// P is A.m()-by-A.tileNb( k ), indexed by global row, with leading
+/// dimension A.m(); offset[ i ] is the global index of tile row i.
+/// Each tile has exactly one owner, so summing the contributions is exact.
+/// Used in gehrd and unmhr.
+template <typename scalar_t>
+void gatherTileColumn(
+    Matrix<scalar_t>& A, int64_t k,
+    std::vector<int64_t> const& offset,
+    std::vector<scalar_t>& P)
+{
+    int64_t m = A.m();
+
+    P.assign( m*A.tileNb( k ), scalar_t( 0.0 ) );
+    for (int64_t i = 0; i < A.mt(); ++i) {
+        if (A.tileIsLocal( i, k )) {
+            A.tileGetForReading( i, k, LayoutConvert::ColMajor );
+            auto Aik = A( i, k );
+            lapack::lacpy( lapack::MatrixType::General, Aik.mb(), Aik.nb(),
+                           Aik.data(), Aik.stride(), &P[ offset[ i ] ], m );
+        }
+    }
+    slate_mpi_call(
+        MPI_Allreduce( MPI_IN_PLACE, P.data(), P.size(),
+                       mpi_type<scalar_t>::value, MPI_SUM, A.mpiComm() ));
+}
+
+//------------------------------------------------------------------------------
+/// Helper function to find the home NUMA node of tiles, i.e., the node
+/// holding the first page of each tile's host data.
+/// @return home[ k ] is the node of tiles[ k ], or -1 if unknown;
+///         empty if there is a single NUMA node or tile_affinity is false.
+template <typename scalar_t>
+std::vector<int> tileHomeNodes(
+    BaseMatrix<scalar_t>& A,
+    std::vector< std::tuple<int64_t, int64_t> > const& tiles,
+    bool tile_affinity)
+{
+    std::vector<int> home;
+    if (! tile_affinity || numa::num_nodes() <= 1)
+        return home;
+
+    std::vector<void const*> addrs( tiles.size(), nullptr );
+    for (size_t k = 0; k < tiles.size(); ++k) {
+        int64_t i = std::get<0>( tiles[ k ] );
+        int64_t j = std::get<1>( tiles[ k ] );
+        if (A.tileExists( i, j, HostNum ))
+            addrs[ k ] = A( i, j, HostNum ).data();
+    }
+    numa::page_nodes( addrs, home );
+    return home;
+}
 
+//------------------------------------------------------------------------------
+/// Helper function to run fn( k ), k = 0, ..., n-1, as OpenMP tasks,
+/// preferably on threads of NUMA node home[ k ].
+///
+/// If home is empty, creates one task per k. Otherwise, OpenMP cannot bind a
+/// task to a thread, so it creates one worker task per thread, and each
+/// worker runs the k whose home is the node it is running on, then those
+/// with unknown home, then steals from other nodes.
+/// Returns when all are done.
+template <typename Fn>
+void localityTasks(int64_t n, std::vector<int> const& home, int priority,
+                   Fn const& fn)
+{
+    if (home.empty()) {
+        #pragma omp taskgroup
+        for (int64_t k = 0; k < n; ++k) {
+            #pragma omp task slate_omp_default_none \
+                shared( fn ) firstprivate( k ) priority( priority )
+            {
+                fn( k );
+            }
+        }
+        return;
+    }
+
+    // Queue of k for each node, plus one for unknown home.
+    int num_nodes = numa::num_nodes();
+    std::vector< std::vector<int64_t> > queues( num_nodes + 1 );
+    for (int64_t k = 0; k < n; ++k) {
+        int node = home[ k ];
+        queues[ node >= 0 && node < num_nodes ? node : num_nodes ].push_back( k );
+    }
+    std::unique_ptr< std::atomic<int64_t>[] > next(
+        new std::atomic<int64_t>[ num_nodes + 1 ] );
+    for (int q = 0; q <= num_nodes; ++q)
+        next[ q ] = 0;
+
+    int num_workers = std::min( int64_t( omp_get_num_threads() ), n );
+
+    #pragma omp taskgroup
+    for (int worker = 0; worker < num_workers; ++worker) {
+        #pragma omp task slate_omp_default_none \
+            shared( fn, queues, next ) firstprivate( num_nodes ) \
+            priority( priority )
+        {
+            int node = numa::current_node();
+            for (int q = 0; q <= num_nodes; ++q) {
+                // Own node, unknown home, then other nodes.
+                int queue = (q == 0 ? node
+                             : q == 1 ? num_nodes
+                             : (node + q - 1) % num_nodes);
+                int64_t size = queues[ queue ].size();
+                int64_t index;
+                while ((index = next[ queue ]++) < size)
+                    fn( queues[ queue ][ index ] );
+            }
+        }
+    }
+}
 
 } // namespace internal
 } // namespace slate
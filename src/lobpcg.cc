@@ -0,0 +1,503 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/HermitianMatrix.hh"
+#include "slate/Tile_blas.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Rayleigh-Ritz step of lobpcg, on one rank. Given the Gram matrices
+/// $G_A = S^H A S$ and $G_B = S^H S$ of the m-column basis S, finds the
+/// bs smallest Ritz pairs $G_A C = G_B C \Theta$.
+/// Directions of S that are numerically dependent, i.e., eigenvalues of
+/// $G_B$ below a threshold, are dropped.
+///
+/// @param[in] m
+///     Order of GA and GB.
+///
+/// @param[in] bs
+///     Number of Ritz pairs to find, bs <= m.
+///
+/// @param[in,out] GA
+///     On entry, the m-by-m matrix $G_A$. On exit, destroyed.
+///
+/// @param[in,out] GB
+///     On entry, the m-by-m matrix $G_B$. On exit, destroyed.
+///
+/// @param[out] theta
+///     Vector of length bs, the Ritz values in ascending order.
+///
+/// @param[out] C
+///     The m-by-bs coefficients of the Ritz vectors in S, with ldc = m.
+///
+/// @return false if fewer than bs directions are independent.
+///
+template <typename scalar_t>
+bool rayleigh_ritz(
+    int64_t m, int64_t bs,
+    std::vector<scalar_t>& GA,
+    std::vector<scalar_t>& GB,
+    std::vector< blas::real_type<scalar_t> >& theta,
+    std::vector<scalar_t>& C)
+{
+    using real_t = blas::real_type<scalar_t>;
+    const scalar_t zero = 0.0, one = 1.0;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+
+    // G_B = V D V^H, in ascending order.
+    std::vector<real_t> D( m );
+    int64_t info = lapack::heev( lapack::Job::Vec, lapack::Uplo::Lower, m,
+                                 GB.data(), m, D.data() );
+    if (info != 0 || std::isnan( D[ m-1 ] ))
+        return false;
+
+    // Z = V(:, keep) D(keep)^{-1/2}, so Z^H G_B Z = I.
+    real_t thresh = 100 * m * eps * D[ m-1 ];
+    int64_t j0 = 0;
+    while (j0 < m && D[ j0 ] <= thresh)
+        ++j0;
+    int64_t r = m - j0;
+    if (r < bs)
+        return false;
+    scalar_t* Z = &GB[ j0*m ];
+    for (int64_t j = 0; j < r; ++j)
+        blas::scal( m, 1 / std::sqrt( D[ j0 + j ] ), &Z[ j*m ], 1 );
+
+    // H = Z^H G_A Z = Y Theta Y^H.
+    std::vector<scalar_t> W( m*r ), H( r*r );
+    blas::gemm( blas::Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                m, r, m, one, GA.data(), m, Z, m, zero, W.data(), m );
+    blas::gemm( blas::Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                r, r, m, one, Z, m, W.data(), m, zero, H.data(), r );
+    std::vector<real_t> Theta( r );
+    info = lapack::heev( lapack::Job::Vec, lapack::Uplo::Lower, r,
+                         H.data(), r, Theta.data() );
+    if (info != 0)
+        return false;
+
+    // C = Z Y(:, 0:bs-1).
+    theta.assign( Theta.begin(), Theta.begin() + bs );
+    C.resize( m*bs );
+    blas::gemm( blas::Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                m, bs, r, one, Z, m, H.data(), r, zero, C.data(), m );
+    return true;
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel LOBPCG (locally optimal block preconditioned
+/// conjugate gradient) solver for a few of the smallest eigenvalues and
+/// corresponding eigenvectors of a Hermitian matrix A.
+/// For the largest eigenvalues, call lobpcg with $-A$.
+///
+/// Each iteration keeps a block of bs columns each of the approximate
+/// eigenvectors X, the (preconditioned) residuals W, and the previous
+/// search directions P, as a tall-skinny n-by-3bs matrix S. It computes
+/// $A W$ with hemm, orthonormalizes W and X with cholqr, and solves the
+/// small 3bs-by-3bs Rayleigh-Ritz problem for $S^H A S$ on one rank.
+/// The tall-skinny updates need no communication, since S is distributed
+/// by block rows. Compared to heev, this costs O(n^2 bs) per iteration
+/// instead of O(n^3), so it is useful when k << n and the wanted
+/// eigenvalues are well separated from the rest.
+///
+/// The iteration is stopped when, for $0 \le j < k$,
+///     $\norm{ A x_j - \lambda_j x_j }_2 \le tol \norm{A}_1$,
+/// or after itermax = 500 iterations.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///         One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The n-by-n Hermitian matrix $A$. It is not modified.
+///
+/// @param[out] Lambda
+///     The vector Lambda of length k.
+///     The k smallest eigenvalues in ascending order.
+///
+/// @param[in,out] X
+///     The n-by-k matrix X, 3 k <= n, with the same tile rows as A.
+///     On entry, the initial guess of the eigenvectors; its columns need
+///     to be linearly independent but need not be orthonormal.
+///     On exit, the orthonormal eigenvectors corresponding to Lambda.
+///
+/// @param[out] iter
+///     The number of iterations needed for convergence. If failed,
+///     it is set to be -(1+itermax), where itermax = 500.
+///
+/// @param[in] precond
+///     Preconditioner $T \approx A^{-1}$, applied in place to the n-by-bs
+///     residual block, R = T R. It should be Hermitian positive definite.
+///     Rows of R are distributed 1D in tiles of A: block row i is on
+///     rank i % mpi_size, where mpi_size is the size of A's communicator.
+///     If empty, no preconditioner is used.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::BlockSize:
+///       Block size bs >= k. Extra columns beyond k can speed convergence
+///       when eigenvalue k is close to eigenvalue k+1. 3 bs <= n.
+///       Default k.
+///     - Option::Tolerance:
+///       Relative residual tolerance tol. Default $\sqrt{\epsilon}$.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup heev
+///
+template <typename scalar_t>
+void lobpcg(
+    HermitianMatrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Matrix<scalar_t>& X,
+    int& iter,
+    std::function< void (Matrix<scalar_t>& R) > const& precond,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using ij_tuple = typename Matrix<scalar_t>::ij_tuple;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const int itermax = 500;
+    const auto mpi_real_type = mpi_type< real_t >::value;
+    const auto mpi_scalar_type = mpi_type< scalar_t >::value;
+    const Layout layout = Layout::ColMajor;
+
+    int64_t n = A.n();
+    int64_t k = X.n();
+    int64_t bs = std::max( k, get_option<int64_t>( opts, Option::BlockSize, k ) );
+    real_t tol = get_option<double>( opts, Option::Tolerance,
+                                     std::sqrt( eps ) );
+    MPI_Comm comm = A.mpiComm();
+    int mpi_rank = A.mpiRank();
+    int mpi_size = A.mpiSize();
+    iter = 0;
+
+    slate_error_if( X.m() != n );
+    slate_error_if( 3*bs > n );
+
+    // S = [ X W P ] and AS = A S are n-by-3bs, distributed 1D by block rows,
+    // so each rank has whole rows of S and AS.
+    std::function<int64_t (int64_t)> tileMb = [A]( int64_t i ) {
+        return A.tileMb( i );
+    };
+    std::function<int64_t (int64_t)> tileNb = [bs]( int64_t j ) {
+        return bs;
+    };
+    std::function<int64_t (int64_t)> tileNb_X = [X]( int64_t j ) {
+        return X.tileNb( j );
+    };
+    std::function<int (ij_tuple)> tileRank = [mpi_size]( ij_tuple ij ) {
+        return int( std::get<0>( ij ) % mpi_size );
+    };
+    std::function<int (ij_tuple)> tileDevice = []( ij_tuple ij ) {
+        return HostNum;
+    };
+    Matrix<scalar_t> S( n, 3*bs, tileMb, tileNb, tileRank, tileDevice, comm );
+    Matrix<scalar_t> AS = S.emptyLike();
+    S.insertLocalTiles();
+    AS.insertLocalTiles();
+    int64_t mt = S.mt();
+
+    auto Xs  = S.slice(  0, n-1, 0,    bs-1 );
+    auto Ws  = S.slice(  0, n-1, bs, 2*bs-1 );
+    auto AXs = AS.slice( 0, n-1, 0,    bs-1 );
+    auto AWs = AS.slice( 0, n-1, bs, 2*bs-1 );
+    // bs-by-bs triangular factor for cholqr, in one tile.
+    Matrix<scalar_t> R( bs, bs, bs, 1, 1, comm );
+    R.insertLocalTiles();
+    auto R_U = TriangularMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, R );
+
+    // Copy X into the first k columns of S via X1, which has X's columns
+    // and S's rows; extra columns get a deterministic pseudo-random fill.
+    Matrix<scalar_t> X1( n, k, tileMb, tileNb_X, tileRank, tileDevice, comm );
+    X1.insertLocalTiles();
+    redistribute( X, X1, opts );
+
+    auto for_local_rows = [&]( auto&& body ) {
+        int64_t row = 0;
+        for (int64_t i = 0; i < mt; ++i) {
+            int64_t mb = S.tileMb( i );
+            if (S.tileIsLocal( i, 0 ))
+                body( i, row, mb );
+            row += mb;
+        }
+    };
+    auto data = []( Matrix<scalar_t>& M, int64_t i, int64_t b ) {
+        M.tileGetForWriting( i, b, LayoutConvert::ColMajor );
+        return M( i, b ).data();
+    };
+    auto lda = []( Matrix<scalar_t>& M, int64_t i, int64_t b ) {
+        return M( i, b ).stride();
+    };
+
+    for_local_rows( [&]( int64_t i, int64_t row, int64_t mb ) {
+        scalar_t* Xi = data( S, i, 0 );
+        int64_t ldx = lda( S, i, 0 );
+        int64_t jj = 0;
+        for (int64_t j = 0; j < X1.nt(); ++j) {
+            X1.tileGetForReading( i, j, LayoutConvert::ColMajor );
+            auto T = X1( i, j );
+            lapack::lacpy( lapack::MatrixType::General, mb, T.nb(),
+                           T.data(), T.stride(), &Xi[ jj*ldx ], ldx );
+            jj += T.nb();
+        }
+        for (int64_t j = k; j < bs; ++j) {
+            for (int64_t ii = 0; ii < mb; ++ii) {
+                uint64_t h = (row + ii) * 2654435761u + j * 40503u;
+                Xi[ ii + j*ldx ] = real_t( (h >> 8) % 1024 ) / 1024 - 0.5;
+            }
+        }
+    } );
+
+    // Sums squares of columns of block b of M over all ranks.
+    auto col_norms = [&]( Matrix<scalar_t>& M, int64_t b,
+                          std::vector<real_t>& norms ) {
+        std::vector<real_t> sums( bs, 0.0 );
+        for_local_rows( [&]( int64_t i, int64_t row, int64_t mb ) {
+            scalar_t* Mi = data( M, i, b );
+            int64_t ldm = lda( M, i, b );
+            for (int64_t j = 0; j < bs; ++j) {
+                real_t nrm = blas::nrm2( mb, &Mi[ j*ldm ], 1 );
+                sums[ j ] += nrm * nrm;
+            }
+        } );
+        norms.resize( bs );
+        slate_mpi_call(
+            MPI_Allreduce( sums.data(), norms.data(), bs, mpi_real_type,
+                           MPI_SUM, comm ) );
+        for (int64_t j = 0; j < bs; ++j)
+            norms[ j ] = std::sqrt( norms[ j ] );
+    };
+
+    // Scales columns of block b of M, and of AS if scale_AS, to unit norm.
+    auto normalize = [&]( Matrix<scalar_t>& M, int64_t b, bool scale_AS ) {
+        std::vector<real_t> norms;
+        col_norms( M, b, norms );
+        for_local_rows( [&]( int64_t i, int64_t row, int64_t mb ) {
+            for (int64_t j = 0; j < bs; ++j) {
+                if (norms[ j ] > 0) {
+                    blas::scal( mb, 1 / norms[ j ],
+                                &data( M, i, b )[ j*lda( M, i, b ) ], 1 );
+                    if (scale_AS)
+                        blas::scal( mb, 1 / norms[ j ],
+                                    &data( AS, i, b )[ j*lda( AS, i, b ) ],
+                                    1 );
+                }
+            }
+        } );
+    };
+
+    // Rayleigh-Ritz on blocks 0, ..., nblk-1 of S, then updates locally
+    //     X = S C, AX = AS C, and, if nblk > 1,
+    //     P = S(:, bs:) C(bs:, :), AP = AS(:, bs:) C(bs:, :).
+    std::vector<real_t> theta( bs );
+    auto rayleigh_ritz = [&]( int nblk ) {
+        int64_t m = nblk*bs;
+        // G = [ G_A G_B ] = [ S^H AS, S^H S ], summed over ranks on rank 0.
+        std::vector<scalar_t> G( 2*m*m, zero ), G_sum;
+        for_local_rows( [&]( int64_t i, int64_t row, int64_t mb ) {
+            for (int64_t a = 0; a < nblk; ++a) {
+                for (int64_t b = 0; b < nblk; ++b) {
+                    blas::gemm( layout, Op::ConjTrans, Op::NoTrans,
+                                bs, bs, mb,
+                                one, data( S, i, a ), lda( S, i, a ),
+                                     data( AS, i, b ), lda( AS, i, b ),
+                                one, &G[ a*bs + b*bs*m ], m );
+                    blas::gemm( layout, Op::ConjTrans, Op::NoTrans,
+                                bs, bs, mb,
+                                one, data( S, i, a ), lda( S, i, a ),
+                                     data( S, i, b ), lda( S, i, b ),
+                                one, &G[ m*m + a*bs + b*bs*m ], m );
+                }
+            }
+        } );
+        if (mpi_rank == 0)
+            G_sum.resize( 2*m*m );
+        slate_mpi_call(
+            MPI_Reduce( G.data(), G_sum.data(), 2*m*m, mpi_scalar_type,
+                        MPI_SUM, 0, comm ) );
+
+        std::vector<scalar_t> C( m*bs );
+        int ok = 1;
+        if (mpi_rank == 0) {
+            std::vector<scalar_t> GA( G_sum.begin(), G_sum.begin() + m*m );
+            std::vector<scalar_t> GB( G_sum.begin() + m*m, G_sum.end() );
+            ok = impl::rayleigh_ritz( m, bs, GA, GB, theta, C );
+        }
+        slate_mpi_call(
+            MPI_Bcast( &ok, 1, MPI_INT, 0, comm ) );
+        if (! ok)
+            slate_error( "lobpcg: basis is not linearly independent" );
+        slate_mpi_call(
+            MPI_Bcast( theta.data(), bs, mpi_real_type, 0, comm ) );
+        slate_mpi_call(
+            MPI_Bcast( C.data(), m*bs, mpi_scalar_type, 0, comm ) );
+
+        std::vector<scalar_t> Xnew, Pnew;
+        for (auto* M : { &S, &AS }) {
+            for_local_rows( [&]( int64_t i, int64_t row, int64_t mb ) {
+                Pnew.assign( mb*bs, zero );
+                for (int64_t b = 1; b < nblk; ++b) {
+                    blas::gemm( layout, Op::NoTrans, Op::NoTrans,
+                                mb, bs, bs,
+                                one, data( *M, i, b ), lda( *M, i, b ),
+                                     &C[ b*bs ], m,
+                                one, Pnew.data(), mb );
+                }
+                Xnew.resize( mb*bs );
+                lapack::lacpy( lapack::MatrixType::General, mb, bs,
+                               Pnew.data(), mb, Xnew.data(), mb );
+                blas::gemm( layout, Op::NoTrans, Op::NoTrans,
+                            mb, bs, bs,
+                            one, data( *M, i, 0 ), lda( *M, i, 0 ),
+                                 &C[ 0 ], m,
+                            one, Xnew.data(), mb );
+                lapack::lacpy( lapack::MatrixType::General, mb, bs,
+                               Xnew.data(), mb,
+                               data( *M, i, 0 ), lda( *M, i, 0 ) );
+                if (nblk > 1) {
+                    lapack::lacpy( lapack::MatrixType::General, mb, bs,
+                                   Pnew.data(), mb,
+                                   data( *M, i, 2 ), lda( *M, i, 2 ) );
+                }
+            } );
+        }
+    };
+
+    real_t Anorm = norm( Norm::One, A, opts );
+
+    // Initial Ritz vectors from the span of X.
+    cholqr( Xs, R, opts );
+    hemm( Side::Left, one, A, Xs, zero, AXs, opts );
+    rayleigh_ritz( 1 );
+
+    bool converged = false;
+    std::vector<real_t> resnorms;
+    for (int iiter = 0; iiter <= itermax; ++iiter) {
+        // Residual W = A X - X Theta.
+        for_local_rows( [&]( int64_t i, int64_t row, int64_t mb ) {
+            scalar_t* Xi  = data( S,  i, 0 );
+            scalar_t* AXi = data( AS, i, 0 );
+            scalar_t* Wi  = data( S,  i, 1 );
+            int64_t ldx  = lda( S,  i, 0 );
+            int64_t ldax = lda( AS, i, 0 );
+            int64_t ldw  = lda( S,  i, 1 );
+            for (int64_t j = 0; j < bs; ++j) {
+                for (int64_t ii = 0; ii < mb; ++ii) {
+                    Wi[ ii + j*ldw ] = AXi[ ii + j*ldax ]
+                                     - theta[ j ] * Xi[ ii + j*ldx ];
+                }
+            }
+        } );
+
+        col_norms( S, 1, resnorms );
+        converged = true;
+        for (int64_t j = 0; j < k; ++j) {
+            if (! (resnorms[ j ] <= tol * Anorm)) {
+                converged = false;
+                break;
+            }
+        }
+        if (converged) {
+            iter = iiter;
+            break;
+        }
+        if (iiter == itermax)
+            break;
+
+        // Precondition and orthonormalize W; scaling columns first
+        // keeps the Gram matrix in cholqr well scaled.
+        if (precond)
+            precond( Ws );
+        normalize( S, 1, false );
+        cholqr( Ws, R, opts );
+        hemm( Side::Left, one, A, Ws, zero, AWs, opts );
+
+        // P is a difference of nearly equal vectors; normalizing it
+        // keeps the Gram matrix well conditioned.
+        if (iiter > 0)
+            normalize( S, 2, true );
+
+        rayleigh_ritz( iiter == 0 ? 2 : 3 );
+
+        // Restore orthonormality of X, lost by rounding in the update.
+        cholqr( Xs, R, opts );
+        trsm( Side::Right, one, R_U, AXs, opts );
+    }
+
+    if (! converged)
+        iter = -itermax - 1;
+
+    // Copy the first k columns of S to X.
+    Lambda.assign( theta.begin(), theta.begin() + k );
+    for_local_rows( [&]( int64_t i, int64_t row, int64_t mb ) {
+        scalar_t* Xi = data( S, i, 0 );
+        int64_t ldx = lda( S, i, 0 );
+        int64_t jj = 0;
+        for (int64_t j = 0; j < X1.nt(); ++j) {
+            auto T = X1( i, j );
+            lapack::lacpy( lapack::MatrixType::General, mb, T.nb(),
+                           &Xi[ jj*ldx ], ldx, T.data(), T.stride() );
+            jj += T.nb();
+        }
+    } );
+    redistribute( X1, X, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void lobpcg<float>(
+    HermitianMatrix<float>& A,
+    std::vector<float>& Lambda,
+    Matrix<float>& X,
+    int& iter,
+    std::function< void (Matrix<float>& R) > const& precond,
+    Options const& opts);
+
+template
+void lobpcg<double>(
+    HermitianMatrix<double>& A,
+    std::vector<double>& Lambda,
+    Matrix<double>& X,
+    int& iter,
+    std::function< void (Matrix<double>& R) > const& precond,
+    Options const& opts);
+
+template
+void lobpcg< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    std::vector<float>& Lambda,
+    Matrix< std::complex<float> >& X,
+    int& iter,
+    std::function< void (Matrix< std::complex<float> >& R) > const& precond,
+    Options const& opts);
+
+template
+void lobpcg< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    std::vector<double>& Lambda,
+    Matrix< std::complex<double> >& X,
+    int& iter,
+    std::function< void (Matrix< std::complex<double> >& R) > const& precond,
+    Options const& opts);
+
+} // namespace slate
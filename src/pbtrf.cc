@@ -130,6 +130,34 @@ void pbtrf(
     // Debug::printTilesMaps(A);
 }
 
+//------------------------------------------------------------------------------
+/// @internal
+/// pbtrf for a narrow band on one rank. Factors a temporary copy of the
+/// band in LAPACK-style compact storage, which holds kd+1 diagonals,
+/// then copies it back to A's tiles.
+/// Throws if A is not positive definite.
+///
+template <typename scalar_t>
+void pbtrf_compact(
+    HermitianBandMatrix<scalar_t>& A )
+{
+    int64_t n  = A.n();
+    int64_t kd = A.bandwidth();
+    int64_t kl = (A.uplo() == Uplo::Lower ? kd : 0);
+    int64_t ku = (A.uplo() == Uplo::Lower ? 0 : kd);
+    int64_t ldab = kd + 1;
+
+    std::vector<scalar_t> AB( ldab*n );
+    internal::copyband2lapack( A, kl, ku, AB.data(), ldab );
+    int64_t info = lapack::pbtrf( A.uplo(), n, kd, AB.data(), ldab );
+    internal::copylapack2band( AB.data(), ldab, kl, ku, A );
+    if (info != 0) {
+        throw Exception( "pbtrf: leading minor of order "
+                         + std::to_string( info )
+                         + " is not positive definite" );
+    }
+}
+
 } // namespace impl
 
 //------------------------------------------------------------------------------
@@ -179,6 +207,13 @@ void pbtrf(
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
+///     - Option::CompactBand:
+///       Single-rank shortcut: if A is on one rank and its band is at most
+///       a quarter of the tile size, factor a temporary copy of the band
+///       in LAPACK-style compact storage with LAPACK's pbtrf, which avoids
+///       the zeros in full tiles, but raises peak memory by the copy.
+///       Throws slate::Exception if A is not positive definite.
+///       Default false.
 ///
 /// TODO: return value
 /// @retval 0 successful exit
@@ -196,6 +231,11 @@ void pbtrf(
 {
     Target target = get_option( opts, Option::Target, Target::HostTask );
 
+    if (internal::use_compact_band( A, A.bandwidth(), 0, opts )) {
+        impl::pbtrf_compact( A );
+        return;
+    }
+
     switch (target) {
         case Target::Host:
         case Target::HostTask:
@@ -13,6 +13,35 @@
 
 namespace slate {
 
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// @internal
+/// pbtrs for a narrow band on one rank, using LAPACK-style compact band
+/// storage of the Cholesky factor.
+///
+template <typename scalar_t>
+void pbtrs_compact(
+    HermitianBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& B )
+{
+    int64_t n    = A.n();
+    int64_t nrhs = B.n();
+    int64_t kd = A.bandwidth();
+    int64_t kl = (A.uplo() == Uplo::Lower ? kd : 0);
+    int64_t ku = (A.uplo() == Uplo::Lower ? 0 : kd);
+    int64_t ldab = kd + 1;
+    int64_t ldb  = std::max( n, int64_t( 1 ) );
+
+    std::vector<scalar_t> AB( ldab*n ), Bdata( ldb*nrhs );
+    internal::copyband2lapack( A, kl, ku, AB.data(), ldab );
+    internal::copyge2lapack( B, Bdata.data(), ldb );
+    lapack::pbtrs( A.uplo(), n, kd, nrhs, AB.data(), ldab, Bdata.data(), ldb );
+    internal::copylapack2ge( Bdata.data(), ldb, B );
+}
+
+} // namespace impl
+
 //------------------------------------------------------------------------------
 /// Distributed parallel Cholesky solve.
 ///
@@ -47,6 +76,11 @@ namespace slate {
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
+///     - Option::CompactBand:
+///       Single-rank shortcut: if A and B are on one rank and the band of A
+///       is at most a quarter of the tile size, solve using a temporary copy
+///       of A in LAPACK-style compact band storage, which raises peak memory
+///       by the copy. Default false.
 ///
 /// @ingroup pbsv_computational
 ///
@@ -61,6 +95,12 @@ void pbtrs(HermitianBandMatrix<scalar_t>& A,
     // assert(A.mt() == A.nt());
     assert(B.mt() == A.mt());
 
+    if (internal::use_compact_band( A, A.bandwidth(), 0, opts )
+        && B.mpiSize() == 1 && B.op() == Op::NoTrans) {
+        impl::pbtrs_compact( A, B );
+        return;
+    }
+
     auto A_ = A;  // local shallow copy to transpose
 
     // if upper, change to lower
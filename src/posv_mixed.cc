@@ -115,6 +115,7 @@ void posv_mixed(
     const int itermax = 30;
     using real_hi = blas::real_type<scalar_hi>;
     const real_hi eps = std::numeric_limits<real_hi>::epsilon();
+    const scalar_hi zero_hi     = 0.0;
     const scalar_hi one_hi      = 1.0;
     iter = 0;
 
@@ -173,11 +174,10 @@ void posv_mixed(
     // Solve the system A_lo * X_lo = B_lo.
     potrs( A_lo, X_lo, opts );
 
-    // Convert X_lo to high precision.
-    copy( X_lo, X, opts );
+    // Convert X_lo to high precision, X = X_lo, and set R = B.
+    internal::iterRefUpdate( X_lo, zero_hi, X, B, R, opts );
 
     // Compute R = B - A * X.
-    slate::copy( B, R, opts );
     hemm<scalar_hi>(
         Side::Left,
         -one_hi, A,
@@ -186,8 +186,9 @@ void posv_mixed(
 
     // Check whether the nrhs normwise backward error satisfies the
     // stopping criterion. If yes, set iter=0 and return.
-    colNorms( Norm::Max, X, colnorms_X.data(), opts );
-    colNorms( Norm::Max, R, colnorms_R.data(), opts );
+    // Also converts R to low precision, storing the result in X_lo.
+    internal::iterRefColNorms(
+        X, R, X_lo, colnorms_X.data(), colnorms_R.data(), opts );
 
     if (internal::iterRefConverged<real_hi>( colnorms_R, colnorms_X, cte) ) {
         iter = 0;
@@ -196,31 +197,25 @@ void posv_mixed(
 
     // iterative refinement
     for (int iiter = 0; iiter < itermax && ! converged; ++iiter) {
-        // Convert R from high to low precision, store result in X_lo.
-        copy( R, X_lo, opts );
-
         // Solve the system A_lo * X_lo = R_lo.
         potrs( A_lo, X_lo, opts );
 
-        // Convert X_lo back to double precision and update the current iterate.
-        copy( X_lo, R, opts );
-        add<scalar_hi>(
-              one_hi, R,
-              one_hi, X, opts );
+        // Convert X_lo back to double precision and update the current
+        // iterate, X += X_lo, and set R = B.
+        internal::iterRefUpdate( X_lo, one_hi, X, B, R, opts );
 
         // Compute R = B - A * X.
-        slate::copy( B, R, opts );
         hemm<scalar_hi>(
             Side::Left,
             -one_hi, A,
                      X,
             one_hi,  R, opts );
 
-
         // Check whether nrhs normwise backward error satisfies the
         // stopping criterion. If yes, set iter = iiter > 0 and return.
-        colNorms( Norm::Max, X, colnorms_X.data(), opts );
-        colNorms( Norm::Max, R, colnorms_R.data(), opts );
+        // Also converts R to low precision, storing the result in X_lo.
+        internal::iterRefColNorms(
+            X, R, X_lo, colnorms_X.data(), colnorms_R.data(), opts );
 
         if (internal::iterRefConverged<real_hi>( colnorms_R, colnorms_X, cte )) {
             iter = iiter+1;
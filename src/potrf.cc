@@ -14,6 +14,215 @@ namespace slate {
 
 namespace impl {
 
+//------------------------------------------------------------------------------
+/// Distributed parallel 2.5D Cholesky factorization.
+/// Host implementation for HostTask, HostNest, HostBatch targets.
+///
+/// The MPI ranks are split into layers, rank r being in layer r % layers,
+/// and each layer holds a copy W_l of the lower triangle of A, distributed
+/// 2D block cyclic over its ranks and initially zero. The trailing update
+/// of step k is done by layer l = k % layers only, accumulating into W_l,
+/// so panel k is broadcast only to the ranks of layer l, on a grid with
+/// layers times fewer ranks. At step k, the layers' contributions to
+/// block column k are reduced into A(k:nt-1, k) before factoring it.
+/// This cuts the words sent per rank by about sqrt( layers ), for
+/// up to layers times the memory of the 2D algorithm. Column k of each W_l
+/// is freed once reduced, so that memory shrinks as the factorization
+/// proceeds. As in potrf, lookahead columns of W_l are updated first,
+/// so the next panel overlaps the trailing update.
+/// @ingroup posv_impl
+///
+template <Target target, typename scalar_t>
+void potrf_25d(
+    HermitianMatrix<scalar_t> A,
+    int layers,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+    using BcastListTag = typename Matrix<scalar_t>::BcastListTag;
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    // Assumes column major
+    const Layout layout = Layout::ColMajor;
+
+    // Options
+    int64_t lookahead = get_option<int64_t>( opts, Option::Lookahead, 1 );
+
+    int mpi_rank = A.mpiRank();
+    int64_t A_nt = A.nt();
+
+    // Near square grid of the ranks in each layer.
+    int layer_size = A.mpiSize() / layers;
+    int p = int( std::sqrt( double( layer_size ) ) );
+    while (layer_size % p != 0)
+        --p;
+
+    // Tile (i, j) of layer l, i >= j, is on rank l + layers*r, where r is
+    // its 2D block cyclic rank in the layer. The map is symmetric,
+    // so W_l has the same tiles as A whether A is upper or lower.
+    std::function<int64_t (int64_t j)> tileNb = [A]( int64_t j ) {
+        return A.tileNb( j );
+    };
+    std::function<int (ij_tuple ij)> tileDevice = []( ij_tuple ij ) {
+        return HostNum;
+    };
+    std::vector< HermitianMatrix<scalar_t> > W;
+    for (int l = 0; l < layers; ++l) {
+        std::function<int (ij_tuple ij)> tileRank
+            = [l, layers, p, layer_size]( ij_tuple ij ) {
+                int64_t i = std::max( std::get<0>( ij ), std::get<1>( ij ) );
+                int64_t j = std::min( std::get<0>( ij ), std::get<1>( ij ) );
+                return int( l + layers*((i % p) + (j % (layer_size / p))*p) );
+            };
+        W.push_back( HermitianMatrix<scalar_t>(
+            A.uplo(), A.n(), tileNb, tileRank, tileDevice, A.mpiComm() ) );
+        W[ l ].insertLocalTiles( Target::Host );
+        for (int64_t j = 0; j < A_nt; ++j) {
+            for (int64_t i = 0; i < A_nt; ++i) {
+                if (W[ l ].tileIsLocal( i, j ) && W[ l ].tileExists( i, j )) {
+                    // Zero the whole tile, as it is added to A's tile.
+                    auto Wij = W[ l ]( i, j );
+                    Wij.uplo( Uplo::General );
+                    Wij.set( zero );
+                }
+            }
+        }
+    }
+
+    // if upper, change to lower
+    if (A.uplo() == Uplo::Upper) {
+        A = conj_transpose( A );
+        for (auto& Wl : W)
+            Wl = conj_transpose( Wl );
+    }
+
+    // set min number for omp nested active parallel regions
+    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+
+    // OpenMP needs pointer types, but vectors are exception safe
+    std::vector< uint8_t > column_vector(A_nt);
+    uint8_t* column = column_vector.data();
+    SLATE_UNUSED( column ); // Used only by OpenMP
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        for (int64_t k = 0; k < A_nt; ++k) {
+            // panel, high priority
+            #pragma omp task depend(inout:column[k]) priority(1)
+            {
+                trace::Block trace_block( "task::panel", k );
+
+                // A(k:nt-1, k) += sum_l W_l(k:nt-1, k), with msg tag i.
+                // All ranks visit the pairs in the same order, so the
+                // blocking sends and receives match without deadlock.
+                // Column k of W_l isn't updated after step k-1, so its
+                // tiles are erased once added to A.
+                for (int64_t i = k; i < A_nt; ++i) {
+                    int dst = A.tileRank( i, k );
+                    for (auto& Wl : W) {
+                        int src = Wl.tileRank( i, k );
+                        if (src == mpi_rank && dst != mpi_rank) {
+                            Wl.tileSend( i, k, dst, i );
+                            Wl.tileErase( i, k );
+                        }
+                        else if (dst == mpi_rank) {
+                            Wl.tileRecv( i, k, src, layout, i );
+                            A.tileGetForWriting( i, k, LayoutConvert( layout ) );
+                            auto Aik = A( i, k );
+                            auto Wik = Wl( i, k );
+                            Aik.uplo( Uplo::General );
+                            Wik.uplo( Uplo::General );
+                            tile::add( one, Wik, Aik );
+                            if (src != mpi_rank)
+                                Wl.tileTick( i, k );
+                            else
+                                Wl.tileErase( i, k );
+                        }
+                    }
+                }
+
+                // factor A(k, k)
+                internal::potrf<Target::HostTask>( A.sub( k, k ), 1 );
+
+                // send A(k, k) down col A(k+1:nt-1, k)
+                if (k+1 <= A_nt-1)
+                    A.tileBcast( k, k, A.sub( k+1, A_nt-1, k, k ), layout );
+
+                // A(k+1:nt-1, k) * A(k, k)^{-H}
+                if (k+1 <= A_nt-1) {
+                    auto Akk = A.sub( k, k );
+                    auto Tkk = TriangularMatrix< scalar_t >( Diag::NonUnit, Akk );
+                    internal::trsm<Target::HostTask>(
+                        Side::Right,
+                        one, conj_transpose( Tkk ),
+                        A.sub( k+1, A_nt-1, k, k ), 1 );
+                }
+
+                // Step k updates layer l = k % layers only.
+                auto& Wl = W[ k % layers ];
+
+                BcastListTag bcast_list_A;
+                for (int64_t i = k+1; i < A_nt; ++i) {
+                    // send A(i, k) across row W_l(i, k+1:i) and down
+                    // col W_l(i:nt-1, i) with msg tag i
+                    bcast_list_A.push_back( {i, k, {Wl.sub( i, i, k+1, i ),
+                                                    Wl.sub( i, A_nt-1, i, i )},
+                                             i} );
+                }
+                A.template listBcastMT( bcast_list_A, layout );
+            }
+            // update lookahead column(s) of W_l, high priority
+            for (int64_t j = k+1; j < k+1+lookahead && j < A_nt; ++j) {
+                #pragma omp task depend(in:column[k]) \
+                                 depend(inout:column[j]) priority(1)
+                {
+                    trace::Block trace_block( "task::lookahead", k );
+                    auto& Wl = W[ k % layers ];
+
+                    // W_l(j, j) -= A(j, k) * A(j, k)^H
+                    internal::herk<Target::HostTask>(
+                        real_t(-1.0), A.sub( j, j, k, k ),
+                        real_t( 1.0), Wl.sub( j, j ), 1 );
+
+                    // W_l(j+1:nt-1, j) -= A(j+1:nt-1, k) * A(j, k)^H
+                    if (j+1 <= A_nt-1) {
+                        auto Ajk = A.sub( j, j, k, k );
+                        internal::gemm<Target::HostTask>(
+                            -one, A.sub( j+1, A_nt-1, k, k ),
+                                  conj_transpose( Ajk ),
+                            one,  Wl.sub( j+1, A_nt-1, j, j ),
+                            layout, 1, 0, opts );
+                    }
+                }
+            }
+            // update trailing submatrix of W_l, normal priority
+            if (k+1+lookahead < A_nt) {
+                #pragma omp task depend(in:column[k]) \
+                                 depend(inout:column[k+1+lookahead]) \
+                                 depend(inout:column[A_nt-1])
+                {
+                    trace::Block trace_block( "task::trailing", k );
+                    auto& Wl = W[ k % layers ];
+
+                    // W_l(kl+1:nt-1, kl+1:nt-1) -=
+                    //     A(kl+1:nt-1, k) * A(kl+1:nt-1, k)^H
+                    // where kl = k + lookahead
+                    internal::herk<target>(
+                        real_t(-1.0), A.sub( k+1+lookahead, A_nt-1, k, k ),
+                        real_t( 1.0), Wl.sub( k+1+lookahead, A_nt-1 ) );
+                }
+            }
+        }
+    }
+
+    A.tileUpdateAllOrigin();
+    A.releaseWorkspace();
+}
+
 //------------------------------------------------------------------------------
 /// Distributed parallel Cholesky factorization.
 /// Generic implementation for any target.
@@ -36,6 +245,18 @@ void potrf(
 
     // Options
     int64_t lookahead = get_option<int64_t>( opts, Option::Lookahead, 1 );
+    int64_t replication = get_option<int64_t>( opts, Option::Replication, 1 );
+
+    // Use the largest number of layers <= replication that divides
+    // the number of ranks.
+    int layers = std::max( int64_t( 1 ),
+                           std::min( replication, int64_t( A.mpiSize() ) ) );
+    while (A.mpiSize() % layers != 0)
+        --layers;
+    if (layers > 1) {
+        potrf_25d<target>( A, layers, opts );
+        return;
+    }
 
     // if upper, change to lower
     if (A.uplo() == Uplo::Upper) {
@@ -43,6 +264,9 @@ void potrf(
     }
     int64_t A_nt = A.nt();
 
+    // With a single rank, all tiles are local, so skip the broadcasts.
+    bool is_comm = A.mpiSize() > 1;
+
     // OpenMP needs pointer types, but vectors are exception safe
     std::vector< uint8_t > column_vector(A_nt);
     uint8_t* column = column_vector.data();
@@ -58,11 +282,13 @@ void potrf(
             // panel, high priority
             #pragma omp task depend(inout:column[k]) priority(1)
             {
+                trace::Block trace_block( "task::panel", k );
+
                 // factor A(k, k)
                 internal::potrf<Target::HostTask>(A.sub(k, k), 1);
 
                 // send A(k, k) down col A(k+1:nt-1, k)
-                if (k+1 <= A_nt-1)
+                if (is_comm && k+1 <= A_nt-1)
                     A.tileBcast(k, k, A.sub(k+1, A_nt-1, k, k), layout);
 
                 // A(k+1:nt-1, k) * A(k, k)^{-H}
@@ -75,21 +301,25 @@ void potrf(
                         A.sub(k+1, A_nt-1, k, k), 1);
                 }
 
-                BcastListTag bcast_list_A;
-                for (int64_t i = k+1; i < A_nt; ++i) {
-                    // send A(i, k) across row A(i, k+1:i) and down
-                    // col A(i:nt-1, i) with msg tag i
-                    bcast_list_A.push_back({i, k, {A.sub(i, i, k+1, i),
-                                                   A.sub(i, A_nt-1, i, i)},
-                                            i});
+                if (is_comm) {
+                    BcastListTag bcast_list_A;
+                    for (int64_t i = k+1; i < A_nt; ++i) {
+                        // send A(i, k) across row A(i, k+1:i) and down
+                        // col A(i:nt-1, i) with msg tag i
+                        bcast_list_A.push_back({i, k, {A.sub(i, i, k+1, i),
+                                                       A.sub(i, A_nt-1, i, i)},
+                                                i});
+                    }
+                    A.template listBcastMT(bcast_list_A, layout);
                 }
-                A.template listBcastMT(bcast_list_A, layout);
             }
             // update lookahead column(s), high priority
             for (int64_t j = k+1; j < k+1+lookahead && j < A_nt; ++j) {
                 #pragma omp task depend(in:column[k]) \
                                  depend(inout:column[j]) priority(1)
                 {
+                    trace::Block trace_block( "task::lookahead", k );
+
                     // A(j, j) -= A(j, k) * A(j, k)^H
                     internal::herk<Target::HostTask>(
                         real_t(-1.0), A.sub(j, j, k, k),
@@ -102,7 +332,7 @@ void potrf(
                             -one, A.sub(j+1, A_nt-1, k, k),
                                   conj_transpose( Ajk ),
                             one,  A.sub(j+1, A_nt-1, j, j),
-                            layout, 1);
+                            layout, 1, 0, opts );
                     }
                 }
             }
@@ -112,12 +342,15 @@ void potrf(
                                  depend(inout:column[k+1+lookahead]) \
                                  depend(inout:column[A_nt-1])
                 {
+                    trace::Block trace_block( "task::trailing", k );
+
                     // A(kl+1:nt-1, kl+1:nt-1) -=
                     //     A(kl+1:nt-1, k) * A(kl+1:nt-1, k)^H
                     // where kl = k + lookahead
                     internal::herk<target>(
                         real_t(-1.0), A.sub(k+1+lookahead, A_nt-1, k, k),
-                        real_t( 1.0), A.sub(k+1+lookahead, A_nt-1));
+                        real_t( 1.0), A.sub(k+1+lookahead, A_nt-1),
+                        0, 0, layout, opts );
                 }
             }
         }
@@ -356,6 +589,18 @@ void potrf(
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
+///     - Option::TileAffinity:
+///       With HostTask, on multi-socket nodes, update each tile preferably
+///       from threads on the NUMA node holding it. Default true.
+///     - Option::Gemm3M:
+///       Experimental. For complex types with HostTask, update off-diagonal
+///       tiles using the 3M algorithm, 3 real gemms instead of 4.
+///       Default false.
+///     - Option::Replication:
+///       Number of layers c for the 2.5D algorithm, which keeps c copies
+///       of the trailing matrix to send about sqrt( c ) times fewer words.
+///       Reduced to the largest divisor of the number of ranks <= c.
+///       Host targets only. Default 1, the 2D algorithm.
 ///
 /// TODO: return value
 /// @retval 0 successful exit
@@ -9,6 +9,9 @@
 #include "slate/Matrix.hh"
 #include "internal/internal.hh"
 
+#include <algorithm>
+#include <map>
+
 namespace slate {
 
 //------------------------------------------------------------------------------
@@ -124,6 +127,186 @@ void redistribute(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Redistribute a matrix A into matrix B, where A and B are on different,
+/// possibly overlapping, communicators and process grids.
+/// This allows, for instance, handing a matrix from a solver phase on a
+/// large grid to a post-processing phase on a smaller sub-grid.
+///
+/// Every rank of the parent communicator must call redistribute.
+/// A rank that is not in A's communicator passes an empty matrix for A,
+/// e.g., `Matrix<scalar_t>()`; likewise for B.
+/// A and B must have the same dimensions and tile sizes.
+///
+/// Tile sizes are checked, and tile ownership is exchanged, with
+/// all-reduces over the parent communicator. Then each rank packs all its
+/// tiles going to the same destination into one message, and all messages
+/// are exchanged with non-blocking point-to-point communication.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     On ranks in A's communicator, the m-by-n source matrix, not
+///     transposed. On other ranks, an empty matrix.
+///
+/// @param[in,out] B
+///     On ranks in B's communicator, the m-by-n destination matrix,
+///     not transposed. On other ranks, an empty matrix.
+///     On exit, B = A.
+///
+/// @param[in] comm
+///     Parent communicator, which includes all ranks of A's and B's
+///     communicators.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently none.
+///
+/// @ingroup copy
+///
+template <typename scalar_t>
+void redistribute(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    MPI_Comm comm,
+    Options const& opts )
+{
+    trace::Block trace_block("slate::redistribute");
+
+    const auto mpi_scalar_type = mpi_type<scalar_t>::value;
+    const int tag = 0;
+
+    int comm_rank;
+    slate_mpi_call(
+        MPI_Comm_rank(comm, &comm_rank));
+
+    bool has_A = A.mt() > 0 && A.nt() > 0;
+    bool has_B = B.mt() > 0 && B.nt() > 0;
+    slate_error_if( has_A && A.op() != Op::NoTrans );
+    slate_error_if( has_B && B.op() != Op::NoTrans );
+
+    // Agree on the number of tiles.
+    int64_t dims[ 4 ] = {
+        has_A ? A.mt() : 0, has_A ? A.nt() : 0,
+        has_B ? B.mt() : 0, has_B ? B.nt() : 0 };
+    slate_mpi_call(
+        MPI_Allreduce(MPI_IN_PLACE, dims, 4, MPI_INT64_T, MPI_MAX, comm));
+    int64_t mt = dims[ 0 ];
+    int64_t nt = dims[ 1 ];
+    slate_error_if( dims[ 2 ] != mt || dims[ 3 ] != nt );
+    slate_error_if( has_A && (A.mt() != mt || A.nt() != nt) );
+    slate_error_if( has_B && (B.mt() != mt || B.nt() != nt) );
+    if (mt == 0 || nt == 0)
+        return;
+
+    // Agree on the tile sizes, since matrices with the same number of tiles
+    // can still be tiled differently.
+    std::vector<int64_t> sizes( 2*(mt + nt), 0 );
+    int64_t* sizes_A = &sizes[ 0 ];
+    int64_t* sizes_B = &sizes[ mt + nt ];
+    for (int64_t i = 0; i < mt; ++i) {
+        sizes_A[ i ] = has_A ? A.tileMb( i ) : 0;
+        sizes_B[ i ] = has_B ? B.tileMb( i ) : 0;
+    }
+    for (int64_t j = 0; j < nt; ++j) {
+        sizes_A[ mt + j ] = has_A ? A.tileNb( j ) : 0;
+        sizes_B[ mt + j ] = has_B ? B.tileNb( j ) : 0;
+    }
+    slate_mpi_call(
+        MPI_Allreduce(MPI_IN_PLACE, sizes.data(), sizes.size(), MPI_INT64_T,
+                      MPI_MAX, comm));
+    // All ranks see the same sizes, so all ranks throw or none do.
+    slate_error_if( ! std::equal( sizes_A, sizes_A + mt + nt, sizes_B ) );
+
+    // Owners of tiles of A and B, as ranks in the parent communicator.
+    int64_t ntiles = mt*nt;
+    std::vector<int> owner( 2*ntiles, -1 );
+    int* owner_A = &owner[ 0 ];
+    int* owner_B = &owner[ ntiles ];
+    for (int64_t j = 0; j < nt; ++j) {
+        for (int64_t i = 0; i < mt; ++i) {
+            if (has_A && A.tileIsLocal( i, j ))
+                owner_A[ i + j*mt ] = comm_rank;
+            if (has_B && B.tileIsLocal( i, j ))
+                owner_B[ i + j*mt ] = comm_rank;
+        }
+    }
+    slate_mpi_call(
+        MPI_Allreduce(MPI_IN_PLACE, owner.data(), owner.size(), MPI_INT,
+                      MPI_MAX, comm));
+
+    // Copy local tiles, pack tiles to send, and count elements to receive,
+    // per rank.
+    std::map< int, std::vector<scalar_t> > send_buf, recv_buf;
+    for (int64_t j = 0; j < nt; ++j) {
+        for (int64_t i = 0; i < mt; ++i) {
+            int src = owner_A[ i + j*mt ];
+            int dst = owner_B[ i + j*mt ];
+            if (src == comm_rank) {
+                A.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                auto Aij = A( i, j );
+                if (dst == comm_rank) {
+                    B.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                    auto Bij = B( i, j );
+                    if (Aij.data() != Bij.data())
+                        tile::gecopy( Aij, Bij );
+                }
+                else {
+                    auto& buf = send_buf[ dst ];
+                    size_t offset = buf.size();
+                    buf.resize( offset + Aij.mb()*Aij.nb() );
+                    lapack::lacpy( lapack::MatrixType::General,
+                                   Aij.mb(), Aij.nb(),
+                                   Aij.data(), Aij.stride(),
+                                   &buf[ offset ], Aij.mb() );
+                }
+            }
+            else if (dst == comm_rank) {
+                auto& buf = recv_buf[ src ];
+                buf.resize( buf.size() + B.tileMb( i )*B.tileNb( j ) );
+            }
+        }
+    }
+
+    // Exchange one aggregated message per pair of ranks.
+    std::vector<MPI_Request> requests;
+    requests.reserve( send_buf.size() + recv_buf.size() );
+    for (auto& [src, buf] : recv_buf) {
+        requests.emplace_back();
+        slate_mpi_call(
+            MPI_Irecv(buf.data(), buf.size(), mpi_scalar_type, src, tag,
+                      comm, &requests.back()));
+    }
+    for (auto& [dst, buf] : send_buf) {
+        requests.emplace_back();
+        slate_mpi_call(
+            MPI_Isend(buf.data(), buf.size(), mpi_scalar_type, dst, tag,
+                      comm, &requests.back()));
+    }
+    slate_mpi_call(
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE));
+
+    // Unpack received tiles, in the same order they were packed.
+    std::map< int, size_t > recv_offset;
+    for (int64_t j = 0; j < nt; ++j) {
+        for (int64_t i = 0; i < mt; ++i) {
+            int src = owner_A[ i + j*mt ];
+            int dst = owner_B[ i + j*mt ];
+            if (dst == comm_rank && src != comm_rank) {
+                B.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                auto Bij = B( i, j );
+                size_t& offset = recv_offset[ src ];
+                lapack::lacpy( lapack::MatrixType::General,
+                               Bij.mb(), Bij.nb(),
+                               &recv_buf[ src ][ offset ], Bij.mb(),
+                               Bij.data(), Bij.stride() );
+                offset += Bij.mb()*Bij.nb();
+            }
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 // ----------------------------------------
@@ -151,4 +334,33 @@ void redistribute< std::complex<double> >(
     Matrix< std::complex<double> >& B,
     Options const& opts);
 
+// ----------------------------------------
+template
+void redistribute<float>(
+    Matrix<float>& A,
+    Matrix<float>& B,
+    MPI_Comm comm,
+    Options const& opts);
+
+template
+void redistribute<double>(
+    Matrix<double>& A,
+    Matrix<double>& B,
+    MPI_Comm comm,
+    Options const& opts);
+
+template
+void redistribute< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    MPI_Comm comm,
+    Options const& opts);
+
+template
+void redistribute< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    MPI_Comm comm,
+    Options const& opts);
+
 } // namespace slate
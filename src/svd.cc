@@ -9,6 +9,9 @@
 #include "slate/Tile_blas.hh"
 #include "slate/TriangularBandMatrix.hh"
 #include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+#include <lapack/flops.hh>
 
 namespace slate {
 
@@ -20,6 +23,9 @@ namespace slate {
 /// First stage: reduction to upper band bidiagonal form (see ge2tb);
 /// Second stage: reduction from band to bidiagonal form (see tb2bd).
 ///
+/// If timers::Timers is on, the time of each phase is recorded as
+/// "svd::ge2tb", "svd::tb2bd", etc.
+///
 //------------------------------------------------------------------------------
 /// @tparam scalar_t
 ///         One of float, double, std::complex<float>, std::complex<double>.
@@ -77,6 +83,7 @@ void svd(
     const scalar_t zero = 0;
     const scalar_t one  = 1;
     const real_t r_zero = 0.;
+    const real_t r_one  = 1.;
     const int64_t izero = 0;
     const int64_t ione  = 1;
 
@@ -142,7 +149,9 @@ void svd(
     Matrix<scalar_t> Ahat, Uhat, VThat;
     TriangularFactors<scalar_t> TQ;
     if (qr_path) {
+        timers::Phase t_geqrf( "svd::geqrf" );
         geqrf( A, TQ, opts );
+        t_geqrf.stop( lapack::Gflop<scalar_t>::geqrf( m, n ) );
 
         // Upper triangular part of A (R).
         auto R_ = A.slice(0, n-1, 0, n-1);
@@ -166,7 +175,9 @@ void svd(
         }
     }
     else if (lq_path) {
+        timers::Phase t_gelqf( "svd::gelqf" );
         gelqf( A, TQ, opts );
+        t_gelqf.stop( lapack::Gflop<scalar_t>::gelqf( m, n ) );
         swap(m, n);
 
         // Lower triangular part of A (R).
@@ -203,8 +214,10 @@ void svd(
     }
 
     // 1. Reduce to band form.
+    timers::Phase t_ge2tb( "svd::ge2tb" );
     TriangularFactors<scalar_t> TU, TV;
     ge2tb(Ahat, TU, TV, opts);
+    t_ge2tb.stop( lapack::Gflop<scalar_t>::gebrd( Ahat.m(), Ahat.n() ) );
 
     // Currently, tb2bd and bdsqr run on a single node, gathers band matrix to rank 0.
     TriangularBandMatrix<scalar_t> Aband( Uplo::Upper, Diag::NonUnit,
@@ -213,8 +226,10 @@ void svd(
     Aband.insertLocalTiles();
 
     // Slice Ahat here in case if A is rectangular but does not require qr_path.
+    timers::Phase t_gather( "svd::ge2tbGather" );
     auto Ahat_ = Ahat.slice( 0, Ahat.n()-1, 0, Ahat.n()-1 );
     Aband.ge2tbGather(Ahat_);
+    t_gather.stop( 0, 1e-9 * n * (A.tileNb(0) + 1) * sizeof(scalar_t) );
 
     // Allocate U2 and VT2 matrices for tb2bd.
     int64_t nb = Ahat.tileNb(0);
@@ -236,7 +251,9 @@ void svd(
         U2.insertLocalTiles();
 
         // Reduce band to bi-diagonal.
+        timers::Phase t_tb2bd( "svd::tb2bd" );
         tb2bd( Aband, U2, VT2, opts );
+        t_tb2bd.stop();
 
         // Copy diagonal and super-diagonal to vectors.
         internal::copytb2bd(Aband, Sigma, E);
@@ -258,7 +275,14 @@ void svd(
         MPI_Bcast( &Sigma[0], min_mn,   mpi_real_type, 0, A.mpiComm() );
         MPI_Bcast( &E[0], min_mn-1, mpi_real_type, 0, A.mpiComm() );
 
-        // Build the 1-dim distributed U and VT needed for bdsqr
+        // Build the 1-dim distributed U and VT needed for bdsqr.
+        // bdsqr applies only real rotations, so in the complex case,
+        // compute real vectors in their storage, viewed as real, with
+        // real bdsqr, then widen them in place to complex.
+        // Without U or VT, bdsqr gets the dummy with nru or ncvt = 0.
+        real_t r_dummy[1];
+        real_t* U1D_row_cyclic_real  = r_dummy;
+        real_t* VT1D_row_cyclic_real = r_dummy;
         slate::Matrix<scalar_t> U1d_row_cyclic, V1d;
         if (wantu) {
             int64_t m_U = Uhat.m();
@@ -266,28 +290,46 @@ void svd(
             nru  = numberLocalRowOrCol(m_U, nb, myrow, izero, mpi_size);
             ldu = max( 1, nru );
             U1D_row_cyclic_data.resize(ldu*min_mn);
+            U1D_row_cyclic_real
+                = reinterpret_cast<real_t*>( U1D_row_cyclic_data.data() );
             U1d_row_cyclic = slate::Matrix<scalar_t>::fromScaLAPACK(
                     m_U, min_mn, &U1D_row_cyclic_data[0], ldu, nb, mpi_size, 1, U.mpiComm() );
-            set( zero, one, U1d_row_cyclic, opts );
+            auto U1d_real = slate::Matrix<real_t>::fromScaLAPACK(
+                    m_U, min_mn, U1D_row_cyclic_real, ldu, nb, mpi_size, 1, U.mpiComm() );
+            set( r_zero, r_one, U1d_real, opts );
         }
         if (wantvt) {
             mycol = VThat.mpiRank();
             ncvt = numberLocalRowOrCol(n, nb, mycol, izero, mpi_size);
             ldvt = max( 1, min_mn );
             VT1D_row_cyclic_data.resize(ldvt*ncvt);
+            VT1D_row_cyclic_real
+                = reinterpret_cast<real_t*>( VT1D_row_cyclic_data.data() );
             V1d = slate::Matrix<scalar_t>::fromScaLAPACK(
                     min_mn, n, &VT1D_row_cyclic_data[0], ldvt, nb, 1, mpi_size, VT.mpiComm() );
-            set( zero, one, V1d, opts );
+            auto V1d_real = slate::Matrix<real_t>::fromScaLAPACK(
+                    min_mn, n, VT1D_row_cyclic_real, ldvt, nb, 1, mpi_size, VT.mpiComm() );
+            set( r_zero, r_one, V1d_real, opts );
         }
 
         // QR iteration
         //bdsqr<scalar_t>(jobu, jobvt, Sigma, E, Uhat, VThat, opts);
         // Call the SVD
+        timers::Phase t_bdsqr( "svd::bdsqr" );
         lapack::bdsqr(Uplo::Upper, min_mn, ncvt, nru, 0,
                       &Sigma[0], &E[0],
-                      &VT1D_row_cyclic_data[0], ldvt,
-                      &U1D_row_cyclic_data[0], ldu,
-                      dummy, 1);
+                      VT1D_row_cyclic_real, ldvt,
+                      U1D_row_cyclic_real, ldu,
+                      r_dummy, 1);
+        if (wantu) {
+            internal::real2complex_inplace(
+                ldu*min_mn, &U1D_row_cyclic_data[0] );
+        }
+        if (wantvt) {
+            internal::real2complex_inplace(
+                ldvt*ncvt, &VT1D_row_cyclic_data[0] );
+        }
+        t_bdsqr.stop();
 
         // If matrix was scaled, then rescale singular values appropriately.
         if (is_scale) {
@@ -312,21 +354,36 @@ void svd(
                 Uhat.m(), Uhat.n(), Uhat.tileNb(0), 1, mpi_size, Uhat.mpiComm() );
             U1d.insertLocalTiles(target);
 
+            double U_gbyte = 1e-9 * Uhat.m() * Uhat.n() * sizeof(scalar_t);
+            double U_gflop = lapack::Gflop<scalar_t>::unmqr(
+                lapack::Side::Left, Uhat.m(), Uhat.n(), Uhat.m() );
+
             // Redistribute U into 1-D U1d
+            timers::Phase t_redist1( "svd::redistribute" );
             redistribute(U1d_row_cyclic, U1d, opts);
+            t_redist1.stop( 0, U_gbyte );
 
             // First, U = U2 * U ===> U1d = U2 * U1d
+            timers::Phase t_unmtr_hb2st( "svd::unmtr_hb2st" );
             unmtr_hb2st( Side::Left, Op::NoTrans, U2, U1d, opts );
+            t_unmtr_hb2st.stop( U_gflop );
 
             // Redistribute U1d into U
+            timers::Phase t_redist2( "svd::redistribute" );
             redistribute(U1d, Uhat, opts);
+            t_redist2.stop( 0, U_gbyte );
 
             // Second, U = U1 * U ===> U = Ahat * U
+            timers::Phase t_unmbr( "svd::unmbr_ge2tb" );
             unmbr_ge2tb( Side::Left, Op::NoTrans, Ahat, TU, Uhat, opts );
+            t_unmbr.stop( U_gflop );
             if (qr_path) {
                 // When initial QR was used.
                 // U = Q*U;
+                timers::Phase t_unmqr( "svd::unmqr" );
                 unmqr( Side::Left, slate::Op::NoTrans, A, TQ, U, opts );
+                t_unmqr.stop( lapack::Gflop<scalar_t>::unmqr(
+                    lapack::Side::Left, U.m(), U.n(), n ) );
             }
         }
 
@@ -344,24 +401,39 @@ void svd(
             //Matrix<scalar_t> V1d(VThat.m(), VThat.n(), VThat.tileNb(0), 1, mpi_size, VThat.mpiComm());
             //V1d.insertLocalTiles(target);
 
+            double V_gbyte = 1e-9 * VThat.m() * VThat.n() * sizeof(scalar_t);
+            double V_gflop = lapack::Gflop<scalar_t>::unmqr(
+                lapack::Side::Right, VThat.m(), VThat.n(), VThat.n() );
+
+            timers::Phase t_redist1( "svd::redistribute" );
             redistribute(V1d, VThat, opts);
             auto V = conj_transpose(VThat);
 
             // Redistribute V into 1-D V1d
             redistribute(V, V1d, opts);
+            t_redist1.stop( 0, 2*V_gbyte );
 
             // First: V  = VT2 * V ===> V1d = VT2 * V1d
+            timers::Phase t_unmtr_hb2st( "svd::unmtr_hb2st" );
             unmtr_hb2st( Side::Left, Op::NoTrans, VT2, V1d, opts );
+            t_unmtr_hb2st.stop( V_gflop );
 
             // Redistribute V1d into V
+            timers::Phase t_redist2( "svd::redistribute" );
             auto V1dT = conj_transpose(V1d);
             redistribute(V1dT, VThat, opts);
+            t_redist2.stop( 0, V_gbyte );
 
             // Second: VT = VT1 * VT ===> VT = Ahat * VT
+            timers::Phase t_unmbr( "svd::unmbr_ge2tb" );
             unmbr_ge2tb( Side::Right, Op::NoTrans, Ahat, TV, VThat, opts );
+            t_unmbr.stop( V_gflop );
             if (lq_path) {
                 // VT = VT*Q;
+                timers::Phase t_unmlq( "svd::unmlq" );
                 unmlq( Side::Right, slate::Op::NoTrans, A, TQ, VT, opts );
+                t_unmlq.stop( lapack::Gflop<scalar_t>::unmlq(
+                    lapack::Side::Right, VT.m(), VT.n(), n ) );
             }
         }
     }
@@ -369,6 +441,7 @@ void svd(
         if (A.mpiRank() == 0) {
             // QR iteration
             //bdsqr<scalar_t>(jobu, jobvt, Sigma, E, U, VT, opts);
+            timers::Phase t_bdsqr( "svd::bdsqr" );
             lapack::bdsqr(Uplo::Upper, min_mn, ncvt, nru, 0,
                           &Sigma[0], &E[0],
                           &VT1D_row_cyclic_data[0], ldvt,
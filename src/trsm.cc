@@ -56,6 +56,12 @@ namespace slate {
 ///           - Auto: let the routine decides [default]
 ///           - trsmA: select trsmA routine
 ///           - trsmB: select trsmB routine
+///           - trsmInv: select trsmB routine, precomputing inverses of
+///             the diagonal tiles of A in parallel (trtri), so the diagonal
+///             solves become triangular multiplies. This shortens the
+///             critical path for many right-hand sides, but the error
+///             grows with the condition numbers of the diagonal tiles,
+///             so it is not backward stable for ill-conditioned tiles.
 ///         - Option::Target:
 ///           Implementation to target. Possible values:
 ///           - HostTask:  OpenMP tasks on CPU host [default].
@@ -82,6 +88,7 @@ void trsm(blas::Side side,
             trsmA( side, alpha, A, B, opts );
             break;
         case MethodTrsm::TrsmB:
+        case MethodTrsm::TrsmInv:
             trsmB( side, alpha, A, B, opts );
             break;
     }
@@ -120,6 +120,10 @@ void trsmA(
 ///         - Option::Lookahead:
 ///           Number of panels to overlap with matrix updates.
 ///           lookahead >= 0. Default 1.
+///         - Option::MethodReduce:
+///           Algorithm to sum partial B tiles across process rows.
+///           Possible values: Auto [default], Binomial, ReduceScatter,
+///           Pipelined. See MethodReduce.
 ///         - Option::Target:
 ///           Implementation to target. Possible values:
 ///           - HostTask:  OpenMP tasks on CPU host [default].
@@ -0,0 +1,231 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "slate/Tile_blas.hh"
+#include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel multiply by the unitary matrix Q from gehrd:
+/// overwrites the general m-by-n matrix C with
+///
+///     side = Left,  op = NoTrans:    $Q C$
+///     side = Left,  op = ConjTrans:  $Q^H C$
+///     side = Right, op = NoTrans:    $C Q$
+///     side = Right, op = ConjTrans:  $C Q^H$
+///
+/// For each block of nb reflectors, V and T are formed on all ranks
+/// from the replicated tile column of A, as in LAPACK larft;
+/// each rank then applies the block reflector to its local tiles of C
+/// after an all-reduce of $V^H C$ or $C V$.
+///
+/// ATTENTION: only host computation supported for now.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///         One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] side
+///         - Side::Left:  apply $Q$ or $Q^H$ from the left;
+///         - Side::Right: apply $Q$ or $Q^H$ from the right.
+///
+/// @param[in] op
+///         - Op::NoTrans:   apply $Q$;
+///         - Op::ConjTrans: apply $Q^H$;
+///         - Op::Trans:     apply $Q^T$ (only if real).
+///
+/// @param[in] A
+///         The n-by-n matrix A, as returned by gehrd.
+///         If side = Left, n = C.m(); if side = Right, n = C.n().
+///
+/// @param[in] tau
+///         The vector tau of length n-1, as returned by gehrd.
+///
+/// @param[in,out] C
+///         On entry, the m-by-n matrix $C$.
+///         On exit, C is overwritten by $Q C$, $Q^H C$, $C Q$, or $C Q^H$.
+///
+/// @param[in] opts
+///         Additional options, as map of name = value pairs. Currently none.
+///
+/// @ingroup geev_computational
+///
+template <typename scalar_t>
+void unmhr(
+    Side side, Op op,
+    Matrix<scalar_t>& A,
+    std::vector<scalar_t>& tau,
+    Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    trace::Block trace_block("slate::unmhr");
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const Layout layout = Layout::ColMajor;
+    const auto mpi_scalar_type = mpi_type<scalar_t>::value;
+
+    slate_error_if( op == Op::Trans && is_complex<scalar_t>::value );
+    if (op == Op::Trans)
+        op = Op::ConjTrans;
+
+    bool left = side == Side::Left;
+    int64_t n = A.n();
+    int64_t nt = A.nt();
+    slate_error_if( (left ? C.m() : C.n()) != n );
+    slate_error_if( C.op() != Op::NoTrans );
+
+    // Global offsets of tiles of A, and of the rows and columns of C.
+    std::vector<int64_t> offset( nt+1, 0 );
+    for (int64_t j = 0; j < nt; ++j)
+        offset[ j+1 ] = offset[ j ] + A.tileNb( j );
+    std::vector<int64_t> row_offset( C.mt()+1, 0 );
+    for (int64_t i = 0; i < C.mt(); ++i)
+        row_offset[ i+1 ] = row_offset[ i ] + C.tileMb( i );
+    std::vector<int64_t> col_offset( C.nt()+1, 0 );
+    for (int64_t j = 0; j < C.nt(); ++j)
+        col_offset[ j+1 ] = col_offset[ j ] + C.tileNb( j );
+
+    // Local tiles of C, as (i, j, tile).
+    struct LocalTile {
+        int64_t i, j;
+        Tile<scalar_t> tile;
+    };
+    std::vector<LocalTile> local;
+    for (int64_t j = 0; j < C.nt(); ++j) {
+        for (int64_t i = 0; i < C.mt(); ++i) {
+            if (C.tileIsLocal( i, j )) {
+                C.tileGetForWriting( i, j, LayoutConvert( layout ) );
+                local.push_back( { i, j, C( i, j ) } );
+            }
+        }
+    }
+
+    // Number of blocks of reflectors, which start in tile columns of A.
+    int64_t nblocks = 0;
+    while (nblocks < nt && offset[ nblocks ] < n-1)
+        ++nblocks;
+
+    // Q = B_0 B_1 ... B_last, with block reflectors B_k = I - V T V^H.
+    // Q C and C Q^H apply the blocks backward; Q^H C and C Q, forward.
+    bool forward = (left == (op == Op::ConjTrans));
+    Op opT = left ? op : (op == Op::NoTrans ? Op::ConjTrans : Op::NoTrans);
+
+    std::vector<scalar_t> P, V, T, W;
+    int64_t wn = left ? C.n() : C.m();
+
+    for (int64_t step = 0; step < nblocks; ++step) {
+        int64_t k = forward ? step : nblocks-1 - step;
+        int64_t c0 = offset[ k ];
+        int64_t ib = std::min( A.tileNb( k ), n-1 - c0 );
+
+        internal::gatherTileColumn( A, k, offset, P );
+
+        // Explicit V, n-by-ib, with zeros above and ones on its "diagonal".
+        V.assign( n*ib, zero );
+        for (int64_t j = 0; j < ib; ++j) {
+            int64_t r = c0 + j + 1;
+            V[ r + j*n ] = one;
+            blas::copy( n-r-1, &P[ r+1 + j*n ], 1, &V[ r+1 + j*n ], 1 );
+        }
+        T.assign( ib*ib, zero );
+        lapack::larft( lapack::Direction::Forward, lapack::StoreV::Columnwise,
+                       n-c0-1, ib, &V[ c0+1 ], n, &tau[ c0 ], &T[ 0 ], ib );
+
+        W.assign( ib*wn, zero );
+        if (left) {
+            // W = V^H C, ib-by-C.n().
+            for (auto& t : local) {
+                blas::gemm( layout, Op::ConjTrans, Op::NoTrans,
+                            ib, t.tile.nb(), t.tile.mb(),
+                            one, &V[ row_offset[ t.i ] ], n,
+                                 t.tile.data(), t.tile.stride(),
+                            one, &W[ col_offset[ t.j ]*ib ], ib );
+            }
+        }
+        else {
+            // W = (C V)^H = V^H C^H, ib-by-C.m().
+            for (auto& t : local) {
+                blas::gemm( layout, Op::ConjTrans, Op::ConjTrans,
+                            ib, t.tile.mb(), t.tile.nb(),
+                            one, &V[ col_offset[ t.j ] ], n,
+                                 t.tile.data(), t.tile.stride(),
+                            one, &W[ row_offset[ t.i ]*ib ], ib );
+            }
+        }
+        {
+            trace::Block trace_block("MPI_Allreduce");
+            slate_mpi_call(
+                MPI_Allreduce( MPI_IN_PLACE, W.data(), W.size(),
+                               mpi_scalar_type, MPI_SUM, C.mpiComm() ));
+        }
+
+        // W = op(T) W, with op(T) = T for B C and C B^H,
+        // or T^H for B^H C and C B.
+        blas::trmm( layout, Side::Left, Uplo::Upper, opT, Diag::NonUnit,
+                    ib, wn, one, &T[ 0 ], ib, &W[ 0 ], ib );
+        if (left) {
+            // C -= V W.
+            for (auto& t : local) {
+                blas::gemm( layout, Op::NoTrans, Op::NoTrans,
+                            t.tile.mb(), t.tile.nb(), ib,
+                            -one, &V[ row_offset[ t.i ] ], n,
+                                  &W[ col_offset[ t.j ]*ib ], ib,
+                            one,  t.tile.data(), t.tile.stride() );
+            }
+        }
+        else {
+            // C -= W^H V^H.
+            for (auto& t : local) {
+                blas::gemm( layout, Op::ConjTrans, Op::ConjTrans,
+                            t.tile.mb(), t.tile.nb(), ib,
+                            -one, &W[ row_offset[ t.i ]*ib ], ib,
+                                  &V[ col_offset[ t.j ] ], n,
+                            one,  t.tile.data(), t.tile.stride() );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void unmhr<float>(
+    Side side, Op op,
+    Matrix<float>& A,
+    std::vector<float>& tau,
+    Matrix<float>& C,
+    Options const& opts);
+
+template
+void unmhr<double>(
+    Side side, Op op,
+    Matrix<double>& A,
+    std::vector<double>& tau,
+    Matrix<double>& C,
+    Options const& opts);
+
+template
+void unmhr< std::complex<float> >(
+    Side side, Op op,
+    Matrix< std::complex<float> >& A,
+    std::vector< std::complex<float> >& tau,
+    Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void unmhr< std::complex<double> >(
+    Side side, Op op,
+    Matrix< std::complex<double> >& A,
+    std::vector< std::complex<double> >& tau,
+    Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
@@ -28,6 +28,7 @@ void unmqr(
 {
     // trace::Block trace_block("unmqr");
     using BcastList = typename Matrix<scalar_t>::BcastList;
+    using ij_tuple  = typename BaseMatrix<scalar_t>::ij_tuple;
 
     // Assumes column major
     const Layout layout = Layout::ColMajor;
@@ -38,6 +39,10 @@ void unmqr(
     int64_t C_mt = C.mt();
     int64_t C_nt = C.nt();
 
+    // Options
+    int64_t panel_aggregation = get_option<int64_t>(
+        opts, Option::PanelAggregation, 1 );
+
     if (is_complex<scalar_t>::value && op == Op::Trans) {
         throw Exception("Complex numbers uses Op::ConjTrans, not Op::Trans.");
     }
@@ -69,6 +74,29 @@ void unmqr(
     uint8_t* block = block_vector.data();
     SLATE_UNUSED( block ); // Used only by OpenMP
 
+    // Consecutive panels can be merged into one block reflector on the host
+    // if each panel resides on a single rank, so it has no triangle-triangle
+    // reduction, and each block col (left) or row (right) of C resides on a
+    // single rank, so applying it needs no reduction across ranks.
+    std::vector< uint8_t > panel_merge(A_min_mtnt, false);
+    if (panel_aggregation > 1 && target != Target::Devices) {
+        bool C_local = true;
+        int64_t C_len = (side == Side::Left ? C_nt : C_mt);
+        for (int64_t j = 0; j < C_len && C_local; ++j) {
+            std::set<int> ranks_set;
+            if (side == Side::Left)
+                C.sub(0, C_mt-1, j, j).getRanks(&ranks_set);
+            else
+                C.sub(j, j, 0, C_nt-1).getRanks(&ranks_set);
+            C_local = ranks_set.size() == 1;
+        }
+        for (int64_t k = 0; k < A_min_mtnt && C_local; ++k) {
+            std::set<int> ranks_set;
+            A.sub(k, A_mt-1, k, k).getRanks(&ranks_set);
+            panel_merge[k] = ranks_set.size() == 1;
+        }
+    }
+
     // set min number for omp nested active parallel regions
     slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
 
@@ -100,6 +128,68 @@ void unmqr(
         SLATE_UNUSED(lastk);
         for (int64_t k = k_begin; k != k_end; k += k_step) {
 
+            // Find consecutive panels k, ..., k_last to merge.
+            int64_t k_last = k;
+            while (panel_merge[k_last]
+                   && k_last + k_step != k_end
+                   && panel_merge[k_last + k_step]
+                   && std::abs(k_last + k_step - k) < panel_aggregation) {
+                k_last += k_step;
+            }
+
+            if (k_last != k) {
+                int64_t k0 = std::min(k, k_last);
+                int64_t k1 = std::max(k, k_last);
+
+                #pragma omp task depend(inout:block[k]) \
+                                 depend(in:block[lastk])
+                {
+                    Matrix<scalar_t> C_trail;
+                    if (side == Side::Left)
+                        C_trail = C.sub(k0, C_mt-1, 0, C_nt-1);
+                    else
+                        C_trail = C.sub(0, C_mt-1, k0, C_nt-1);
+
+                    // Send V(i, k0:k1) across row C(i, 0:nt-1) or
+                    // col C(0:mt-1, i), and the diagonal Tlocal(k0:k1)
+                    // to all ranks of the trailing C.
+                    BcastList bcast_list_V;
+                    BcastList bcast_list_T;
+                    std::set<ij_tuple> V_tiles, T_tiles;
+                    for (int64_t kk = k0; kk <= k1; ++kk) {
+                        for (int64_t i = kk; i < A_mt; ++i) {
+                            if (side == Side::Left) {
+                                bcast_list_V.push_back(
+                                    {i, kk, {C.sub(i, i, 0, C_nt-1)}});
+                            }
+                            else {
+                                bcast_list_V.push_back(
+                                    {i, kk, {C.sub(0, C_mt-1, i, i)}});
+                            }
+                            V_tiles.insert({i, kk});
+                        }
+                        bcast_list_T.push_back({kk, kk, {C_trail}});
+                        T_tiles.insert({kk, kk});
+                    }
+                    A.template listBcast(bcast_list_V, layout);
+                    Tlocal.template listBcast(bcast_list_T, layout);
+
+                    // Apply Q_k0 ... Q_k1 as one block reflector.
+                    internal::larfb<Target::HostTask>(
+                                    side, op,
+                                    A.sub(k0, A_mt-1, k0, k1),
+                                    Tlocal.sub(k0, k1, k0, k1),
+                                    std::move(C_trail));
+
+                    A.releaseRemoteWorkspace(V_tiles);
+                    Tlocal.releaseRemoteWorkspace(T_tiles);
+                }
+
+                lastk = k;
+                k = k_last;  // loop increment moves past the merged panels
+                continue;
+            }
+
             auto A_panel = A.sub(k, A_mt-1, k, k);
 
             // Find ranks in this column.
@@ -306,6 +396,11 @@ void unmqr(
 ///
 /// @param[in] opts
 ///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::PanelAggregation:
+///       Number of consecutive panels to merge into one block reflector,
+///       which is applied with one pass over $C$. Used on the host when
+///       each panel, and each block col (side = Left) or row (side = Right)
+///       of $C$, resides on a single MPI rank. Default 1.
 ///     - Option::Target:
 ///       Implementation to target. Possible values:
 ///       - HostTask:  OpenMP tasks on CPU host [default].
@@ -56,6 +56,9 @@ namespace slate {
 ///
 /// @param[in] opts
 ///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::PanelAggregation:
+///       Number of consecutive panels to merge into one block reflector
+///       in unmqr or unmlq. Default 1.
 ///     - Option::Target:
 ///       Implementation to target. Possible values:
 ///       - HostTask:  OpenMP tasks on CPU host [default].
@@ -103,6 +103,38 @@ void trsm(Side side, scalar_t alpha, TriangularMatrix<scalar_t> A,
         opts2[ Option::TileReleaseStrategy ] = TileReleaseStrategy::Slate;
     }
 
+    // With MethodTrsm::TrsmInv, invert the diagonal tiles of A up front,
+    // all in parallel, so each diagonal solve on the critical path
+    // becomes a triangular multiply, B(k, :) = A(k, k)^{-1} B(k, :).
+    Method method = get_option( opts, Option::MethodTrsm, MethodTrsm::Auto );
+    bool invert_diag = (method == MethodTrsm::TrsmInv);
+    constexpr Target trmm_target = (target == Target::Devices
+                                    ? Target::Devices : Target::HostTask);
+    TriangularMatrix<scalar_t> Ainv;
+    if (invert_diag) {
+        Ainv = A.emptyLike();
+        for (int64_t k = 0; k < mt; ++k) {
+            if (A.tileIsLocal(k, k)) {
+                Ainv.tileInsert(k, k);
+
+                #pragma omp task depend(out:row[k]) priority(1)
+                {
+                    A.tileGetForReading(k, k, LayoutConvert(layout));
+                    auto Akk = A(k, k);
+                    auto Ainv_kk = Ainv(k, k);
+                    // Diagonal tiles are square, so copying and inverting
+                    // the physical (un-transposed) data is sufficient.
+                    lapack::lacpy( lapack::MatrixType::General,
+                                   Akk.mb(), Akk.nb(),
+                                   Akk.data(), Akk.stride(),
+                                   Ainv_kk.data(), Ainv_kk.stride() );
+                    lapack::trtri( Akk.uploPhysical(), A.diag(), Akk.mb(),
+                                   Ainv_kk.data(), Ainv_kk.stride() );
+                }
+            }
+        }
+    }
+
     if (A.uplo() == Uplo::Lower) {
         // ----------------------------------------
         // Lower/NoTrans or Upper/Trans, Left case
@@ -113,15 +145,29 @@ void trsm(Side side, scalar_t alpha, TriangularMatrix<scalar_t> A,
             // panel (Akk tile)
             #pragma omp task depend(inout:row[k]) priority(1)
             {
-                // send A(k, k) to ranks owning block row B(k, :)
-                A.template tileBcast(k, k, B.sub(k, k, 0, nt-1), layout);
-
-                // solve A(k, k) B(k, :) = alpha B(k, :)
-                internal::trsm<target>(
-                    Side::Left,
-                    alph, A.sub(k, k),
-                          B.sub(k, k, 0, nt-1),
-                    priority_1, layout, queue_1, opts2 );
+                if (invert_diag) {
+                    // send A(k, k)^{-1} to ranks owning block row B(k, :)
+                    Ainv.template tileBcast(
+                        k, k, B.sub(k, k, 0, nt-1), layout);
+
+                    // B(k, :) = alpha A(k, k)^{-1} B(k, :)
+                    internal::trmm<trmm_target>(
+                        Side::Left,
+                        alph, Ainv.sub(k, k),
+                              B.sub(k, k, 0, nt-1),
+                        priority_1, queue_1 );
+                }
+                else {
+                    // send A(k, k) to ranks owning block row B(k, :)
+                    A.template tileBcast(k, k, B.sub(k, k, 0, nt-1), layout);
+
+                    // solve A(k, k) B(k, :) = alpha B(k, :)
+                    internal::trsm<target>(
+                        Side::Left,
+                        alph, A.sub(k, k),
+                              B.sub(k, k, 0, nt-1),
+                        priority_1, layout, queue_1, opts2 );
+                }
 
                 // send A(i=k+1:mt-1, k) to ranks owning block row B(i, :)
                 BcastList bcast_list_A;
@@ -177,6 +223,8 @@ void trsm(Side side, scalar_t alpha, TriangularMatrix<scalar_t> A,
                 auto A_panel = A.sub(k, mt-1, k, k);
                 A_panel.releaseRemoteWorkspace();
                 A_panel.releaseLocalWorkspace();
+                if (invert_diag)
+                    Ainv.sub(k, k).releaseRemoteWorkspace();
 
                 auto B_panel = B.sub(k, k, 0, nt-1);
                 B_panel.releaseRemoteWorkspace();
@@ -198,15 +246,29 @@ void trsm(Side side, scalar_t alpha, TriangularMatrix<scalar_t> A,
             // panel (Akk tile)
             #pragma omp task depend(inout:row[k]) priority(1)
             {
-                // send A(k, k) to ranks owning block row B(k, :)
-                A.template tileBcast(k, k, B.sub(k, k, 0, nt-1), layout);
-
-                // solve A(k, k) B(k, :) = alpha B(k, :)
-                internal::trsm<target>(
-                    Side::Left,
-                    alph, A.sub(k, k),
-                          B.sub(k, k, 0, nt-1),
-                    priority_1, layout, queue_1, opts2 );
+                if (invert_diag) {
+                    // send A(k, k)^{-1} to ranks owning block row B(k, :)
+                    Ainv.template tileBcast(
+                        k, k, B.sub(k, k, 0, nt-1), layout);
+
+                    // B(k, :) = alpha A(k, k)^{-1} B(k, :)
+                    internal::trmm<trmm_target>(
+                        Side::Left,
+                        alph, Ainv.sub(k, k),
+                              B.sub(k, k, 0, nt-1),
+                        priority_1, queue_1 );
+                }
+                else {
+                    // send A(k, k) to ranks owning block row B(k, :)
+                    A.template tileBcast(k, k, B.sub(k, k, 0, nt-1), layout);
+
+                    // solve A(k, k) B(k, :) = alpha B(k, :)
+                    internal::trsm<target>(
+                        Side::Left,
+                        alph, A.sub(k, k),
+                              B.sub(k, k, 0, nt-1),
+                        priority_1, layout, queue_1, opts2 );
+                }
 
                 // send A(i=0:k-1, k) to ranks owning block row B(i, :)
                 BcastList bcast_list_A;
@@ -258,6 +320,8 @@ void trsm(Side side, scalar_t alpha, TriangularMatrix<scalar_t> A,
                 auto A_panel = A.sub(0, k, k, k);
                 A_panel.releaseRemoteWorkspace();
                 A_panel.releaseLocalWorkspace();
+                if (invert_diag)
+                    Ainv.sub(k, k).releaseRemoteWorkspace();
 
                 auto B_panel = B.sub(k, k, 0, nt-1);
                 B_panel.releaseRemoteWorkspace();
@@ -71,6 +71,8 @@ void trsmA(Side side, scalar_t alpha, TriangularMatrix<scalar_t> A,
 
     int64_t lookahead = get_option<int64_t>( opts, Option::Lookahead, 1 );
     auto tileStrategy = get_option<TileReleaseStrategy>( opts, Option::TileReleaseStrategy, TileReleaseStrategy::Slate );
+    Method method_reduce = get_option<Method>(
+            opts, Option::MethodReduce, MethodReduce::Auto );
 
     Options local_opts = opts;
     local_opts[ Option::Lookahead ] = lookahead;
@@ -210,7 +212,8 @@ void trsmA(Side side, scalar_t alpha, TriangularMatrix<scalar_t> A,
                                               }
                                             });
                 }
-                B.template listReduce<target>(reduce_list_B, layout, k);
+                B.template listReduce<target>(
+                    reduce_list_B, layout, k, method_reduce);
 
                 if (A.tileIsLocal(k, k)) {
                     // solve A(k, k) B(k, :) = alpha B(k, :)
@@ -371,7 +374,8 @@ void trsmA(Side side, scalar_t alpha, TriangularMatrix<scalar_t> A,
                                               }
                                             });
                 }
-                B.template listReduce<target>(reduce_list_B, layout, k);
+                B.template listReduce<target>(
+                    reduce_list_B, layout, k, method_reduce);
 
                 if (A.tileIsLocal(k, k)) {
                     // solve A(k, k) B(k, :) = alpha B(k, :)
@@ -335,10 +335,14 @@ cmds = []
 if (opts.blas3):
     cmds += [
     [ 'gbmm',  gen + dtype + la + transA + transB + mnk + ab + kl + ku ],
+    [ 'gbmm',  gen + dtype + la + mnk + ab + ' --kl 5 --ku 5 --compact y' ],
 
     [ 'gemm',  gen + dtype + la + transA + transB + mnk + ab ],
     [ 'gemmA', gen + dtype + la + transA + transB + mnk + ab ],
     [ 'gemmC', gen + dtype + la + transA + transB + mnk + ab ],
+    [ 'gemmC', gen + dtype_complex + la + transA + transB + mnk + ab + ' --3m y' ],
+    # --packed y takes effect only if BLAS is MKL; run it in MKL builds.
+    [ 'gemmC', gen + dtype_real + la + transA + transB + mnk + ab + ' --packed y' ],
 
     [ 'hemm',  gen + dtype         + la + side + uplo     + mn + ab ],
     # todo: hemmA GPU support
@@ -346,6 +350,7 @@ if (opts.blas3):
     [ 'hemmC', gen + dtype         + la + side + uplo     + mn + ab ],
 
     [ 'hbmm',  gen + dtype         + la + side + uplo     + mn + ab + kd ],
+    [ 'hbmm',  gen + dtype         + la + side + uplo     + mn + ab + ' --kd 5 --compact y' ],
 
     [ 'herk',  gen + dtype_real    + la + uplo + trans    + mn + ab ],
     [ 'herk',  gen + dtype_complex + la + uplo + trans_nc + mn + ab ],
@@ -369,6 +374,7 @@ if (opts.blas3):
     [ 'trsm',  gen + dtype + la + side + uplo + transA + diag + mn + a ],
     [ 'trsmA', gen + dtype + la + side + uplo + transA + diag + mn + a ],
     [ 'trsmB', gen + dtype + la + side + uplo + transA + diag + mn + a ],
+    [ 'trsmInv', gen + dtype + la + side + uplo + transA + diag + mn + a ],
     ]
 
 # LU
@@ -381,6 +387,7 @@ if (opts.lu):
 
     # todo: mn
     [ 'getrf',        gen + dtype + la + n + thresh ],
+    [ 'getrf',        gen + dtype_complex + la + n + ' --3m y' ],
     [ 'getrf_tntpiv', gen + dtype + la + n ],
     [ 'getrf_nopiv',  gen + dtype + la + n
                       + ' --matrix rand_dominant --nonuniform_nb n' ],
@@ -404,6 +411,8 @@ if (opts.lu_band):
     [ 'gbsv',  gen + dtype + la + n  + kl + ku ],
     [ 'gbtrf', gen + dtype + la + n  + kl + ku ],  # todo: mn
     [ 'gbtrs', gen + dtype + la + n  + kl + ku + trans ],
+    [ 'gbsv',  gen + dtype + la + n  + ' --kl 5 --ku 5 --compact y' ],
+    [ 'gbtrs', gen + dtype + la + n  + ' --kl 5 --ku 5 --compact y' + trans ],
     #[ 'gbrfs', gen + dtype + la + n  + kl + ku + trans ],
     #[ 'gbequ', gen + dtype + la + n  + kl + ku ],
     ]
@@ -413,6 +422,8 @@ if (opts.chol):
     cmds += [
     [ 'posv',  gen + dtype + la + n + uplo ],
     [ 'potrf', gen + dtype + la + n + uplo + ddist ],
+    [ 'potrf', gen + dtype + la + n + uplo + ' --repl 2,4' ],
+    [ 'potrf', gen + dtype_complex + la + n + uplo + ' --3m y' ],
     [ 'potrs', gen + dtype + la + n + uplo ],
     [ 'potri', gen + dtype + la + n + uplo ],
     #[ 'porfs', gen + dtype + la + n + uplo ],
@@ -428,6 +439,8 @@ if (opts.chol):
     [ 'pbsv',  gen + dtype + la + n + kd + uplo ],
     [ 'pbtrf', gen + dtype + la + n + kd + uplo ],
     [ 'pbtrs', gen + dtype + la + n + kd + uplo ],
+    [ 'pbsv',  gen + dtype + la + n + ' --kd 5,20 --compact y' + uplo ],
+    [ 'pbtrs', gen + dtype + la + n + ' --kd 5,20 --compact y' + uplo ],
     #[ 'pbrfs', gen + dtype + la + n + kd + uplo ],
     #[ 'pbequ', gen + dtype + la + n + kd + uplo ],
     ]
@@ -458,8 +471,8 @@ if (opts.hesv):
 # least squares
 if (opts.least_squares):
     cmds += [
-    # todo: mn (i.e., add wide)
-    [ 'gels',   gen + dtype + la + n + tall + trans_nc + ' --method-gels qr,cholqr' ],
+    [ 'gels',   gen + dtype + la + n + tall + wide + trans_nc + ' --method-gels qr,cholqr --agg 1,2' ],
+    [ 'gels_mixed', gen + dtype_double + la + tall + ' --method-gels qr,cholqr --matrix svd --cond 10,1e3' ],
 
     # Generalized
     #[ 'gglse', gen + dtype + la + mnk ],
@@ -471,7 +484,7 @@ if (opts.qr):
     cmds += [
     [ 'cholqr', gen + dtype + la + n + tall ],  # not wide
     [ 'geqrf', gen + dtype + la + mn ],
-    [ 'unmqr', gen + dtype + la + mn ],
+    [ 'unmqr', gen + dtype + la + mn + ' --agg 1,2,4' ],
     #[ 'ggqrf', gen + dtype + la + mnk ],
     #[ 'ungqr', gen + dtype + la + mn ],  # m >= n
     #[ 'unmqr', gen + dtype_real    + la + mnk + side + trans    ],  # real does trans = N, T, C
@@ -517,6 +530,11 @@ if (opts.syev):
     if ('v' in jobz):
         cmds += [[ 'heev', gen + dtype + la + n + ' --jobz v --method-eig qr,dc' ]]
 
+    cmds += [
+    # k smallest eigenpairs; requires 3 k <= n.
+    [ 'lobpcg', gen + dtype + ' --dim 100x100x5,200x200x10 --ref y' ],
+    ]
+
     cmds += [
     # heev uses only side=l, no-trans. side=r and trans don't yet work
     # with multiple ranks.
@@ -533,6 +551,7 @@ if (opts.syev):
     # todo: uplo
     [ 'he2hb', gen + dtype + n ],
     [ 'hb2st', gen_no_target + dtype + n ],
+    [ 'hbev',  gen + dtype + n + jobz + kd ],
 
     [ 'stedc', gen + n ],
     # Components of stedc; let's not test separately unless there's an issue.
@@ -556,7 +575,7 @@ if (opts.sygv):
 # non-symmetric eigenvalues
 if (opts.geev):
     cmds += [
-    #[ 'geev',  gen + dtype + la + n + jobvl + jobvr ],
+    [ 'geev',  gen + dtype + n + jobvr ],
     #[ 'ggev',  gen + dtype + la + n + jobvl + jobvr ],
     #[ 'geevx', gen + dtype + la + n + balanc + jobvl + jobvr + sense ],
     #[ 'gehrd', gen + dtype + la + n ],
@@ -624,6 +643,8 @@ if (opts.aux):
     [ 'sycopy', gen + dtype + n       + uplo ],
     [ 'hecopy', gen + dtype + n       + uplo ],
 
+    [ 'redistribute', gen + dtype + mn ],
+
     [ 'scale',   gen + dtype + mn + ab        ],
     [ 'tzscale', gen + dtype + mn + ab + uplo ],
     [ 'trscale', gen + dtype + n  + ab + uplo ],
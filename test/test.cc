@@ -33,6 +33,8 @@ using slate::MethodHemm::methodHemm2str;
 using slate::MethodHemm::str2methodHemm;
 using slate::MethodLU::methodLU2str;
 using slate::MethodLU::str2methodLU;
+using slate::MethodReduce::methodReduce2str;
+using slate::MethodReduce::str2methodReduce;
 using slate::MethodTrsm::methodTrsm2str;
 using slate::MethodTrsm::str2methodTrsm;
 
@@ -106,6 +108,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "trsm",               test_trsm,         Section::blas3 },
     { "trsmA",              test_trsm,         Section::blas3 },
     { "trsmB",              test_trsm,         Section::blas3 },
+    { "trsmInv",            test_trsm,         Section::blas3 },
     { "tbsm",               test_tbsm,         Section::blas3 },
 
     // -----
@@ -182,6 +185,7 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // least squares
     { "gels",                test_gels,         Section::gels },
+    { "gels_mixed",          test_gels,         Section::gels },
     { "",                    nullptr,           Section::newline },
 
     // -----
@@ -209,6 +213,8 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // symmetric/Hermitian eigenvalues
     { "heev",               test_heev,         Section::heev },
+    { "hbev",               test_hbev,         Section::heev },
+    { "lobpcg",             test_lobpcg,       Section::heev },
     { "sterf",              test_sterf,        Section::heev },
     { "steqr2",             test_steqr2,       Section::heev },
     { "",                   nullptr,           Section::newline },
@@ -236,6 +242,8 @@ std::vector< testsweeper::routines_t > routines = {
 
     // -----
     // non-symmetric eigenvalues
+    { "geev",               test_geev,         Section::geev },
+    { "",                   nullptr,           Section::newline },
 
     // -----
     // SVD
@@ -276,6 +284,9 @@ std::vector< testsweeper::routines_t > routines = {
     { "hecopy",             test_copy,         Section::aux },
     { "",                   nullptr,           Section::newline },
 
+    { "redistribute",       test_redistribute, Section::aux },
+    { "",                   nullptr,           Section::newline },
+
     { "scale",              test_scale,        Section::aux },
     { "tzscale",            test_scale,        Section::aux },
     { "trscale",            test_scale,        Section::aux },
@@ -346,7 +357,8 @@ Params::Params():
     method_gemm   ("gemm",   4, ParamType::List, 0, str2methodGemm,   methodGemm2str,   "auto=auto, A=gemmA, C=gemmC"),
     method_hemm   ("hemm",   4, ParamType::List, 0, str2methodHemm,   methodHemm2str,   "auto=auto, A=hemmA, C=hemmC"),
     method_lu     ("lu",     5, ParamType::List, slate::MethodLU::PartialPiv, str2methodLU, methodLU2str, "PartialPiv, CALU, NoPiv"),
-    method_trsm   ("trsm",   4, ParamType::List, 0, str2methodTrsm,   methodTrsm2str,   "auto=auto, A=trsmA, B=trsmB"),
+    method_reduce ("reduce", 13, ParamType::List, 0, str2methodReduce, methodReduce2str, "auto=auto, binomial, reducescatter, pipelined"),
+    method_trsm   ("trsm",   4, ParamType::List, 0, str2methodTrsm,   methodTrsm2str,   "auto=auto, A=trsmA, B=trsmB, inv=trsmB with inverted diagonal tiles"),
 
     grid_order("go",      3, ParamType::List, slate::GridOrder::Col,   str2grid_order, grid_order2str, "(go) MPI grid order: c=Col, r=Row"),
     tile_release_strategy ("trs", 3, ParamType::List, slate::TileReleaseStrategy::All, str2tile_release_strategy,   tile_release_strategy2str,   "tile release strategy: n=none, i=only internal routines, s=only top-level routines in slate namespace, a=all routines"),
@@ -402,6 +414,15 @@ Params::Params():
                "given rank waits for debugger (gdb/lldb) to attach"),
     pivot_threshold(
                "thresh",  6, 2, ParamType::List, 1.0,   0.0,     1.0, "threshold for pivoting a remote row"),
+    panel_aggregation(
+               "agg",     3,    ParamType::List, 1,       1, 1000000, "number of Householder panels to merge in unmqr and unmlq"),
+    replication(
+               "repl",    4,    ParamType::List, 1,       1, 1000000, "number of layers in 2.5D potrf"),
+    gemm3m    ("3m",      2,    ParamType::List, 'n',  "ny", "use 3M algorithm (3 real gemms) for complex gemm"),
+    gemm_packed(
+               "packed",  6,    ParamType::List, 'n',  "ny", "use MKL packed gemm for reused tiles (MKL builds only)"),
+    compact_band(
+               "compact", 7,    ParamType::List, 'n',  "ny", "single-rank shortcut using LAPACK compact band storage"),
     deflate   ("deflate", 12,   ParamType::List, "",
                "multiple space-separated (index or /-separated index pairs)"
                " to deflate, e.g., --deflate '1 2/4 3/5'"),
@@ -429,6 +450,7 @@ Params::Params():
     time2     ("time (s)",      9, 3, ParamType::Output, no_data_flag,   0,   0, "time to solution"),
     gflops2   ("gflop/s",      12, 3, ParamType::Output, no_data_flag,   0,   0, "Gflop/s rate"),
     iters     ("iters",         5,    ParamType::Output,            0,   0,   0, "iterations to solution"),
+    workspace ("wksp MiB",      9, 1, ParamType::Output, no_data_flag,   0,   0, "peak workspace memory per rank"),
 
     ref_time  ("ref time (s)", 12, 3, ParamType::Output, no_data_flag,   0,   0, "reference time to solution"),
     ref_gflops("ref gflop/s",  12, 3, ParamType::Output, no_data_flag,   0,   0, "reference Gflop/s rate"),
@@ -451,6 +473,7 @@ Params::Params():
     method_gemm.name("gemm", "method-gemm");
     method_hemm.name("hemm", "method-hemm");
     method_lu.name("lu", "method-lu");
+    method_reduce.name("reduce", "method-reduce");
     method_trsm.name("trsm", "method-trsm");
 
     // change names of matrix B's params
@@ -84,6 +84,7 @@ public:
     testsweeper::ParamEnum< slate::Method >         method_gemm;
     testsweeper::ParamEnum< slate::Method >         method_hemm;
     testsweeper::ParamEnum< slate::Method >         method_lu;
+    testsweeper::ParamEnum< slate::Method >         method_reduce;
     testsweeper::ParamEnum< slate::Method >         method_trsm;
 
     testsweeper::ParamEnum< slate::GridOrder >      grid_order;
@@ -139,6 +140,11 @@ public:
     testsweeper::ParamChar   nonuniform_nb;
     testsweeper::ParamInt    debug;
     testsweeper::ParamDouble pivot_threshold;
+    testsweeper::ParamInt    panel_aggregation;
+    testsweeper::ParamInt    replication;
+    testsweeper::ParamChar   gemm3m;
+    testsweeper::ParamChar   gemm_packed;
+    testsweeper::ParamChar   compact_band;
     testsweeper::ParamString deflate;
 
     // ----- output parameters
@@ -160,6 +166,7 @@ public:
     testsweeper::ParamDouble     time2;
     testsweeper::ParamDouble     gflops2;
     testsweeper::ParamInt        iters;
+    testsweeper::ParamDouble     workspace;
 
     testsweeper::ParamDouble     ref_time;
     testsweeper::ParamDouble     ref_gflops;
@@ -229,6 +236,8 @@ void test_trcondest (Params& params, bool run);
 
 // symmetric/Hermitian eigenvalues
 void test_heev   (Params& params, bool run);
+void test_hbev   (Params& params, bool run);
+void test_lobpcg (Params& params, bool run);
 void test_sterf  (Params& params, bool run);
 void test_steqr2 (Params& params, bool run);
 void test_stedc  (Params& params, bool run);
@@ -247,6 +256,9 @@ void test_unmtr_hb2st (Params& params, bool run);
 void test_hegv   (Params& params, bool run);
 void test_hegst  (Params& params, bool run);
 
+// non-symmetric eigenvalues
+void test_geev   (Params& params, bool run);
+
 // SVD
 void test_svd    (Params& params, bool run);
 void test_ge2tb  (Params& params, bool run);
@@ -266,6 +278,7 @@ void test_trnorm (Params& params, bool run);
 // auxiliary matrix routines
 void test_add    (Params& params, bool run);
 void test_copy   (Params& params, bool run);
+void test_redistribute(Params& params, bool run);
 void test_scale  (Params& params, bool run);
 void test_scale_row_col(Params& params, bool run);
 void test_set    (Params& params, bool run);
@@ -476,6 +489,26 @@ inline double barrier_get_wtime(MPI_Comm comm)
     return testsweeper::get_wtime();
 }
 
+// -----------------------------------------------------------------------------
+/// Starts measuring tile memory use; see peak_workspace().
+/// @return current tile memory in use, to pass to peak_workspace().
+inline int64_t workspace_start()
+{
+    slate::Memory::resetPeakUse();
+    return slate::Memory::inUse();
+}
+
+// -----------------------------------------------------------------------------
+/// @return peak tile memory allocated since workspace_start() returned base,
+/// in MiB, as max over ranks in comm.
+inline double peak_workspace( int64_t base, MPI_Comm comm )
+{
+    double mib = (slate::Memory::peakUse() - base) / (1024. * 1024.);
+    double max_mib;
+    MPI_Allreduce( &mib, &max_mib, 1, MPI_DOUBLE, MPI_MAX, comm );
+    return max_mib;
+}
+
 //------------------------------------------------------------------------------
 /// @return true if str ends with ending.
 /// std::string ends_with added in C++20. For now, do simple implementation.
@@ -44,6 +44,7 @@ void test_gbmm_work(Params& params, bool run)
     int p = params.grid.m();
     int q = params.grid.n();
     int64_t lookahead = params.lookahead();
+    bool compact_band = params.compact_band() == 'y';
     slate::Norm norm = params.norm();
     bool check = params.check() == 'y';
     bool ref = params.ref() == 'y';
@@ -75,7 +76,8 @@ void test_gbmm_work(Params& params, bool run)
 
     slate::Options const opts =  {
         {slate::Option::Lookahead, lookahead},
-        {slate::Option::Target, target}
+        {slate::Option::Target, target},
+        {slate::Option::CompactBand, compact_band}
     };
 
     // Error analysis applies in these norms.
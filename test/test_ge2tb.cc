@@ -45,6 +45,7 @@ void test_ge2tb_work(Params& params, bool run)
     // mark non-standard output values
     params.time();
     params.gflops();
+    params.workspace();
     params.ortho_U();
     params.ortho_V();
     params.error.name( "UBV^H - A" );
@@ -121,6 +122,7 @@ void test_ge2tb_work(Params& params, bool run)
     if (trace) slate::trace::Trace::on();
     else slate::trace::Trace::off();
 
+    int64_t workspace_base = workspace_start();
     double time = barrier_get_wtime(MPI_COMM_WORLD);
 
     //==================================================
@@ -135,6 +137,7 @@ void test_ge2tb_work(Params& params, bool run)
     // compute and save timing/performance
     params.time() = time;
     params.gflops() = gflop / time;
+    params.workspace() = peak_workspace( workspace_base, MPI_COMM_WORLD );
 
     //==================================================
     // Back transform U and VT of the band matrix..
@@ -0,0 +1,251 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_geev_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using complex_t = std::complex<real_t>;
+
+    // Constants
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const real_t tol = params.tol() * 0.5 * eps;
+
+    // get & mark input values
+    lapack::Job jobvl = params.jobvl();
+    lapack::Job jobvr = params.jobvr();
+    int64_t n = params.dim.n();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    int verbose = params.verbose();
+    slate::Origin origin = params.origin();
+    slate::Target target = params.target();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.error2();
+    params.error.name( "value err" );
+    params.error2.name( "back err" );
+
+    if (! run)
+        return;
+
+    slate::Options const opts = {
+        {slate::Option::Target, target},
+    };
+
+    // Skip invalid or unimplemented options.
+    if (jobvl == lapack::Job::Vec) {
+        params.msg() = "skipping: left eigenvectors aren't supported.";
+        return;
+    }
+    bool wantv = (jobvr == lapack::Job::Vec);
+
+    // MPI variables
+    int mpi_rank, myrow, mycol;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    gridinfo(mpi_rank, p, q, &myrow, &mycol);
+
+    // Figure out local size.
+    int64_t mlocA = num_local_rows_cols(n, nb, myrow, p);
+    int64_t nlocA = num_local_rows_cols(n, nb, mycol, q);
+    int64_t lldA  = blas::max(1, mlocA); // local leading dimension of A
+
+    std::vector<scalar_t> A_data;
+
+    slate::Matrix<scalar_t> A;
+    if (origin != slate::Origin::ScaLAPACK) {
+        // SLATE allocates CPU or GPU tiles.
+        slate::Target origin_target = origin2target(origin);
+        A = slate::Matrix<scalar_t>(n, n, nb, p, q, MPI_COMM_WORLD);
+        A.insertLocalTiles(origin_target);
+    }
+    else {
+        // create SLATE matrices from the ScaLAPACK layouts
+        A_data.resize( lldA * nlocA );
+        A = slate::Matrix<scalar_t>::fromScaLAPACK(
+                n, n, &A_data[0], lldA, nb, p, q, MPI_COMM_WORLD);
+    }
+
+    slate::generate_matrix( params.matrix, A );
+
+    slate::Matrix<scalar_t> V;
+    if (wantv) {
+        V = slate::Matrix<scalar_t>(n, n, nb, p, q, MPI_COMM_WORLD);
+        V.insertLocalTiles();
+    }
+
+    if (verbose >= 1) {
+        printf( "%% A %6lld-by-%6lld\n", llong( A.m() ), llong( A.n() ) );
+    }
+
+    print_matrix( "A", A, params );
+
+    // Gather the original A to rank 0 for checking.
+    std::vector<scalar_t> Aref_data;
+    if (check) {
+        if (mpi_rank == 0)
+            Aref_data.resize( n*n );
+        auto Aref = slate::Matrix<scalar_t>::fromLAPACK(
+            n, n, Aref_data.data(), n, nb, 1, 1, MPI_COMM_WORLD );
+        slate::redistribute( A, Aref );
+    }
+
+    std::vector<complex_t> Lambda( n );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    if (wantv) {
+        slate::eig( A, Lambda, V, opts );
+        // Using traditional BLAS/LAPACK name
+        // slate::geev( A, Lambda, V, opts );
+    }
+    else {
+        slate::eig_vals( A, Lambda, opts );
+        // Or slate::eig( A, Lambda, opts );
+        // Using traditional BLAS/LAPACK name
+        // slate::geev( A, Lambda, opts );
+    }
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    // compute and save timing/performance
+    params.time() = time;
+
+    if (check) {
+        // Gather V to rank 0.
+        std::vector<scalar_t> V_data;
+        if (wantv) {
+            if (mpi_rank == 0)
+                V_data.resize( n*n );
+            auto V0 = slate::Matrix<scalar_t>::fromLAPACK(
+                n, n, V_data.data(), n, nb, 1, 1, MPI_COMM_WORLD );
+            slate::redistribute( V, V0 );
+        }
+
+        if (mpi_rank == 0) {
+            real_t Anorm = lapack::lange( lapack::Norm::One, n, n,
+                                          &Aref_data[0], n );
+
+            //==================================================
+            // Compare eigenvalues with LAPACK geev, up to ordering:
+            //
+            //      max_j min_k | Lambda_j - Lambda_ref_k |
+            //     ----------------------------------------- < tol * epsilon
+            //                 || A ||_1 * N
+            //==================================================
+            std::vector<scalar_t> Acopy = Aref_data;
+            std::vector<complex_t> Lambda_ref( n );
+            int64_t info = lapack::geev( lapack::Job::NoVec, lapack::Job::NoVec,
+                                         n, &Acopy[0], n, &Lambda_ref[0],
+                                         nullptr, 1, nullptr, 1 );
+            slate_assert( info == 0 );
+            real_t err = 0;
+            for (int64_t j = 0; j < n; ++j) {
+                real_t dist = std::numeric_limits<real_t>::max();
+                for (int64_t k = 0; k < n; ++k)
+                    dist = std::min( dist, std::abs( Lambda[ j ] - Lambda_ref[ k ] ) );
+                err = std::max( err, dist );
+            }
+            params.error() = err / (Anorm * n);
+
+            if (wantv) {
+                //==================================================
+                // Test results by checking backwards error
+                //
+                //      || A V - V Lambda ||_1
+                //     ------------------------ < tol * epsilon
+                //          || A ||_1 * N
+                //==================================================
+                // Complex A and V; for real A, unpack conjugate pairs.
+                std::vector<complex_t> Ac( n*n ), Vc( n*n ), R( n*n );
+                for (int64_t i = 0; i < n*n; ++i)
+                    Ac[ i ] = Aref_data[ i ];
+                for (int64_t j = 0; j < n; ++j) {
+                    if (! slate::is_complex<scalar_t>::value
+                        && Lambda[ j ].imag() > 0 && j+1 < n) {
+                        for (int64_t i = 0; i < n; ++i) {
+                            complex_t re = V_data[ i + j*n ];
+                            complex_t im = V_data[ i + (j+1)*n ];
+                            Vc[ i + j*n ]     = re + complex_t( 0, 1 ) * im;
+                            Vc[ i + (j+1)*n ] = re - complex_t( 0, 1 ) * im;
+                        }
+                        ++j;
+                    }
+                    else {
+                        for (int64_t i = 0; i < n; ++i)
+                            Vc[ i + j*n ] = V_data[ i + j*n ];
+                    }
+                }
+                // R = V Lambda - A V.
+                for (int64_t j = 0; j < n; ++j)
+                    for (int64_t i = 0; i < n; ++i)
+                        R[ i + j*n ] = Vc[ i + j*n ] * Lambda[ j ];
+                blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans,
+                            blas::Op::NoTrans, n, n, n,
+                            complex_t( -1 ), &Ac[0], n, &Vc[0], n,
+                            complex_t( 1 ), &R[0], n );
+                params.error2() = lapack::lange( lapack::Norm::One, n, n,
+                                                 &R[0], n ) / (Anorm * n);
+            }
+        }
+        MPI_Bcast( &params.error(), 1, MPI_DOUBLE, 0, MPI_COMM_WORLD );
+        MPI_Bcast( &params.error2(), 1, MPI_DOUBLE, 0, MPI_COMM_WORLD );
+
+        params.okay() = (params.error() <= tol);
+        if (wantv)
+            params.okay() = params.okay() && (params.error2() <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geev(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_geev_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geev_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geev_work< std::complex<float> > (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geev_work< std::complex<double> > (params, run);
+            break;
+    }
+}
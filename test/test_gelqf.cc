@@ -50,6 +50,7 @@ void test_gelqf_work(Params& params, bool run)
     // mark non-standard output values
     params.time();
     params.gflops();
+    params.workspace();
     params.ref_time();
     params.ref_gflops();
 
@@ -110,6 +111,7 @@ void test_gelqf_work(Params& params, bool run)
         if (trace) slate::trace::Trace::on();
         else slate::trace::Trace::off();
 
+        int64_t workspace_base = workspace_start();
         double time = barrier_get_wtime(MPI_COMM_WORLD);
 
         //==================================================
@@ -126,6 +128,7 @@ void test_gelqf_work(Params& params, bool run)
         // compute and save timing/performance
         params.time() = time;
         params.gflops() = gflop / time;
+        params.workspace() = peak_workspace( workspace_base, MPI_COMM_WORLD );
 
         print_matrix("A_factored", A, params);
         print_matrix("Tlocal",  T[0], params);
@@ -40,6 +40,7 @@ void test_gels_work(Params& params, bool run)
     int64_t ib = params.ib();
     int64_t lookahead = params.lookahead();
     int64_t panel_threads = params.panel_threads();
+    int64_t panel_aggregation = params.panel_aggregation();
     bool ref_only = params.ref() == 'o';
     bool ref = params.ref() == 'y' || ref_only;
     bool check = params.check() == 'y' && ! ref_only;
@@ -65,16 +66,32 @@ void test_gels_work(Params& params, bool run)
     params.ref_time();
     params.ref_gflops();
 
+    bool is_mixed = params.routine == "gels_mixed";
+    if (is_mixed)
+        params.iters();
+
     if (! run)
         return;
 
+    if (is_mixed) {
+        if (! std::is_same<real_t, double>::value) {
+            params.msg() = "skipping: unsupported mixed precision; must be type=d or z";
+            return;
+        }
+        if (trans != slate::Op::NoTrans || m < n) {
+            params.msg() = "skipping: gels_mixed requires trans=n and m >= n";
+            return;
+        }
+    }
+
     slate::Options const opts =  {
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
         {slate::Option::InnerBlocking, ib},
         {slate::Option::MethodCholQR, methodCholqr},
-        {slate::Option::MethodGels, methodGels}
+        {slate::Option::MethodGels, methodGels},
+        {slate::Option::PanelAggregation, panel_aggregation}
     };
 
     // A is m-by-n, BX is max(m, n)-by-nrhs.
@@ -221,9 +238,18 @@ void test_gels_work(Params& params, bool run)
         //==================================================
         // Run SLATE test.
         //==================================================
-        slate::least_squares_solve(opA, BX, opts);
-        // Using traditional BLAS/LAPACK name
-        // slate::gels(opA, T, BX, opts);
+        if (is_mixed) {
+            if constexpr (std::is_same<real_t, double>::value) {
+                int iters = 0;
+                slate::gels_mixed( opA, BX, iters, opts );
+                params.iters() = iters;
+            }
+        }
+        else {
+            slate::least_squares_solve(opA, BX, opts);
+            // Using traditional BLAS/LAPACK name
+            // slate::gels(opA, T, BX, opts);
+        }
 
         time = barrier_get_wtime(MPI_COMM_WORLD) - time;
 
@@ -308,10 +334,14 @@ void test_gels_work(Params& params, bool run)
             set(zero, D);
 
             // copy op(A)^H -> D
-            // todo: support op(A)^H = A^H. Requires distributed copy of A^H to D.
-            slate_assert(trans != slate::Op::NoTrans);
-            auto DS = D.slice(0, Aref.m()-1, 0, Aref.n()-1);
-            copy(Aref, DS);
+            // op(A)^H = A^H needs a distributed transposed copy.
+            auto DS = D.slice(0, opAn-1, 0, opAm-1);
+            if (trans == slate::Op::NoTrans) {
+                auto AH = conj_transpose( Aref );
+                slate::redistribute(AH, DS);
+            }
+            else
+                copy(Aref, DS);
             auto DX = D.sub(0, D.mt()-1, Xstart, D.nt()-1);
             copy(X, DX);
 
@@ -380,6 +410,9 @@ void test_gels_work(Params& params, bool run)
             params.error3() = error3;
             params.okay() = (params.okay() && params.error3() <= tol);
         }
+
+        if (is_mixed)
+            params.okay() = params.okay() && params.iters() >= 0;
     }
 
     if (ref) {
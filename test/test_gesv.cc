@@ -69,6 +69,7 @@ void test_gesv_work(Params& params, bool run)
     bool check = params.check() == 'y' && ! ref_only;
     bool trace = params.trace() == 'y';
     bool nonuniform_nb = params.nonuniform_nb() == 'y';
+    bool gemm3m = params.gemm3m() == 'y';
     int verbose = params.verbose();
     SLATE_UNUSED(verbose);
     slate::Origin origin = params.origin();
@@ -132,6 +133,7 @@ void test_gesv_work(Params& params, bool run)
         {slate::Option::MethodLU, method_lu},
         {slate::Option::MethodGemm, methodGemm},
         {slate::Option::MethodTrsm, methodTrsm},
+        {slate::Option::Gemm3M, gemm3m},
     };
 
     // Matrix A: figure out local size.
@@ -0,0 +1,234 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_hbev_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using blas::real;
+
+    // Constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const real_t tol = params.tol() * 0.5 * eps;
+
+    // get & mark input values
+    slate::Job jobz = params.jobz();
+    slate::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t kd = params.kd();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    int verbose = params.verbose();
+    slate::Target target = params.target();
+    slate::MethodEig method_eig = params.method_eig();
+
+    // mark non-standard output values
+    params.time();
+    params.error2();
+    params.ortho();
+    params.error.name( "value err" );
+    params.error2.name( "back err" );
+    params.ortho.name( "Z orth." );
+
+    if (! run)
+        return;
+
+    slate::Options const opts = {
+        {slate::Option::Target, target},
+        {slate::Option::MethodEig, method_eig},
+    };
+
+    // Skip invalid or unimplemented options.
+    if (uplo == slate::Uplo::Upper) {
+        params.msg() = "skipping: Uplo::Upper isn't supported.";
+        return;
+    }
+    if (kd > nb) {
+        params.msg() = "skipping: requires kd <= nb.";
+        return;
+    }
+
+    // MPI variables
+    int mpi_rank, myrow, mycol;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    gridinfo(mpi_rank, p, q, &myrow, &mycol);
+
+    // Every rank generates the same full matrix, zero outside the band.
+    int64_t lda = n;
+    int64_t seed[] = {0, 1, 2, 3};
+    std::vector<scalar_t> Afull_data( lda*n );
+    lapack::larnv(1, seed, Afull_data.size(), &Afull_data[0]);
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            if (i - j > kd || i < j)
+                Afull_data[i + j*lda] = 0;
+        }
+        Afull_data[j + j*lda] = real( Afull_data[j + j*lda] );
+    }
+
+    auto Afull = slate::HermitianMatrix<scalar_t>::fromLAPACK(
+        uplo, n, &Afull_data[0], lda, nb, p, q, MPI_COMM_WORLD);
+
+    // Band matrix with the same distribution.
+    auto A = slate::HermitianBandMatrix<scalar_t>(
+        uplo, n, kd, nb, p, q, MPI_COMM_WORLD);
+    A.insertLocalTiles();
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = j; i < std::min( j+2, A.mt() ); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                auto Aij = A( i, j );
+                auto Fij = Afull( i, j );
+                Aij.uplo( slate::Uplo::General );
+                Fij.uplo( slate::Uplo::General );
+                slate::tile::gecopy( Fij, Aij );
+            }
+        }
+    }
+
+    slate::Matrix<scalar_t> Z;
+    if (jobz == slate::Job::Vec) {
+        Z = slate::Matrix<scalar_t>( n, n, nb, p, q, MPI_COMM_WORLD );
+        Z.insertLocalTiles();
+    }
+
+    if (verbose >= 1) {
+        printf( "%% A %6lld-by-%6lld, kd %lld\n",
+                llong( A.m() ), llong( A.n() ), llong( kd ) );
+    }
+
+    print_matrix( "A", A, params );
+
+    std::vector<real_t> Lambda( n );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    slate::hbev( A, Lambda, Z, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    // compute and save timing/performance
+    params.time() = time;
+
+    if (check) {
+        //==================================================
+        // Compare eigenvalues with LAPACK heev of the full matrix:
+        //
+        //      || Lambda_ref - Lambda ||_1
+        //     ----------------------------- < tol * epsilon
+        //          || Lambda_ref ||_1
+        //==================================================
+        std::vector<real_t> Lambda_ref( n );
+        if (mpi_rank == 0) {
+            std::vector<scalar_t> Afull_copy = Afull_data;
+            int64_t info = lapack::heev( lapack::Job::NoVec, uplo, n,
+                                         &Afull_copy[0], lda, &Lambda_ref[0] );
+            slate_assert( info == 0 );
+
+            blas::axpy( n, -1.0, &Lambda_ref[0], 1, &Lambda[0], 1 );
+            params.error() = blas::asum( n, &Lambda[0], 1 )
+                           / blas::asum( n, &Lambda_ref[0], 1 );
+            blas::axpy( n, 1.0, &Lambda_ref[0], 1, &Lambda[0], 1 );
+        }
+        MPI_Bcast( &params.error(), 1, MPI_DOUBLE, 0, MPI_COMM_WORLD );
+        params.okay() = (params.error() <= tol);
+
+        if (jobz == slate::Job::Vec) {
+            //==================================================
+            // Test results by checking backwards error
+            //
+            //      || A Z - Z Lambda ||_1
+            //     ------------------------ < tol * epsilon
+            //          || A ||_1 * N
+            //
+            // and orthogonality
+            //
+            //      || I - Z^H Z ||_1
+            //     ------------------- < tol * epsilon
+            //              N
+            //==================================================
+            auto R = Z.emptyLike();
+            R.insertLocalTiles();
+            slate::copy( Z, R );
+
+            // R = Z Lambda
+            int64_t jj = 0;
+            for (int64_t j = 0; j < R.nt(); ++j) {
+                for (int64_t i = 0; i < R.mt(); ++i) {
+                    if (R.tileIsLocal( i, j )) {
+                        auto T = R( i, j );
+                        for (int64_t tj = 0; tj < T.nb(); ++tj)
+                            for (int64_t ti = 0; ti < T.mb(); ++ti)
+                                T.at( ti, tj ) *= Lambda[ jj + tj ];
+                    }
+                }
+                jj += R.tileNb( j );
+            }
+
+            // R = A Z - Z Lambda
+            slate::hemm( slate::Side::Left, one, Afull, Z, -one, R );
+            real_t Anorm = slate::norm( slate::Norm::One, Afull );
+            params.error2() = slate::norm( slate::Norm::One, R ) / (Anorm * n);
+            params.okay() = params.okay() && (params.error2() <= tol);
+
+            // R = I - Z^H Z
+            slate::set( zero, one, R );
+            auto ZH = conj_transpose( Z );
+            slate::gemm( -one, ZH, Z, one, R );
+            params.ortho() = slate::norm( slate::Norm::One, R ) / n;
+            params.okay() = params.okay() && (params.ortho() <= tol);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_hbev(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_hbev_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_hbev_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_hbev_work< std::complex<float> > (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_hbev_work< std::complex<double> > (params, run);
+            break;
+    }
+}
@@ -37,6 +37,7 @@ void test_hbmm_work(Params& params, bool run)
     int64_t kd = params.kd();
     int64_t nb = params.nb();
     int64_t lookahead = params.lookahead();
+    bool compact_band = params.compact_band() == 'y';
     slate::Norm norm = params.norm();
     bool check = params.check() == 'y';
     bool ref = params.ref() == 'y';
@@ -67,7 +68,8 @@ void test_hbmm_work(Params& params, bool run)
 
     slate::Options const opts =  {
         {slate::Option::Lookahead, lookahead},
-        {slate::Option::Target, target}
+        {slate::Option::Target, target},
+        {slate::Option::CompactBand, compact_band}
     };
 
     // slate_assert(uplo == slate::Uplo::Lower);
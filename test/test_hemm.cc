@@ -54,6 +54,7 @@ void test_hemm_work(Params& params, bool run)
     slate::Origin origin = params.origin();
     slate::Target target = params.target();
     slate::Method method_hemm = params.method_hemm();
+    slate::Method method_reduce = params.method_reduce();
     params.matrix.mark();
     params.matrixB.mark();
     params.matrixC.mark();
@@ -75,6 +76,7 @@ void test_hemm_work(Params& params, bool run)
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MethodHemm, method_hemm},
+        {slate::Option::MethodReduce, method_reduce},
         // TODO fix gemmA on device
         //{slate::Option::MethodGemm, slate::MethodGemm::GemmC}
     };
@@ -0,0 +1,213 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_lobpcg_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const real_t tol = params.tol() * 0.5 * eps;
+    // LOBPCG converges the residual to its tolerance, by default sqrt(eps).
+    const real_t tol_res = std::sqrt( eps );
+
+    // get & mark input values
+    slate::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb = params.nb();
+    bool ref_only = params.ref() == 'o';
+    bool ref = params.ref() == 'y' || ref_only;
+    bool check = params.check() == 'y' && ! ref_only;
+    bool trace = params.trace() == 'y';
+    int verbose = params.verbose();
+    slate::Target target = params.target();
+    params.matrix.mark();
+    params.matrixB.mark();
+
+    // mark non-standard output values
+    params.time();
+    params.ref_time();
+    params.error2();
+    params.ortho();
+    params.iters();
+    params.error.name( "value err" );
+    params.error2.name( "back err" );
+    params.ortho.name( "X orth." );
+
+    if (! run)
+        return;
+
+    slate::Options const opts = {
+        {slate::Option::Target, target},
+    };
+
+    // Skip invalid or unimplemented options.
+    if (3*k > n) {
+        params.msg() = "skipping: requires 3 k <= n.";
+        return;
+    }
+
+    // Initialize SLATE data structures.
+    // A is n-by-n Hermitian; X is the n-by-k initial guess.
+    slate::Target origin_target = origin2target( params.origin() );
+    auto A = slate::HermitianMatrix<scalar_t>(
+                 uplo, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles( origin_target );
+    auto X = slate::Matrix<scalar_t>( n, k, nb, p, q, MPI_COMM_WORLD );
+    X.insertLocalTiles( origin_target );
+
+    slate::generate_matrix( params.matrix, A );
+    slate::generate_matrix( params.matrixB, X );
+
+    if (verbose >= 1) {
+        printf( "%% A %6lld-by-%6lld\n", llong( A.m() ), llong( A.n() ) );
+        printf( "%% X %6lld-by-%6lld\n", llong( X.m() ), llong( X.n() ) );
+    }
+
+    print_matrix( "A", A, params );
+
+    std::vector<real_t> Lambda;
+    if (! ref_only) {
+        if (trace) slate::trace::Trace::on();
+        else slate::trace::Trace::off();
+
+        double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+        //==================================================
+        // Run SLATE test.
+        //==================================================
+        int iters = 0;
+        slate::lobpcg( A, Lambda, X, iters, opts );
+
+        time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+
+        if (trace) slate::trace::Trace::finish();
+
+        // compute and save timing/performance
+        params.time() = time;
+        params.iters() = iters;
+
+        print_matrix( "X_out", X, params );
+
+        if (check) {
+            //==================================================
+            // Test results by checking backwards error
+            //
+            //      || A X - X Lambda ||_F
+            //     ------------------------ < sqrt( k ) tol_res
+            //            || A ||_1
+            //
+            // and orthogonality
+            //
+            //      || I - X^H X ||_1
+            //     ------------------- < tol * epsilon
+            //              k
+            //==================================================
+            auto R = X.emptyLike();
+            R.insertLocalTiles();
+            slate::copy( X, R );
+
+            // R = X Lambda.
+            int64_t jj = 0;
+            for (int64_t j = 0; j < R.nt(); ++j) {
+                for (int64_t i = 0; i < R.mt(); ++i) {
+                    if (R.tileIsLocal( i, j )) {
+                        auto T = R( i, j );
+                        for (int64_t tj = 0; tj < T.nb(); ++tj)
+                            for (int64_t ti = 0; ti < T.mb(); ++ti)
+                                T.at( ti, tj ) *= Lambda[ jj + tj ];
+                    }
+                }
+                jj += R.tileNb( j );
+            }
+
+            // R = A X - X Lambda.
+            slate::hemm( slate::Side::Left, one, A, X, -one, R );
+            real_t Anorm = slate::norm( slate::Norm::One, A );
+            params.error2() = slate::norm( slate::Norm::Fro, R ) / Anorm;
+            params.okay() = (params.iters() >= 0)
+                            && (params.error2() <= std::sqrt( k ) * tol_res);
+
+            // I - X^H X
+            auto XH = conj_transpose( X );
+            auto Iden = slate::Matrix<scalar_t>( k, k, nb, p, q, MPI_COMM_WORLD );
+            Iden.insertLocalTiles();
+            slate::set( zero, one, Iden );
+            slate::gemm( -one, XH, X, one, Iden );
+            params.ortho() = slate::norm( slate::Norm::One, Iden ) / k;
+            params.okay() = params.okay() && (params.ortho() <= tol);
+        }
+    }
+
+    if (ref) {
+        //==================================================
+        // Run reference heev on a copy of A, and compare
+        // the k smallest eigenvalues.
+        //==================================================
+        auto Aref = A.emptyLike();
+        Aref.insertLocalTiles();
+        slate::copy( A, Aref );
+        std::vector<real_t> Lambda_ref( n );
+
+        double time = barrier_get_wtime(MPI_COMM_WORLD);
+        slate::eig_vals( Aref, Lambda_ref, opts );
+        time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+        params.ref_time() = time;
+
+        if (! ref_only) {
+            // Relative forward error: || Lambda_ref - Lambda || / || Lambda_ref ||.
+            // The eigenvalue error is of order of the residual squared.
+            blas::axpy( k, -1.0, &Lambda_ref[0], 1, &Lambda[0], 1 );
+            params.error() = blas::asum( k, &Lambda[0], 1 )
+                           / blas::asum( k, &Lambda_ref[0], 1 );
+            params.okay() = params.okay()
+                            && (params.error() <= tol_res * tol_res + tol);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_lobpcg(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_lobpcg_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_lobpcg_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_lobpcg_work< std::complex<float> > (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_lobpcg_work< std::complex<double> > (params, run);
+            break;
+    }
+}
@@ -34,6 +34,7 @@ void test_pbsv_work(Params& params, bool run)
     int q = params.grid.n();
     int64_t nb = params.nb();
     int64_t lookahead = params.lookahead();
+    bool compact_band = params.compact_band() == 'y';
     bool ref_only = params.ref() == 'o';
     bool ref = params.ref() == 'y' || ref_only;
     bool check = params.check() == 'y' && ! ref_only;
@@ -59,7 +60,8 @@ void test_pbsv_work(Params& params, bool run)
 
     slate::Options const opts =  {
         {slate::Option::Lookahead, lookahead},
-        {slate::Option::Target, target}
+        {slate::Option::Target, target},
+        {slate::Option::CompactBand, compact_band}
     };
 
     // MPI variables
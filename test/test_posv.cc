@@ -51,6 +51,8 @@ void test_posv_work(Params& params, bool run)
     params.matrixB.mark();
     slate::Method methodTrsm = params.method_trsm();
     slate::Method methodHemm = params.method_hemm();
+    int64_t replication = params.replication();
+    bool gemm3m = params.gemm3m() == 'y';
 
     // mark non-standard output values
     params.time();
@@ -82,6 +84,8 @@ void test_posv_work(Params& params, bool run)
         {slate::Option::HoldLocalWorkspace, hold_local_workspace},
         {slate::Option::MethodTrsm, methodTrsm},
         {slate::Option::MethodHemm, methodHemm},
+        {slate::Option::Replication, replication},
+        {slate::Option::Gemm3M, gemm3m},
     };
 
     // MPI variables
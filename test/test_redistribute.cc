@@ -0,0 +1,179 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <utility>
+#include <vector>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_redistribute_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using ij_tuple = typename slate::Matrix<scalar_t>::ij_tuple;
+
+    // Constants
+    const scalar_t one = 1.0;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nb = params.nb();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time();
+
+    if (! run)
+        return;
+
+    slate::Options const opts = {};
+
+    int mpi_rank, mpi_size;
+    MPI_Comm_rank( MPI_COMM_WORLD, &mpi_rank );
+    MPI_Comm_size( MPI_COMM_WORLD, &mpi_size );
+
+    // A on the p-by-q grid of all ranks.
+    auto A = slate::Matrix<scalar_t>( m, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles();
+    slate::generate_matrix( params.matrix, A );
+    print_matrix( "A", A, params );
+
+    // B on a 1-by-sub_size grid of a sub-communicator with the first half
+    // of the ranks, so A's and B's communicators have different sizes
+    // unless there is only one rank. Other ranks pass an empty B.
+    int sub_size = std::max( 1, mpi_size / 2 );
+    int in_sub = mpi_rank < sub_size;
+    MPI_Comm sub_comm;
+    MPI_Comm_split( MPI_COMM_WORLD, in_sub, mpi_rank, &sub_comm );
+    slate::Matrix<scalar_t> B;
+    if (in_sub) {
+        B = slate::Matrix<scalar_t>( m, n, nb, 1, sub_size, sub_comm );
+        B.insertLocalTiles();
+    }
+
+    // C back on all ranks, on the q-by-p grid.
+    auto C = slate::Matrix<scalar_t>( m, n, nb, q, p, MPI_COMM_WORLD );
+    C.insertLocalTiles();
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime( MPI_COMM_WORLD );
+
+    //==================================================
+    // Run SLATE test.
+    // Redistribute A to B on the sub-communicator, and back to C.
+    //==================================================
+    slate::redistribute( A, B, MPI_COMM_WORLD, opts );
+    slate::redistribute( B, C, MPI_COMM_WORLD, opts );
+
+    time = barrier_get_wtime( MPI_COMM_WORLD ) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    params.time() = time;
+
+    print_matrix( "C", C, params );
+
+    if (check) {
+        //==================================================
+        // Test results: check that a matrix with the same number of
+        // tiles, but different tile sizes, is rejected, then that
+        // C = A exactly.
+        //==================================================
+        bool rejected = true;
+
+        // Move the short last block row first.
+        int64_t mt = slate::ceildiv( m, nb );
+        int64_t mb_last = m - (mt - 1)*nb;
+        if (mb_last != nb) {
+            std::function<int64_t (int64_t)> tileMb
+                = [mb_last, nb]( int64_t i ) {
+                    return i == 0 ? mb_last : nb;
+                };
+            std::function<int64_t (int64_t)> tileNb = [nb, n]( int64_t j ) {
+                return std::min( nb, n - j*nb );
+            };
+            std::function<int (ij_tuple)> tileRank = [mpi_size]( ij_tuple ij ) {
+                return int( std::get<0>( ij ) % mpi_size );
+            };
+            std::function<int (ij_tuple)> tileDevice = []( ij_tuple ij ) {
+                return slate::HostNum;
+            };
+            slate::Matrix<scalar_t> D( m, n, tileMb, tileNb, tileRank,
+                                       tileDevice, MPI_COMM_WORLD );
+            D.insertLocalTiles();
+            rejected = false;
+            try {
+                slate::redistribute( A, D, MPI_COMM_WORLD, opts );
+            }
+            catch (slate::Exception& e) {
+                rejected = true;
+            }
+        }
+
+        // A and C have different distributions, so compare them on rank 0.
+        std::vector<scalar_t> A_data, C_data;
+        if (mpi_rank == 0) {
+            A_data.resize( m*n );
+            C_data.resize( m*n );
+        }
+        A.gather( A_data.data(), m );
+        C.gather( C_data.data(), m );
+        real_t error = 0;
+        if (mpi_rank == 0) {
+            real_t A_norm = lapack::lange( slate::Norm::One, m, n,
+                                           A_data.data(), m );
+            blas::axpy( m*n, -one, A_data.data(), 1, C_data.data(), 1 );
+            error = lapack::lange( slate::Norm::One, m, n,
+                                   C_data.data(), m ) / A_norm;
+        }
+        MPI_Bcast( &error, 1, slate::mpi_type<real_t>::value, 0,
+                   MPI_COMM_WORLD );
+        params.error() = error;
+        params.okay() = (params.error() == 0) && rejected;
+    }
+
+    MPI_Comm_free( &sub_comm );
+}
+
+// -----------------------------------------------------------------------------
+void test_redistribute(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_redistribute_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_redistribute_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_redistribute_work< std::complex<float> > (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_redistribute_work< std::complex<double> > (params, run);
+            break;
+    }
+}
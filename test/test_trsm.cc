@@ -35,6 +35,8 @@ void test_trsm_work(Params& params, bool run)
         params.method_trsm() = slate::MethodTrsm::TrsmA;
     else if (params.routine == "trsmB")
         params.method_trsm() = slate::MethodTrsm::TrsmB;
+    else if (params.routine == "trsmInv")
+        params.method_trsm() = slate::MethodTrsm::TrsmInv;
 
     // get & mark input values
     slate::Side side = params.side();
@@ -55,6 +57,7 @@ void test_trsm_work(Params& params, bool run)
     slate::Origin origin = params.origin();
     slate::Target target = params.target();
     slate::Method method_trsm = params.method_trsm();
+    slate::Method method_reduce = params.method_reduce();
     params.matrix.mark();
     params.matrixB.mark();
 
@@ -76,6 +79,7 @@ void test_trsm_work(Params& params, bool run)
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MethodTrsm, method_trsm},
+        {slate::Option::MethodReduce, method_reduce},
     };
 
     // Error analysis applies in these norms.
@@ -213,7 +217,16 @@ void test_trsm_work(Params& params, bool run)
 
         // Allow 3*eps; complex needs 2*sqrt(2) factor; see Higham, 2002, sec. 3.6.
         real_t eps = std::numeric_limits<real_t>::epsilon();
-        params.okay() = (params.error() <= 3*eps);
+        if (method_trsm == slate::MethodTrsm::TrsmInv) {
+            // Multiplying by inverted diagonal tiles is not backward stable;
+            // the error grows with the condition numbers of the diagonal
+            // tiles (see Du Croz and Higham, 1992), so use the looser tol.
+            params.okay() = (params.error() <= params.tol() * 0.5 * eps);
+            params.msg() = "inverted diagonal tiles; error ~ cond(A(k, k))";
+        }
+        else {
+            params.okay() = (params.error() <= 3*eps);
+        }
     }
 
     if (ref) {
@@ -39,6 +39,7 @@ void test_unmqr_work(Params& params, bool run)
     int64_t ib = params.ib();
     int64_t lookahead = params.lookahead();
     int64_t panel_threads = params.panel_threads();
+    int64_t panel_aggregation = params.panel_aggregation();
     bool check = params.check() == 'y';
     bool trace = params.trace() == 'y';
     slate::Origin origin = params.origin();
@@ -61,7 +62,8 @@ void test_unmqr_work(Params& params, bool run)
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
-        {slate::Option::InnerBlocking, ib}
+        {slate::Option::InnerBlocking, ib},
+        {slate::Option::PanelAggregation, panel_aggregation}
     };
 
     // MPI variables
@@ -0,0 +1,152 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/method.hh"
+#include "slate/internal/CostModel.hh"
+
+#include "unit_test.hh"
+
+#include <cstdio>
+#include <cstdlib>
+
+using slate::CostModel;
+using slate::MachineParams;
+
+namespace test {
+
+//------------------------------------------------------------------------------
+// global variables
+int mpi_rank;
+int mpi_size;
+MPI_Comm mpi_comm;
+
+// Matrices are on a 2-by-2 grid, regardless of the number of ranks,
+// since select_algo needs only their sizes and distribution.
+const int64_t m  = 4000;
+const int64_t n  = 512;   // 2 tiles, so heuristics select the C/B variants
+const int64_t nb = 256;
+const int p = 2, q = 2;
+
+//------------------------------------------------------------------------------
+/// Tests that, with the model disabled (the default), Auto selects the
+/// fixed heuristics.
+void test_disabled()
+{
+    CostModel::disable();
+    test_assert( ! CostModel::enabled() );
+
+    slate::Options opts;
+    slate::Matrix<double> A( m, m, nb, p, q, mpi_comm );
+    slate::Matrix<double> B( m, n, nb, p, q, mpi_comm );
+    slate::TriangularMatrix<double> T(
+        slate::Uplo::Lower, slate::Diag::NonUnit, m, nb, p, q, mpi_comm );
+    slate::HermitianMatrix<double> H( slate::Uplo::Lower, m, nb, p, q, mpi_comm );
+
+    test_assert( slate::MethodGemm::select_algo( A, B, opts )
+                 == slate::MethodGemm::GemmC );
+    test_assert( slate::MethodTrsm::select_algo( T, B, opts )
+                 == slate::MethodTrsm::TrsmB );
+    test_assert( slate::MethodHemm::select_algo( H, B, opts )
+                 == slate::MethodHemm::HemmC );
+    test_assert( slate::MethodCholQR::select_algo( B, B, opts )
+                 == slate::MethodCholQR::GemmA );
+}
+
+//------------------------------------------------------------------------------
+/// Tests the methods that Auto selects with fixed machine parameters.
+void test_enabled()
+{
+    CostModel::machine( MachineParams() );
+    test_assert( CostModel::enabled() );
+
+    slate::Options opts;
+    slate::Matrix<double> A( m, m, nb, p, q, mpi_comm );
+    slate::Matrix<double> B( m, n, nb, p, q, mpi_comm );
+    slate::TriangularMatrix<double> T(
+        slate::Uplo::Lower, slate::Diag::NonUnit, m, nb, p, q, mpi_comm );
+    slate::HermitianMatrix<double> H( slate::Uplo::Lower, m, nb, p, q, mpi_comm );
+
+    // Large A, narrow B: keeping A stationary moves less data.
+    test_assert( slate::MethodGemm::select_algo( A, B, opts )
+                 == slate::MethodGemm::GemmA );
+    test_assert( slate::MethodTrsm::select_algo( T, B, opts )
+                 == slate::MethodTrsm::TrsmA );
+    test_assert( slate::MethodHemm::select_algo( H, B, opts )
+                 == slate::MethodHemm::HemmA );
+
+    // B^H B with tall-skinny B: herk's half flops outweigh its extra data.
+    test_assert( slate::MethodCholQR::select_algo( B, B, opts )
+                 == slate::MethodCholQR::HerkC );
+
+    // Square gemm: gemmA and gemmC tie, so the heuristic is kept.
+    test_assert( slate::MethodGemm::select_algo( A, A, opts )
+                 == slate::MethodGemm::GemmC );
+
+    // Devices keep their restrictions.
+    slate::Options opts_dev = { { slate::Option::Target, slate::Target::Devices } };
+    test_assert( slate::MethodCholQR::select_algo( B, B, opts_dev )
+                 == slate::MethodCholQR::HerkC );
+
+    CostModel::disable();
+}
+
+//------------------------------------------------------------------------------
+/// Tests that calibrate reads the cache file on rank 0 and broadcasts it,
+/// even if other ranks can't read the file.
+void test_calibrate()
+{
+    char file_name[] = "/tmp/slate_calibration_XXXXXX";
+    if (mpi_rank == 0) {
+        int fd = mkstemp( file_name );
+        test_assert( fd >= 0 );
+        FILE* file = fdopen( fd, "w" );
+        fprintf( file, "123.0 4.0e-6 5.0e9\n" );
+        fclose( file );
+        setenv( "SLATE_CALIBRATION_FILE", file_name, 1 );
+    }
+    else {
+        setenv( "SLATE_CALIBRATION_FILE", "/nonexistent/calibration", 1 );
+    }
+
+    CostModel::calibrate( mpi_comm );
+    test_assert( CostModel::enabled() );
+    test_assert( CostModel::machine().gflops    == 123.0 );
+    test_assert( CostModel::machine().latency   == 4.0e-6 );
+    test_assert( CostModel::machine().bandwidth == 5.0e9 );
+
+    if (mpi_rank == 0)
+        remove( file_name );
+    unsetenv( "SLATE_CALIBRATION_FILE" );
+    CostModel::disable();
+}
+
+//------------------------------------------------------------------------------
+/// Runs all tests. Called by unit test main().
+void run_tests()
+{
+    run_test( test_disabled,  "select_algo, model disabled", mpi_comm );
+    run_test( test_enabled,   "select_algo, model enabled",  mpi_comm );
+    run_test( test_calibrate, "CostModel::calibrate",        mpi_comm );
+}
+
+}  // namespace test
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace test;  // for globals mpi_rank, etc.
+
+    MPI_Init( &argc, &argv );
+
+    mpi_comm = MPI_COMM_WORLD;
+    MPI_Comm_rank( mpi_comm, &mpi_rank );
+    MPI_Comm_size( mpi_comm, &mpi_size );
+
+    int err = unit_test_main( mpi_comm );  // which calls run_tests()
+
+    MPI_Finalize();
+    return err;
+}
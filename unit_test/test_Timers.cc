@@ -0,0 +1,134 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/Timers.hh"
+
+#include "unit_test.hh"
+
+#include <unistd.h>
+
+using slate::timers::Timers;
+using slate::timers::Phase;
+
+namespace test {
+
+//------------------------------------------------------------------------------
+// global variables
+int mpi_rank;
+int mpi_size;
+MPI_Comm mpi_comm;
+
+//------------------------------------------------------------------------------
+/// Tests that nothing is recorded while timing is off.
+void test_off()
+{
+    Timers::off();
+    Timers::clear();
+    {
+        Phase t( "test::off" );
+        t.stop( 1.0, 2.0 );
+    }
+    test_assert( Timers::phases().empty() );
+}
+
+//------------------------------------------------------------------------------
+/// Tests start and stop, that stop is idempotent, and that repeated phases
+/// accumulate.
+void test_start_stop()
+{
+    Timers::on();
+    Timers::clear();
+    {
+        Phase t( "test::phase" );
+        usleep( 10000 );
+        t.stop( 1.5, 0.25 );
+        // Neither a second stop nor the destructor records again.
+        t.stop( 100, 100 );
+    }
+    {
+        // Stopped by the destructor, with no flops.
+        Phase t( "test::phase" );
+        usleep( 10000 );
+    }
+    Timers::off();
+
+    auto const& phases = Timers::phases();
+    test_assert( phases.size() == 1 );
+    auto const& stats = phases.at( "test::phase" );
+    test_assert( stats.count == 2 );
+    test_assert( stats.gflop == 1.5 );
+    test_assert( stats.gbyte == 0.25 );
+    test_assert( stats.time >= 0.02 );
+    test_assert( stats.time <  1.0 );
+
+    Timers::clear();
+    test_assert( Timers::phases().empty() );
+}
+
+//------------------------------------------------------------------------------
+/// Tests reduce across ranks, including a phase recorded on rank 0 only,
+/// and print.
+void test_reduce()
+{
+    Timers::clear();
+    Timers::insert( "test::all", mpi_rank + 1, 2.0, 0 );
+    if (mpi_rank == 0)
+        Timers::insert( "test::root", 1.0, 0, 0 );
+
+    auto summary = Timers::reduce( mpi_comm );
+    test_assert( summary.size() == 2 );
+
+    auto const& all = summary.at( "test::all" );
+    test_assert( all.min.time == 1 );
+    test_assert( all.max.time == mpi_size );
+    test_assert( all.avg.time == (mpi_size + 1) / 2. );
+    test_assert( all.max.gflop == 2.0 );
+    test_assert( all.max.count == 1 );
+
+    // Ranks that didn't record a phase count as zero.
+    auto const& root = summary.at( "test::root" );
+    test_assert( root.max.time == 1.0 );
+    test_assert( root.min.time == (mpi_size > 1 ? 0 : 1.0) );
+
+    FILE* file = tmpfile();
+    test_assert( file != nullptr );
+    Timers::print( mpi_comm, file );
+    long size = ftell( file );
+    fclose( file );
+    if (mpi_rank == 0)
+        test_assert( size > 0 );
+    else
+        test_assert( size == 0 );
+
+    Timers::clear();
+}
+
+//------------------------------------------------------------------------------
+/// Runs all tests. Called by unit test main().
+void run_tests()
+{
+    run_test( test_off,        "Timers off",                    mpi_comm );
+    run_test( test_start_stop, "Phase start, stop, accumulate", mpi_comm );
+    run_test( test_reduce,     "Timers::reduce, print",         mpi_comm );
+}
+
+}  // namespace test
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace test;  // for globals mpi_rank, etc.
+
+    MPI_Init( &argc, &argv );
+
+    mpi_comm = MPI_COMM_WORLD;
+    MPI_Comm_rank( mpi_comm, &mpi_rank );
+    MPI_Comm_size( mpi_comm, &mpi_size );
+
+    int err = unit_test_main( mpi_comm );  // which calls run_tests()
+
+    MPI_Finalize();
+    return err;
+}
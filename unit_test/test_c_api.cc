@@ -48,6 +48,12 @@ void test_enums()
     assert( slate_Option_PrintWidth          == int( slate::Option::PrintWidth          ) );
     assert( slate_Option_PrintPrecision      == int( slate::Option::PrintPrecision      ) );
     assert( slate_Option_PivotThreshold      == int( slate::Option::PivotThreshold      ) );
+    assert( slate_Option_PanelAggregation    == int( slate::Option::PanelAggregation    ) );
+    assert( slate_Option_TileAffinity        == int( slate::Option::TileAffinity        ) );
+    assert( slate_Option_Replication         == int( slate::Option::Replication         ) );
+    assert( slate_Option_CompactBand         == int( slate::Option::CompactBand         ) );
+    assert( slate_Option_Gemm3M              == int( slate::Option::Gemm3M              ) );
+    assert( slate_Option_GemmPacked          == int( slate::Option::GemmPacked          ) );
 
     assert( slate_Option_MethodCholQR        == int( slate::Option::MethodCholQR        ) );
     assert( slate_Option_MethodEig           == int( slate::Option::MethodEig           ) );
@@ -55,6 +61,7 @@ void test_enums()
     assert( slate_Option_MethodGemm          == int( slate::Option::MethodGemm          ) );
     assert( slate_Option_MethodHemm          == int( slate::Option::MethodHemm          ) );
     assert( slate_Option_MethodLU            == int( slate::Option::MethodLU            ) );
+    assert( slate_Option_MethodReduce        == int( slate::Option::MethodReduce        ) );
     assert( slate_Option_MethodTrsm          == int( slate::Option::MethodTrsm          ) );
 
     //----------